@@ -17,6 +17,7 @@
 
 #pragma once
 
+#include <Reaktoro/Common/BinaryUtils.hpp>
 #include <Reaktoro/Common/ChemicalScalar.hpp>
 #include <Reaktoro/Common/ChemicalVector.hpp>
 #include <Reaktoro/Common/Constants.hpp>
@@ -28,11 +29,14 @@
 #include <Reaktoro/Common/Index.hpp>
 #include <Reaktoro/Common/InterpolationUtils.hpp>
 #include <Reaktoro/Common/Json.hpp>
+#include <Reaktoro/Common/MemoryMappedFile.hpp>
 #include <Reaktoro/Common/NamingUtils.hpp>
 #include <Reaktoro/Common/OptimizationUtils.hpp>
 #include <Reaktoro/Common/Optional.hpp>
 #include <Reaktoro/Common/Outputter.hpp>
+#include <Reaktoro/Common/ParallelUtils.hpp>
 #include <Reaktoro/Common/ParseUtils.hpp>
+#include <Reaktoro/Common/Profiling.hpp>
 #include <Reaktoro/Common/ReactionEquation.hpp>
 #include <Reaktoro/Common/ScalarTypes.hpp>
 #include <Reaktoro/Common/SetUtils.hpp>
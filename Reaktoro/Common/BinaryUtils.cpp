@@ -0,0 +1,137 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright (C) 2014-2018 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+#include "BinaryUtils.hpp"
+
+// C++ includes
+#include <limits>
+
+// Reaktoro includes
+#include <Reaktoro/Common/Exception.hpp>
+
+namespace Reaktoro {
+namespace {
+
+/// Check that a binary stream has the bytes of a number of entries of a given size left to be read.
+/// Nothing is checked if the stream failed, which is left for the caller to handle.
+auto assertRemainingBytes(std::istream& in, std::uint64_t count, std::uint64_t size) -> void
+{
+    Assert(!in.good() || (count <= std::numeric_limits<std::uint64_t>::max()/size && count*size <= remainingBytes(in)),
+        "Could not read the binary data.",
+        "The stored size of " << count << " entries exceeds the data left, which is truncated or corrupted.");
+}
+
+/// Read the dimensions of a matrix from a binary stream, checked against the bytes left in it.
+auto readDimensions(std::istream& in, std::uint64_t& rows, std::uint64_t& cols) -> void
+{
+    readBinary(in, rows);
+    readBinary(in, cols);
+    if(!in.good())
+        rows = cols = 0;
+    Assert(cols == 0 || rows <= std::numeric_limits<std::uint64_t>::max()/cols,
+        "Could not read the binary data.",
+        "The stored dimensions " << rows << "x" << cols << " overflow, since the data is corrupted.");
+    assertRemainingBytes(in, rows*cols, sizeof(double));
+}
+
+} // namespace
+
+auto remainingBytes(std::istream& in) -> std::uint64_t
+{
+    if(!in.good())
+        return 0;
+    // Seek through the buffer, which leaves the state of the stream unchanged
+    std::streambuf* buffer = in.rdbuf();
+    const auto pos = buffer->pubseekoff(0, std::ios::cur, std::ios::in);
+    if(pos == std::streampos(-1))
+        return std::numeric_limits<std::uint64_t>::max();
+    const auto end = buffer->pubseekoff(0, std::ios::end, std::ios::in);
+    buffer->pubseekpos(pos, std::ios::in);
+    if(end == std::streampos(-1) || end < pos)
+        return std::numeric_limits<std::uint64_t>::max();
+    return static_cast<std::uint64_t>(end - pos);
+}
+
+auto writeBinary(std::ostream& out, const std::string& str) -> void
+{
+    const std::uint64_t size = str.size();
+    writeBinary(out, size);
+    out.write(str.data(), size);
+}
+
+auto readBinary(std::istream& in, std::string& str) -> void
+{
+    std::uint64_t size = 0;
+    readBinary(in, size);
+    assertRemainingBytes(in, size, 1);
+    if(!in.good()) size = 0;
+    str.resize(size);
+    in.read(&str[0], size);
+}
+
+auto writeBinary(std::ostream& out, const std::vector<double>& values) -> void
+{
+    const std::uint64_t size = values.size();
+    writeBinary(out, size);
+    out.write(reinterpret_cast<const char*>(values.data()), size * sizeof(double));
+}
+
+auto readBinary(std::istream& in, std::vector<double>& values) -> void
+{
+    std::uint64_t size = 0;
+    readBinary(in, size);
+    assertRemainingBytes(in, size, sizeof(double));
+    if(!in.good()) size = 0;
+    values.resize(size);
+    in.read(reinterpret_cast<char*>(values.data()), size * sizeof(double));
+}
+
+auto readBinary(std::istream& in, Vector& vec) -> void
+{
+    std::uint64_t rows = 0, cols = 0;
+    readDimensions(in, rows, cols);
+    Assert(!in.good() || cols == 1, "Could not read the binary data.",
+        "The stored data has " << cols << " columns, but a vector with a single column was expected.");
+    vec.resize(rows);
+    in.read(reinterpret_cast<char*>(vec.data()), rows * sizeof(double));
+}
+
+auto readBinary(std::istream& in, Matrix& mat) -> void
+{
+    std::uint64_t rows = 0, cols = 0;
+    readDimensions(in, rows, cols);
+    mat.resize(rows, cols);
+    in.read(reinterpret_cast<char*>(mat.data()), rows * cols * sizeof(double));
+}
+
+auto hashBytes(const void* data, std::size_t size, std::uint64_t hash) -> std::uint64_t
+{
+    const auto* bytes = static_cast<const unsigned char*>(data);
+    for(std::size_t i = 0; i < size; ++i)
+    {
+        hash ^= bytes[i];
+        hash *= 1099511628211ull;
+    }
+    return hash;
+}
+
+auto hashString(const std::string& str, std::uint64_t hash) -> std::uint64_t
+{
+    return hashBytes(str.data(), str.size(), hash);
+}
+
+} // namespace Reaktoro
@@ -0,0 +1,97 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright (C) 2014-2018 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+// C++ includes
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+// Reaktoro includes
+#include <Reaktoro/Common/Index.hpp>
+#include <Reaktoro/Math/Matrix.hpp>
+
+namespace Reaktoro {
+
+/// Write an arithmetic value to a binary stream.
+template<typename T, typename = typename std::enable_if<std::is_arithmetic<T>::value>::type>
+auto writeBinary(std::ostream& out, const T& value) -> void
+{
+    out.write(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+/// Read an arithmetic value from a binary stream.
+template<typename T, typename = typename std::enable_if<std::is_arithmetic<T>::value>::type>
+auto readBinary(std::istream& in, T& value) -> void
+{
+    in.read(reinterpret_cast<char*>(&value), sizeof(T));
+}
+
+/// Write a string to a binary stream as its length followed by its characters.
+auto writeBinary(std::ostream& out, const std::string& str) -> void;
+
+/// Write a vector or matrix to a binary stream as its dimensions followed by its column-major entries.
+template<typename Derived>
+auto writeBinary(std::ostream& out, const Eigen::MatrixBase<Derived>& mat) -> void
+{
+    const std::uint64_t rows = mat.rows();
+    const std::uint64_t cols = mat.cols();
+    writeBinary(out, rows);
+    writeBinary(out, cols);
+    // Column-major expressions with direct memory access are written without being copied
+    const Eigen::Ref<const Matrix> ref(mat);
+    if(ref.outerStride() == ref.rows())
+        out.write(reinterpret_cast<const char*>(ref.data()), rows * cols * sizeof(double));
+    else
+        for(Index j = 0; j < Index(ref.cols()); ++j)
+            out.write(reinterpret_cast<const char*>(ref.col(j).data()), rows * sizeof(double));
+}
+
+/// Write a list of numbers to a binary stream as its length followed by its entries.
+auto writeBinary(std::ostream& out, const std::vector<double>& values) -> void;
+
+/// Return the number of bytes left to be read from a binary stream.
+/// This is zero if the stream is not good, and the largest value if the stream does not support seeking.
+auto remainingBytes(std::istream& in) -> std::uint64_t;
+
+/// Read a string from a binary stream written with @ref writeBinary.
+/// The stored sizes of strings, lists, vectors and matrices are checked against the bytes left in the
+/// stream before any memory is allocated, so that truncated or corrupted data throws an exception.
+auto readBinary(std::istream& in, std::string& str) -> void;
+
+/// Read a list of numbers from a binary stream written with @ref writeBinary.
+auto readBinary(std::istream& in, std::vector<double>& values) -> void;
+
+/// Read a vector from a binary stream written with @ref writeBinary (with a single column).
+auto readBinary(std::istream& in, Vector& vec) -> void;
+
+/// Read a matrix from a binary stream written with @ref writeBinary.
+auto readBinary(std::istream& in, Matrix& mat) -> void;
+
+/// Return the 64-bit FNV-1a hash of a sequence of bytes combined with a previous hash value.
+/// @param hash The previous hash value (use the default value to start a new hash)
+/// @param data The pointer to the bytes to be hashed
+/// @param size The number of bytes to be hashed
+auto hashBytes(const void* data, std::size_t size, std::uint64_t hash = 14695981039346656037ull) -> std::uint64_t;
+
+/// Return the hash of a string combined with a previous hash value.
+auto hashString(const std::string& str, std::uint64_t hash = 14695981039346656037ull) -> std::uint64_t;
+
+} // namespace Reaktoro
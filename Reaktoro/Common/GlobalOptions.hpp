@@ -61,6 +61,13 @@ struct DatabaseOptions
 {
     /// When `true`, causes all species with missing data to be ignored during initialization.
     bool exclude_species_with_missing_data = true;
+
+    /// The directory where built-in databases are cached in a pre-parsed binary format.
+    /// When not empty, the first use of a built-in database parses its xml data and saves it in
+    /// this directory, and subsequent uses, possibly by other processes, load the binary file instead.
+    /// A cached file is created again if it was created with a different value of `exclude_species_with_missing_data`
+    /// or from a different version of the built-in database, e.g., one embedded in an older version of Reaktoro.
+    std::string cache_directory;
 };
 
 /// A type used to describe all options related to aqueous models.
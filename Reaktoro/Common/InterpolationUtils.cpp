@@ -17,12 +17,88 @@
 
 #include "InterpolationUtils.hpp"
 
+// C++ includes
+#include <algorithm>
+#include <cmath>
+#include <map>
+
 // Reaktoro includes
+#include <Reaktoro/Common/Exception.hpp>
 #include <Reaktoro/Common/ThermoScalar.hpp>
 #include <Reaktoro/Common/ThermoVector.hpp>
+#include <Reaktoro/Math/BicubicInterpolator.hpp>
 #include <Reaktoro/Math/BilinearInterpolator.hpp>
 
 namespace Reaktoro {
+namespace {
+
+/// The values of a set of ThermoScalar functions at every (T, P) point, with `k = i + j*size(temperatures)`.
+using ThermoScalarTable = std::vector<std::vector<ThermoScalar>>;
+
+/// Evaluate the functions at a (T, P) point.
+auto evaluateFunctions(const std::vector<ThermoScalarFunction>& fs, double T, double P) -> std::vector<ThermoScalar>
+{
+    std::vector<ThermoScalar> res;
+    res.reserve(fs.size());
+    for(const auto& f : fs)
+        res.push_back(f(T, P));
+    return res;
+}
+
+/// Evaluate the functions at every (T, P) point.
+auto evaluateFunctions(
+    const std::vector<double>& temperatures,
+    const std::vector<double>& pressures,
+    const std::vector<ThermoScalarFunction>& fs) -> ThermoScalarTable
+{
+    ThermoScalarTable table;
+    table.reserve(temperatures.size() * pressures.size());
+    for(double P : pressures)
+        for(double T : temperatures)
+            table.push_back(evaluateFunctions(fs, T, P));
+    return table;
+}
+
+/// Return the bicubic interpolators of the functions with values in a table.
+auto bicubicInterpolators(
+    const std::vector<double>& temperatures,
+    const std::vector<double>& pressures,
+    const ThermoScalarTable& table,
+    unsigned size) -> std::vector<BicubicInterpolator>
+{
+    std::vector<BicubicInterpolator> interpolators(size);
+    std::vector<double> vals(table.size()), ddTs(table.size()), ddPs(table.size());
+
+    for(unsigned i = 0; i < size; ++i)
+    {
+        for(unsigned k = 0; k < table.size(); ++k)
+        {
+            vals[k] = table[k][i].val;
+            ddTs[k] = table[k][i].ddT;
+            ddPs[k] = table[k][i].ddP;
+        }
+
+        interpolators[i] = BicubicInterpolator(temperatures, pressures, vals, ddTs, ddPs);
+    }
+
+    return interpolators;
+}
+
+/// Return the midpoints of the intervals marked for bisection merged with the given points.
+auto bisect(const std::vector<double>& points, const std::vector<bool>& marked) -> std::vector<double>
+{
+    std::vector<double> res;
+    res.reserve(2 * points.size());
+    for(unsigned i = 0; i < points.size(); ++i)
+    {
+        res.push_back(points[i]);
+        if(i < marked.size() && marked[i])
+            res.push_back(0.5*(points[i] + points[i + 1]));
+    }
+    return res;
+}
+
+} // namespace
 
 auto interpolate(
     const std::vector<double>& temperatures,
@@ -76,24 +152,55 @@ auto interpolate(
     const std::vector<double>& temperatures,
     const std::vector<double>& pressures,
     const std::vector<ThermoScalarFunction>& fs) -> ThermoVectorFunction
+{
+    return interpolate(temperatures, pressures, fs, InterpolationMethod::Bilinear);
+}
+
+auto interpolate(
+    const std::vector<double>& temperatures,
+    const std::vector<double>& pressures,
+    const std::vector<ThermoScalarFunction>& fs,
+    InterpolationMethod method) -> ThermoVectorFunction
 {
     const unsigned size = fs.size();
 
+    // Evaluate every function only once at every (T, P) point
+    const ThermoScalarTable table = evaluateFunctions(temperatures, pressures, fs);
+
+    ThermoVector res(size);
+
+    if(method == InterpolationMethod::Bicubic)
+    {
+        const std::vector<BicubicInterpolator> interpolators =
+            bicubicInterpolators(temperatures, pressures, table, size);
+
+        auto func = [=](double T, double P) mutable
+        {
+            for(unsigned i = 0; i < size; ++i)
+                res.val[i] = interpolators[i](T, P, res.ddT[i], res.ddP[i]);
+            return res;
+        };
+
+        return func;
+    }
+
     std::vector<BilinearInterpolator> val(size), ddT(size), ddP(size);
+    std::vector<double> vals(table.size()), ddTs(table.size()), ddPs(table.size());
 
     for(unsigned i = 0; i < size; ++i)
     {
-        auto val_func = [=](double T, double P) { return fs[i](T, P).val; };
-        auto ddT_func = [=](double T, double P) { return fs[i](T, P).ddT; };
-        auto ddP_func = [=](double T, double P) { return fs[i](T, P).ddP; };
+        for(unsigned k = 0; k < table.size(); ++k)
+        {
+            vals[k] = table[k][i].val;
+            ddTs[k] = table[k][i].ddT;
+            ddPs[k] = table[k][i].ddP;
+        }
 
-        val[i] = BilinearInterpolator(temperatures, pressures, val_func);
-        ddT[i] = BilinearInterpolator(temperatures, pressures, ddT_func);
-        ddP[i] = BilinearInterpolator(temperatures, pressures, ddP_func);
+        val[i] = BilinearInterpolator(temperatures, pressures, vals);
+        ddT[i] = BilinearInterpolator(temperatures, pressures, ddTs);
+        ddP[i] = BilinearInterpolator(temperatures, pressures, ddPs);
     }
 
-    ThermoVector res(size);
-
     auto func = [=](double T, double P) mutable
     {
         for(unsigned i = 0; i < size; ++i)
@@ -108,4 +215,85 @@ auto interpolate(
     return func;
 }
 
+auto refineInterpolationPoints(
+    std::vector<double>& temperatures,
+    std::vector<double>& pressures,
+    const std::vector<ThermoScalarFunction>& fs,
+    double tolerance,
+    unsigned maxlevels) -> bool
+{
+    Assert(temperatures.size() && pressures.size(),
+        "Cannot refine the interpolation points.",
+        "The temperature and pressure points must not be empty.");
+
+    const unsigned size = fs.size();
+
+    // The values of the functions at the already evaluated (T, P) points
+    std::map<std::pair<double, double>, std::vector<ThermoScalar>> cache;
+
+    const auto evaluate = [&](double T, double P) -> const std::vector<ThermoScalar>&
+    {
+        auto iter = cache.find({T, P});
+        if(iter == cache.end())
+            iter = cache.emplace(std::make_pair(T, P), evaluateFunctions(fs, T, P)).first;
+        return iter->second;
+    };
+
+    for(unsigned level = 0; ; ++level)
+    {
+        const unsigned sizeT = temperatures.size();
+        const unsigned sizeP = pressures.size();
+
+        ThermoScalarTable table;
+        table.reserve(sizeT * sizeP);
+        for(double P : pressures)
+            for(double T : temperatures)
+                table.push_back(evaluate(T, P));
+
+        const std::vector<BicubicInterpolator> interpolators =
+            bicubicInterpolators(temperatures, pressures, table, size);
+
+        // Return true if the interpolation error at (T, P) is above the tolerance
+        const auto inaccurate = [&](double T, double P)
+        {
+            const std::vector<ThermoScalar>& exact = evaluate(T, P);
+            for(unsigned i = 0; i < size; ++i)
+                if(std::abs(interpolators[i](T, P) - exact[i].val) > tolerance)
+                    return true;
+            return false;
+        };
+
+        // The temperature and pressure intervals to be bisected
+        std::vector<bool> bisectT(sizeT - 1), bisectP(sizeP - 1);
+
+        // Check the errors at the midpoints of the edges along temperature
+        for(unsigned i = 0; i + 1 < sizeT; ++i)
+            for(unsigned j = 0; j < sizeP && !bisectT[i]; ++j)
+                bisectT[i] = inaccurate(0.5*(temperatures[i] + temperatures[i + 1]), pressures[j]);
+
+        // Check the errors at the midpoints of the edges along pressure
+        for(unsigned j = 0; j + 1 < sizeP; ++j)
+            for(unsigned i = 0; i < sizeT && !bisectP[j]; ++i)
+                bisectP[j] = inaccurate(temperatures[i], 0.5*(pressures[j] + pressures[j + 1]));
+
+        // Check the errors at the centers of the cells not yet bisected in any direction
+        for(unsigned i = 0; i + 1 < sizeT; ++i)
+            for(unsigned j = 0; j + 1 < sizeP; ++j)
+                if(!bisectT[i] && !bisectP[j] && inaccurate(0.5*(temperatures[i] + temperatures[i + 1]), 0.5*(pressures[j] + pressures[j + 1])))
+                    bisectT[i] = bisectP[j] = true;
+
+        // Stop if the interpolation is accurate everywhere
+        if(std::none_of(bisectT.begin(), bisectT.end(), [](bool x) { return x; }) &&
+           std::none_of(bisectP.begin(), bisectP.end(), [](bool x) { return x; }))
+            return true;
+
+        // Stop if the maximum number of bisections was reached without attaining the tolerance
+        if(level == maxlevels)
+            return false;
+
+        temperatures = bisect(temperatures, bisectT);
+        pressures = bisect(pressures, bisectP);
+    }
+}
+
 } // namespace Reaktoro
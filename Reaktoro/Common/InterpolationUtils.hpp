@@ -25,6 +25,17 @@
 
 namespace Reaktoro {
 
+/// The methods for the interpolation of thermodynamic properties over (T, P) points.
+enum class InterpolationMethod
+{
+    /// Use bilinear interpolation of the values and of the temperature and pressure derivatives.
+    Bilinear,
+
+    /// Use bicubic Hermite interpolation with the temperature and pressure derivatives as slopes.
+    /// The derivatives of the interpolation are continuous and consistent with its values.
+    Bicubic,
+};
+
 auto interpolate(
     const std::vector<double>& temperatures,
     const std::vector<double>& pressures,
@@ -40,4 +51,29 @@ auto interpolate(
     const std::vector<double>& pressures,
     const std::vector<ThermoScalarFunction>& fs) -> ThermoVectorFunction;
 
+/// Return a function that interpolates the given functions over the (T, P) points with the given method.
+auto interpolate(
+    const std::vector<double>& temperatures,
+    const std::vector<double>& pressures,
+    const std::vector<ThermoScalarFunction>& fs,
+    InterpolationMethod method) -> ThermoVectorFunction;
+
+/// Refine the (T, P) points until the bicubic interpolation of the given functions attains a tolerance.
+/// The error of the interpolation is checked at the midpoints of the edges and at the centers of the
+/// (T, P) cells. The temperature and pressure intervals with errors above `tolerance` are bisected,
+/// and this is repeated until all errors are below `tolerance` or after `maxlevels` bisections.
+/// In the latter case, the refined points are kept but the tolerance is not attained.
+/// @param temperatures The temperatures of the initial points, replaced by the refined ones
+/// @param pressures The pressures of the initial points, replaced by the refined ones
+/// @param fs The functions to be interpolated
+/// @param tolerance The absolute tolerance on the interpolated values of the functions
+/// @param maxlevels The maximum number of bisections of the initial intervals
+/// @return True if the tolerance was attained, false otherwise
+auto refineInterpolationPoints(
+    std::vector<double>& temperatures,
+    std::vector<double>& pressures,
+    const std::vector<ThermoScalarFunction>& fs,
+    double tolerance,
+    unsigned maxlevels = 6) -> bool;
+
 } // namespace Reaktoro
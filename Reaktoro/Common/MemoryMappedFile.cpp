@@ -0,0 +1,188 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright (C) 2014-2018 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+#include "MemoryMappedFile.hpp"
+
+// C++ includes
+#include <utility>
+
+// Reaktoro includes
+#include <Reaktoro/Common/Exception.hpp>
+
+#if _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace Reaktoro {
+
+struct MemoryMappedFile::Impl
+{
+    /// The pointer to the first byte of the mapped file
+    const char* data = nullptr;
+
+    /// The number of bytes in the mapped file
+    std::size_t size = 0;
+
+    /// Map a file into memory.
+    auto open(std::string filename) -> void
+    {
+        close();
+
+#if _WIN32
+        HANDLE file = CreateFileA(filename.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+        Assert(file != INVALID_HANDLE_VALUE, "Could not map the file `" << filename << "` into memory.",
+            "The file could not be opened for reading.");
+        LARGE_INTEGER length;
+        GetFileSizeEx(file, &length);
+        size = static_cast<std::size_t>(length.QuadPart);
+        if(size)
+        {
+            HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+            if(mapping) data = static_cast<const char*>(MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0));
+            if(mapping) CloseHandle(mapping);
+        }
+        CloseHandle(file);
+#else
+        const int fd = ::open(filename.c_str(), O_RDONLY);
+        Assert(fd != -1, "Could not map the file `" << filename << "` into memory.",
+            "The file could not be opened for reading.");
+        struct stat info;
+        const bool ok = fstat(fd, &info) == 0;
+        size = ok ? static_cast<std::size_t>(info.st_size) : 0;
+        if(size)
+        {
+            void* ptr = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+            if(ptr != MAP_FAILED) data = static_cast<const char*>(ptr);
+        }
+        ::close(fd);
+#endif
+
+        if(size && data == nullptr)
+        {
+            size = 0;
+            RuntimeError("Could not map the file `" + filename + "` into memory.",
+                "The operating system failed to create the memory mapping.");
+        }
+    }
+
+    /// Unmap the current file.
+    auto close() -> void
+    {
+        if(data)
+        {
+#if _WIN32
+            UnmapViewOfFile(data);
+#else
+            munmap(const_cast<char*>(data), size);
+#endif
+        }
+        data = nullptr;
+        size = 0;
+    }
+
+    ~Impl()
+    {
+        close();
+    }
+};
+
+MemoryMappedFile::MemoryMappedFile()
+: pimpl(new Impl())
+{}
+
+MemoryMappedFile::MemoryMappedFile(std::string filename)
+: pimpl(new Impl())
+{
+    open(filename);
+}
+
+MemoryMappedFile::MemoryMappedFile(MemoryMappedFile&& other)
+: pimpl(std::move(other.pimpl))
+{
+    other.pimpl.reset(new Impl());
+}
+
+MemoryMappedFile::~MemoryMappedFile()
+{}
+
+auto MemoryMappedFile::operator=(MemoryMappedFile&& other) -> MemoryMappedFile&
+{
+    std::swap(pimpl, other.pimpl);
+    return *this;
+}
+
+auto MemoryMappedFile::open(std::string filename) -> void
+{
+    pimpl->open(filename);
+}
+
+auto MemoryMappedFile::close() -> void
+{
+    pimpl->close();
+}
+
+auto MemoryMappedFile::isOpen() const -> bool
+{
+    return pimpl->data != nullptr;
+}
+
+auto MemoryMappedFile::data() const -> const char*
+{
+    return pimpl->data;
+}
+
+auto MemoryMappedFile::size() const -> std::size_t
+{
+    return pimpl->size;
+}
+
+MemoryInputStream::Buffer::Buffer(const char* data, std::size_t size)
+{
+    char* begin = const_cast<char*>(data);
+    setg(begin, begin, begin + size);
+}
+
+auto MemoryInputStream::Buffer::seekoff(off_type off, std::ios_base::seekdir dir, std::ios_base::openmode) -> pos_type
+{
+    char* base = dir == std::ios_base::beg ? eback() : dir == std::ios_base::cur ? gptr() : egptr();
+    if(off < eback() - base || off > egptr() - base)
+        return pos_type(off_type(-1));
+    setg(eback(), base + off, egptr());
+    return pos_type(gptr() - eback());
+}
+
+auto MemoryInputStream::Buffer::seekpos(pos_type pos, std::ios_base::openmode which) -> pos_type
+{
+    return seekoff(off_type(pos), std::ios_base::beg, which);
+}
+
+MemoryInputStream::MemoryInputStream(const char* data, std::size_t size)
+: std::istream(nullptr), buffer(data, size)
+{
+    rdbuf(&buffer);
+}
+
+MemoryInputStream::MemoryInputStream(const MemoryMappedFile& file)
+: MemoryInputStream(file.data(), file.size())
+{}
+
+} // namespace Reaktoro
@@ -0,0 +1,100 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright (C) 2014-2018 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+// C++ includes
+#include <istream>
+#include <memory>
+#include <streambuf>
+#include <string>
+
+namespace Reaktoro {
+
+/// A class that maps the contents of a file into memory for reading.
+/// The pages of the file are read by the operating system only when accessed,
+/// which avoids the intermediate buffering of file streams for large files.
+class MemoryMappedFile
+{
+public:
+    /// Construct a default MemoryMappedFile instance with no file.
+    MemoryMappedFile();
+
+    /// Construct a MemoryMappedFile instance mapping the given file.
+    explicit MemoryMappedFile(std::string filename);
+
+    /// Construct a MemoryMappedFile instance by moving another one.
+    MemoryMappedFile(MemoryMappedFile&& other);
+
+    /// Destroy this MemoryMappedFile instance, unmapping its file.
+    virtual ~MemoryMappedFile();
+
+    /// Assign another MemoryMappedFile instance to this by moving it.
+    auto operator=(MemoryMappedFile&& other) -> MemoryMappedFile&;
+
+    /// Map a file into memory, unmapping the current one if any.
+    auto open(std::string filename) -> void;
+
+    /// Unmap the current file.
+    auto close() -> void;
+
+    /// Return true if a file is mapped.
+    auto isOpen() const -> bool;
+
+    /// Return the pointer to the first byte of the mapped file.
+    auto data() const -> const char*;
+
+    /// Return the number of bytes in the mapped file.
+    auto size() const -> std::size_t;
+
+private:
+    struct Impl;
+
+    std::unique_ptr<Impl> pimpl;
+};
+
+/// An input stream that reads from a buffer in memory without copying it.
+/// The stream supports `seekg` and `tellg`, so that records at known offsets can be read directly.
+/// This permits the functions that read binary data from streams to read
+/// directly from a @ref MemoryMappedFile.
+class MemoryInputStream : public std::istream
+{
+public:
+    /// Construct a MemoryInputStream instance over a buffer.
+    MemoryInputStream(const char* data, std::size_t size);
+
+    /// Construct a MemoryInputStream instance over the contents of a mapped file.
+    explicit MemoryInputStream(const MemoryMappedFile& file);
+
+private:
+    /// The stream buffer that exposes the memory buffer as its get area.
+    struct Buffer : public std::streambuf
+    {
+        Buffer(const char* data, std::size_t size);
+
+        /// Move the read position relative to the beginning, the current position or the end of the buffer.
+        virtual auto seekoff(off_type off, std::ios_base::seekdir dir, std::ios_base::openmode which) -> pos_type;
+
+        /// Move the read position to an absolute position in the buffer.
+        virtual auto seekpos(pos_type pos, std::ios_base::openmode which) -> pos_type;
+    };
+
+    /// The stream buffer of this stream.
+    Buffer buffer;
+};
+
+} // namespace Reaktoro
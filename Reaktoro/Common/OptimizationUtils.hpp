@@ -18,23 +18,49 @@
 #pragma once
 
 // C++ includes
+#include <deque>
 #include <functional>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <tuple>
 
 namespace Reaktoro {
 
+/// Return a function that caches the results of a given function for every set of arguments.
+/// The returned function can be called concurrently from several threads. The mutex is not held
+/// while the given function is evaluated, so that it can itself call memoized functions.
+/// If `capacity` is positive, the oldest results are discarded once the cache holds more than
+/// `capacity` results, so that the memory used by the cache is bounded.
 template <typename Ret, typename... Args>
-auto memoize(std::function<Ret(Args...)> f) -> std::function<Ret(Args...)>
+auto memoize(std::function<Ret(Args...)> f, std::size_t capacity = 0) -> std::function<Ret(Args...)>
 {
-    auto cache = std::make_shared<std::map<std::tuple<Args...>, Ret>>();
+    using Cache = std::map<std::tuple<Args...>, Ret>;
+    auto cache = std::make_shared<Cache>();
+    auto order = std::make_shared<std::deque<typename Cache::iterator>>();
+    auto mutex = std::make_shared<std::mutex>();
     return [=](Args... args) mutable -> Ret
     {
         std::tuple<Args...> t(args...);
-        if(cache->find(t) == cache->end())
-            (*cache)[t] = f(args...);
-        return (*cache)[t];
+        {
+            std::lock_guard<std::mutex> lock(*mutex);
+            auto iter = cache->find(t);
+            if(iter != cache->end())
+                return iter->second;
+        }
+        Ret result = f(args...);
+        std::lock_guard<std::mutex> lock(*mutex);
+        auto inserted = cache->emplace(t, result);
+        if(capacity > 0 && inserted.second)
+        {
+            order->push_back(inserted.first);
+            if(order->size() > capacity)
+            {
+                cache->erase(order->front());
+                order->pop_front();
+            }
+        }
+        return result;
     };
 }
 
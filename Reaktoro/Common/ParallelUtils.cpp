@@ -0,0 +1,172 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright (C) 2014-2018 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+#include "ParallelUtils.hpp"
+
+// C++ includes
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace Reaktoro {
+namespace {
+
+/// The boolean flag that indicates if the calling thread is a worker of the thread pool
+thread_local bool is_worker_thread = false;
+
+/// A pool of worker threads that persist across parallel loops.
+class ThreadPool
+{
+public:
+    /// Destroy this ThreadPool instance after its workers have finished the pending tasks
+    ~ThreadPool()
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            stopped = true;
+        }
+        condition.notify_all();
+        for(auto& worker : workers)
+            worker.join();
+    }
+
+    /// Ensure the pool has at least a given number of worker threads
+    auto reserve(unsigned size) -> void
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        while(workers.size() < size)
+            workers.emplace_back([this]() { work(); });
+    }
+
+    /// Add a task to be executed by one of the worker threads
+    auto submit(std::function<void()> task) -> void
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            tasks.push_back(std::move(task));
+        }
+        condition.notify_one();
+    }
+
+private:
+    /// The worker threads of the pool
+    std::vector<std::thread> workers;
+
+    /// The tasks waiting for a worker thread
+    std::deque<std::function<void()>> tasks;
+
+    /// The mutex that protects the tasks and the workers
+    std::mutex mutex;
+
+    /// The condition variable used to wake up the workers
+    std::condition_variable condition;
+
+    /// The boolean flag that indicates if the pool is being destroyed
+    bool stopped = false;
+
+    /// Execute the submitted tasks until the pool is destroyed
+    auto work() -> void
+    {
+        is_worker_thread = true;
+
+        while(true)
+        {
+            std::function<void()> task;
+            {
+                std::unique_lock<std::mutex> lock(mutex);
+                condition.wait(lock, [&]() { return stopped || !tasks.empty(); });
+                if(tasks.empty())
+                    return;
+                task = std::move(tasks.front());
+                tasks.pop_front();
+            }
+            task();
+        }
+    }
+};
+
+/// Return the thread pool shared by all parallel loops
+auto threadPool() -> ThreadPool&
+{
+    static ThreadPool pool;
+    return pool;
+}
+
+} // namespace
+
+auto defaultNumThreads() -> unsigned
+{
+    return std::max(std::thread::hardware_concurrency(), 1u);
+}
+
+auto parallelFor(Index size, const std::function<void(Index, Index)>& f, unsigned num_threads) -> void
+{
+    if(num_threads == 0)
+        num_threads = defaultNumThreads();
+
+    const Index num_chunks = std::min<Index>(num_threads, size);
+
+    // Process the loop in the calling thread if there is only one chunk, or if it is
+    // nested in another parallel loop, whose chunks already occupy the worker threads
+    if(num_chunks <= 1 || is_worker_thread)
+    {
+        if(size) f(0, size);
+        return;
+    }
+
+    std::vector<std::exception_ptr> errors(num_chunks);
+
+    // The number of chunks processed by the worker threads not yet finished
+    Index remaining = num_chunks - 1;
+    std::mutex mutex;
+    std::condition_variable finished;
+
+    auto process = [&](Index ichunk)
+    {
+        const Index begin = ichunk * size / num_chunks;
+        const Index end = (ichunk + 1) * size / num_chunks;
+        try { f(begin, end); }
+        catch(...) { errors[ichunk] = std::current_exception(); }
+    };
+
+    ThreadPool& pool = threadPool();
+    pool.reserve(num_chunks - 1);
+
+    for(Index ichunk = 1; ichunk < num_chunks; ++ichunk)
+        pool.submit([&, ichunk]()
+        {
+            process(ichunk);
+            std::lock_guard<std::mutex> lock(mutex);
+            if(--remaining == 0)
+                finished.notify_one();
+        });
+
+    process(0);
+
+    std::unique_lock<std::mutex> lock(mutex);
+    finished.wait(lock, [&]() { return remaining == 0; });
+    lock.unlock();
+
+    for(const auto& error : errors)
+        if(error) std::rethrow_exception(error);
+}
+
+} // namespace Reaktoro
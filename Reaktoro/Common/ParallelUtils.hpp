@@ -0,0 +1,42 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright (C) 2014-2018 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+// C++ includes
+#include <functional>
+
+// Reaktoro includes
+#include <Reaktoro/Common/Index.hpp>
+
+namespace Reaktoro {
+
+/// Return the number of threads used by default in parallel loops.
+/// This is the number of concurrent threads supported by the hardware, or one if it is unknown.
+auto defaultNumThreads() -> unsigned;
+
+/// Apply a function over the range `[0, size)` split into contiguous chunks processed in parallel.
+/// The function is called as `f(begin, end)` once for every chunk. The calling thread processes one
+/// of the chunks, and the others are processed by a pool of worker threads created at the first call
+/// and reused in the later ones. A parallel loop nested in another one is processed serially in the
+/// calling thread. An exception thrown in any chunk is rethrown after all chunks have finished.
+/// @param size The number of iterations in the loop
+/// @param f The function that processes the iterations in `[begin, end)`
+/// @param num_threads The number of threads (zero for @ref defaultNumThreads)
+auto parallelFor(Index size, const std::function<void(Index, Index)>& f, unsigned num_threads = 0) -> void;
+
+} // namespace Reaktoro
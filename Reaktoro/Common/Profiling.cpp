@@ -0,0 +1,478 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright (C) 2014-2018 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+#include "Profiling.hpp"
+
+// C++ includes
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <iomanip>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace Reaktoro {
+namespace {
+
+/// The measurement of a profiled scope
+struct ProfilerEvent
+{
+    /// The identifier of the scope
+    Index id;
+
+    /// The time at the beginning of the scope (in units of ns)
+    long long start;
+
+    /// The time spent in the scope (in units of ns)
+    long long duration;
+
+    /// The time spent in the scope excluding nested scopes (in units of ns)
+    long long self;
+};
+
+/// The recorded value of a counter
+struct ProfilerSample
+{
+    /// The identifier of the counter
+    Index id;
+
+    /// The time of the sample (in units of ns)
+    long long time;
+
+    /// The value of the counter
+    double value;
+};
+
+/// The aggregated measurements of a scope or counter
+struct ProfilerTotals
+{
+    /// The number of calls of the scope
+    Index calls = 0;
+
+    /// The time spent in the scope (in units of ns)
+    long long total = 0;
+
+    /// The time spent in the scope excluding nested scopes (in units of ns)
+    long long self = 0;
+
+    /// The number of recorded values of the counter
+    Index samples = 0;
+
+    /// The sum of the recorded values of the counter
+    double values = 0.0;
+
+    /// Add the aggregated measurements of another instance to this one
+    auto operator+=(const ProfilerTotals& other) -> ProfilerTotals&
+    {
+        calls += other.calls;
+        total += other.total;
+        self += other.self;
+        samples += other.samples;
+        values += other.values;
+        return *this;
+    }
+};
+
+/// A buffer that keeps the most recent items once its capacity is reached
+template<typename T>
+struct ProfilerRing
+{
+    /// The items in the buffer
+    std::vector<T> items;
+
+    /// The position of the oldest item in the buffer
+    Index oldest = 0;
+
+    /// Add an item to the buffer, replacing the oldest one if the buffer has reached its capacity
+    auto push(const T& item, Index capacity) -> void
+    {
+        if(items.size() < capacity)
+            items.push_back(item);
+        else if(items.size())
+        {
+            items[oldest] = item;
+            oldest = (oldest + 1) % items.size();
+        }
+    }
+
+    /// Apply a function to the items in the buffer from the oldest to the most recent
+    template<typename Function>
+    auto forEach(Function f) const -> void
+    {
+        for(Index i = 0; i < items.size(); ++i)
+            f(items[(oldest + i) % items.size()]);
+    }
+
+    /// Remove all items in the buffer and release its memory
+    auto clear() -> void
+    {
+        std::vector<T>().swap(items);
+        oldest = 0;
+    }
+};
+
+/// The measurements of a thread
+struct ProfilerThread
+{
+    /// The index of the thread in the order it was first profiled
+    Index index;
+
+    /// The measurements of the most recent completed scopes
+    ProfilerRing<ProfilerEvent> events;
+
+    /// The most recent recorded values of counters
+    ProfilerRing<ProfilerSample> samples;
+
+    /// The aggregated measurements of all scopes and counters (indexed by their identifiers)
+    std::vector<ProfilerTotals> totals;
+
+    /// The time spent in the nested scopes of each active scope (in units of ns)
+    std::vector<long long> nested;
+
+    /// Return the aggregated measurements of the scope or counter with given identifier
+    auto totalsOf(Index id) -> ProfilerTotals&
+    {
+        if(id >= totals.size())
+            totals.resize(id + 1);
+        return totals[id];
+    }
+};
+
+/// The global state of the profiler
+struct ProfilerRegistry
+{
+    /// The mutex that protects the names, the list of threads and the measurements of exited threads
+    std::mutex mutex;
+
+    /// The names of the scopes and counters
+    std::vector<std::string> names;
+
+    /// The identifiers of the scopes and counters
+    std::unordered_map<std::string, Index> ids;
+
+    /// The measurements of the threads that are running
+    std::vector<std::unique_ptr<ProfilerThread>> threads;
+
+    /// The number of threads that have been profiled
+    Index num_threads = 0;
+
+    /// The most recent measurements of the threads that have exited (with the indices of the threads)
+    ProfilerRing<std::pair<Index, ProfilerEvent>> retired_events;
+
+    /// The most recent recorded values of counters of the threads that have exited (with the indices of the threads)
+    ProfilerRing<std::pair<Index, ProfilerSample>> retired_samples;
+
+    /// The aggregated measurements of the threads that have exited
+    std::vector<ProfilerTotals> retired_totals;
+
+    /// The maximum number of measurements and counter values kept for the trace of each thread
+    std::atomic<Index> capacity{65536};
+
+    /// The runtime switch of the profiler
+    std::atomic<bool> enabled{true};
+
+    /// The time origin of the measurements
+    const std::chrono::steady_clock::time_point origin = std::chrono::steady_clock::now();
+};
+
+auto registry() -> ProfilerRegistry&
+{
+    static ProfilerRegistry instance;
+    return instance;
+}
+
+/// Merge the measurements of an exiting thread into the registry and release its buffers
+auto retire(ProfilerThread* thread) -> void
+{
+    auto& reg = registry();
+    std::lock_guard<std::mutex> lock(reg.mutex);
+
+    const Index capacity = reg.capacity;
+    thread->events.forEach([&](const ProfilerEvent& event) { reg.retired_events.push({thread->index, event}, capacity); });
+    thread->samples.forEach([&](const ProfilerSample& sample) { reg.retired_samples.push({thread->index, sample}, capacity); });
+
+    if(reg.retired_totals.size() < thread->totals.size())
+        reg.retired_totals.resize(thread->totals.size());
+    for(Index i = 0; i < thread->totals.size(); ++i)
+        reg.retired_totals[i] += thread->totals[i];
+
+    auto iter = std::find_if(reg.threads.begin(), reg.threads.end(),
+        [&](const std::unique_ptr<ProfilerThread>& item) { return item.get() == thread; });
+    if(iter != reg.threads.end())
+        reg.threads.erase(iter);
+}
+
+/// The owner of the measurements of a thread, which retires them when the thread exits
+struct ProfilerThreadOwner
+{
+    /// The measurements of the thread (registered in the registry)
+    ProfilerThread* thread = nullptr;
+
+    /// Destroy this ProfilerThreadOwner instance, retiring the measurements of the thread
+    ~ProfilerThreadOwner()
+    {
+        if(thread)
+            retire(thread);
+    }
+};
+
+/// Return the measurements of the calling thread, registering the thread if needed
+auto thread() -> ProfilerThread&
+{
+    thread_local ProfilerThreadOwner owner;
+    if(!owner.thread)
+    {
+        auto& reg = registry();
+        std::lock_guard<std::mutex> lock(reg.mutex);
+        reg.threads.emplace_back(new ProfilerThread());
+        reg.threads.back()->index = reg.num_threads++;
+        owner.thread = reg.threads.back().get();
+    }
+    return *owner.thread;
+}
+
+/// Return the time since the profiler's time origin (in units of ns)
+auto now() -> long long
+{
+    const auto elapsed = std::chrono::steady_clock::now() - registry().origin;
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count();
+}
+
+/// Return a string with the characters of a name escaped for JSON
+auto escaped(const std::string& name) -> std::string
+{
+    std::string res;
+    for(char c : name)
+    {
+        if(c == '"' || c == '\\') res += '\\';
+        res += c;
+    }
+    return res;
+}
+
+} // namespace
+
+auto Profiler::setEnabled(bool enabled) -> void
+{
+    registry().enabled = enabled;
+}
+
+auto Profiler::enabled() -> bool
+{
+    return registry().enabled;
+}
+
+auto Profiler::clear() -> void
+{
+    auto& reg = registry();
+    std::lock_guard<std::mutex> lock(reg.mutex);
+    for(auto& thread : reg.threads)
+    {
+        thread->events.clear();
+        thread->samples.clear();
+        thread->totals.clear();
+    }
+    reg.retired_events.clear();
+    reg.retired_samples.clear();
+    reg.retired_totals.clear();
+}
+
+auto Profiler::setCapacity(Index capacity) -> void
+{
+    registry().capacity = capacity;
+    clear();
+}
+
+auto Profiler::capacity() -> Index
+{
+    return registry().capacity;
+}
+
+auto Profiler::chromeTrace() -> std::string
+{
+    auto& reg = registry();
+    std::lock_guard<std::mutex> lock(reg.mutex);
+
+    std::stringstream ss;
+    ss << std::fixed << std::setprecision(3);
+    ss << "{\"traceEvents\":[";
+
+    bool first = true;
+    auto separator = [&]() -> std::ostream& { if(!first) ss << ","; first = false; return ss << "\n"; };
+
+    // The timestamps and durations of the Chrome trace format are in units of us
+    auto writeEvent = [&](Index tid, const ProfilerEvent& event)
+    {
+        separator() << "{\"name\":\"" << escaped(reg.names[event.id]) << "\",\"ph\":\"X\",\"pid\":0,"
+            << "\"tid\":" << tid << ",\"ts\":" << event.start * 1e-3 << ",\"dur\":" << event.duration * 1e-3 << "}";
+    };
+
+    auto writeSample = [&](Index tid, const ProfilerSample& sample)
+    {
+        separator() << "{\"name\":\"" << escaped(reg.names[sample.id]) << "\",\"ph\":\"C\",\"pid\":0,"
+            << "\"tid\":" << tid << ",\"ts\":" << sample.time * 1e-3 << ",\"args\":{\"value\":"
+            << std::setprecision(17) << sample.value << std::setprecision(3) << "}}";
+    };
+
+    reg.retired_events.forEach([&](const std::pair<Index, ProfilerEvent>& item) { writeEvent(item.first, item.second); });
+    reg.retired_samples.forEach([&](const std::pair<Index, ProfilerSample>& item) { writeSample(item.first, item.second); });
+
+    for(const auto& thread : reg.threads)
+    {
+        thread->events.forEach([&](const ProfilerEvent& event) { writeEvent(thread->index, event); });
+        thread->samples.forEach([&](const ProfilerSample& sample) { writeSample(thread->index, sample); });
+    }
+
+    ss << "\n],\"displayTimeUnit\":\"ms\"}\n";
+
+    return ss.str();
+}
+
+auto Profiler::summary() -> std::string
+{
+    auto& reg = registry();
+    std::lock_guard<std::mutex> lock(reg.mutex);
+
+    const Index num_names = reg.names.size();
+
+    // Aggregate the measurements of all threads by name
+    std::vector<ProfilerTotals> totals(reg.retired_totals);
+    totals.resize(num_names);
+    for(const auto& thread : reg.threads)
+        for(Index i = 0; i < thread->totals.size(); ++i)
+            totals[i] += thread->totals[i];
+
+    std::vector<Index> calls(num_names, 0), samples(num_names, 0);
+    std::vector<double> total(num_names, 0.0), self(num_names, 0.0), values(num_names, 0.0);
+    for(Index i = 0; i < num_names; ++i)
+    {
+        calls[i] = totals[i].calls;
+        total[i] = totals[i].total * 1e-9;
+        self[i] = totals[i].self * 1e-9;
+        samples[i] = totals[i].samples;
+        values[i] = totals[i].values;
+    }
+
+    // The total self time of all scopes, which is the total profiled time of all threads
+    double profiled = 0.0;
+    for(double t : self)
+        profiled += t;
+
+    // Order the scopes by decreasing self time
+    std::vector<Index> order;
+    for(Index i = 0; i < num_names; ++i)
+        if(calls[i]) order.push_back(i);
+    std::sort(order.begin(), order.end(), [&](Index l, Index r) { return self[l] > self[r]; });
+
+    Index width = 5;
+    for(Index i = 0; i < num_names; ++i)
+        if(calls[i] || samples[i]) width = std::max(width, reg.names[i].size());
+
+    std::stringstream ss;
+    ss << std::left << std::setw(width) << "Scope" << std::right
+       << std::setw(12) << "Calls" << std::setw(14) << "Total (s)" << std::setw(14) << "Self (s)" << std::setw(10) << "Self (%)" << "\n";
+    for(Index i : order)
+        ss << std::left << std::setw(width) << reg.names[i] << std::right
+           << std::setw(12) << calls[i]
+           << std::setw(14) << std::scientific << std::setprecision(4) << total[i]
+           << std::setw(14) << self[i]
+           << std::setw(10) << std::fixed << std::setprecision(2) << (profiled > 0.0 ? 100 * self[i]/profiled : 0.0) << "\n";
+
+    bool counters = false;
+    for(Index i = 0; i < num_names; ++i)
+    {
+        if(samples[i] == 0) continue;
+        if(!counters)
+            ss << "\n" << std::left << std::setw(width) << "Counter" << std::right
+               << std::setw(12) << "Samples" << std::setw(14) << "Total" << std::setw(14) << "Mean" << "\n";
+        counters = true;
+        ss << std::left << std::setw(width) << reg.names[i] << std::right
+           << std::setw(12) << samples[i]
+           << std::setw(14) << std::scientific << std::setprecision(4) << values[i]
+           << std::setw(14) << values[i]/samples[i] << "\n";
+    }
+
+    return ss.str();
+}
+
+auto Profiler::id(const std::string& name) -> Index
+{
+    // Look up the names already seen by the calling thread without locking
+    thread_local std::unordered_map<std::string, Index> cache;
+    const auto iter = cache.find(name);
+    if(iter != cache.end())
+        return iter->second;
+
+    auto& reg = registry();
+    std::lock_guard<std::mutex> lock(reg.mutex);
+    auto res = reg.ids.emplace(name, reg.names.size());
+    if(res.second)
+        reg.names.push_back(name);
+    cache.emplace(name, res.first->second);
+    return res.first->second;
+}
+
+auto Profiler::count(Index id, double value) -> void
+{
+    if(!registry().enabled)
+        return;
+
+    auto& current = thread();
+    current.samples.push({id, now(), value}, registry().capacity);
+
+    auto& totals = current.totalsOf(id);
+    totals.samples += 1;
+    totals.values += value;
+}
+
+ProfilerTimer::ProfilerTimer(Index id)
+: m_id(registry().enabled ? id : Index(-1)), m_start(0)
+{
+    if(m_id == Index(-1))
+        return;
+    thread().nested.push_back(0);
+    m_start = now();
+}
+
+ProfilerTimer::~ProfilerTimer()
+{
+    if(m_id == Index(-1))
+        return;
+
+    const long long duration = now() - m_start;
+
+    auto& current = thread();
+    const long long nested = current.nested.back();
+    current.nested.pop_back();
+
+    // Add the time of this scope to the nested time of the enclosing scope
+    if(current.nested.size())
+        current.nested.back() += duration;
+
+    current.events.push({m_id, m_start, duration, duration - nested}, registry().capacity);
+
+    auto& totals = current.totalsOf(m_id);
+    totals.calls += 1;
+    totals.total += duration;
+    totals.self += duration - nested;
+}
+
+} // namespace Reaktoro
@@ -0,0 +1,133 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright (C) 2014-2018 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+// C++ includes
+#include <string>
+
+// Reaktoro includes
+#include <Reaktoro/Common/Index.hpp>
+
+namespace Reaktoro {
+
+/// Provides access to the measurements of the built-in profiler.
+/// The profiler is enabled at compile time with the cmake option `-DENABLE_PROFILING=ON`,
+/// which defines the macro `ENABLE_PROFILING`. Otherwise, the macros @ref ProfilerScope,
+/// @ref ProfilerScopeNamed and @ref ProfilerCount expand to nothing and cost nothing at runtime.
+/// The measurements are collected per thread without locking, and aggregated on export.
+/// The summary accounts for all measurements, while the trace keeps only the most recent
+/// ones of each thread (see @ref setCapacity). The measurements of a thread that exits are
+/// merged into the registry, so that they are not lost and the thread's buffers are freed.
+/// ~~~{.cpp}
+/// using namespace Reaktoro;
+/// EquilibriumSolver solver(system);
+/// solver.solve(state, T, P, b);
+/// std::ofstream("trace.json") << Profiler::chromeTrace(); // open it in chrome://tracing
+/// std::cout << Profiler::summary();
+/// ~~~
+/// @note The export methods should not be called while profiled code runs in other threads.
+class Profiler
+{
+public:
+    /// Enable or disable the recording of measurements at runtime (enabled by default).
+    static auto setEnabled(bool enabled) -> void;
+
+    /// Return true if the recording of measurements is enabled at runtime.
+    static auto enabled() -> bool;
+
+    /// Discard all recorded measurements.
+    static auto clear() -> void;
+
+    /// Set the maximum number of scope measurements and counter values kept for the trace of each thread.
+    /// Once this number is reached, the oldest ones are discarded. The measurements recorded so far are discarded.
+    static auto setCapacity(Index capacity) -> void;
+
+    /// Return the maximum number of scope measurements and counter values kept for the trace of each thread.
+    static auto capacity() -> Index;
+
+    /// Return the recorded measurements in the Chrome trace event JSON format.
+    /// The result can be loaded in `chrome://tracing` or https://ui.perfetto.dev.
+    static auto chromeTrace() -> std::string;
+
+    /// Return a table with the number of calls, total time and self time of each
+    /// profiled scope, and the number of samples, total and mean value of each counter.
+    static auto summary() -> std::string;
+
+    /// Return the identifier of a scope or counter name, registering it if needed.
+    static auto id(const std::string& name) -> Index;
+
+    /// Record the value of a counter in the calling thread.
+    static auto count(Index id, double value) -> void;
+};
+
+/// A scoped timer that records the time between its construction and destruction.
+/// Use it through the macros @ref ProfilerScope and @ref ProfilerScopeNamed.
+class ProfilerTimer
+{
+public:
+    /// Construct a ProfilerTimer instance that starts measuring the scope with given identifier.
+    explicit ProfilerTimer(Index id);
+
+    /// Destroy this ProfilerTimer instance, recording the elapsed time.
+    ~ProfilerTimer();
+
+    // The timer can be neither copied nor moved
+    ProfilerTimer(const ProfilerTimer&) = delete;
+    auto operator=(const ProfilerTimer&) -> ProfilerTimer& = delete;
+
+private:
+    /// The identifier of the scope, or Index(-1) if the profiler was disabled at construction
+    Index m_id;
+
+    /// The time at construction (in units of ns since the profiler's time origin)
+    long long m_start;
+};
+
+#define ReaktoroProfilerConcatImpl(a, b) a##b
+#define ReaktoroProfilerConcat(a, b) ReaktoroProfilerConcatImpl(a, b)
+
+#ifdef ENABLE_PROFILING
+
+/// Define a macro to measure the time spent in the current scope, with a fixed name.
+/// @ingroup Common
+#define ProfilerScope(name) \
+    static const Reaktoro::Index ReaktoroProfilerConcat(reaktoro_profiler_id_, __LINE__) = Reaktoro::Profiler::id(name); \
+    Reaktoro::ProfilerTimer ReaktoroProfilerConcat(reaktoro_profiler_timer_, __LINE__)(ReaktoroProfilerConcat(reaktoro_profiler_id_, __LINE__));
+
+/// Define a macro to measure the time spent in the current scope, with a name known only at runtime.
+/// @ingroup Common
+#define ProfilerScopeNamed(name) \
+    Reaktoro::ProfilerTimer ReaktoroProfilerConcat(reaktoro_profiler_timer_, __LINE__)(Reaktoro::Profiler::id(name));
+
+/// Define a macro to record the value of a counter, such as the number of iterations.
+/// @ingroup Common
+#define ProfilerCount(name, value) \
+    { \
+        static const Reaktoro::Index reaktoro_profiler_id = Reaktoro::Profiler::id(name); \
+        Reaktoro::Profiler::count(reaktoro_profiler_id, value); \
+    }
+
+#else
+
+#define ProfilerScope(name)
+#define ProfilerScopeNamed(name)
+#define ProfilerCount(name, value)
+
+#endif
+
+} // namespace Reaktoro
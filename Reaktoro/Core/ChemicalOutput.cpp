@@ -18,13 +18,21 @@
 #include "ChemicalOutput.hpp"
 
 // C++ includes
+#include <condition_variable>
+#include <deque>
 #include <fstream>
 #include <iomanip>
 #include <iostream>
 #include <cmath>
+#include <limits>
+#include <mutex>
+#include <thread>
 
 // Reaktoro includes
+#include <Reaktoro/Common/BinaryUtils.hpp>
 #include <Reaktoro/Common/Exception.hpp>
+#include <Reaktoro/Common/MemoryMappedFile.hpp>
+#include <Reaktoro/Common/SetUtils.hpp>
 #include <Reaktoro/Common/StringList.hpp>
 #include <Reaktoro/Common/StringUtils.hpp>
 #include <Reaktoro/Common/Units.hpp>
@@ -35,6 +43,19 @@
 
 namespace Reaktoro {
 
+namespace {
+
+/// The identifier written at the beginning of binary output files
+const std::string chemical_output_magic = "REAKTORO-CHEMICAL-OUTPUT";
+
+/// The version of the binary format of output files
+const std::uint32_t chemical_output_version = 1;
+
+/// The maximum number of blocks of binary output waiting to be written
+const std::size_t max_pending_blocks = 2;
+
+} // namespace
+
 struct ChemicalOutput::Impl
 {
     /// The chemical system instance
@@ -46,6 +67,12 @@ struct ChemicalOutput::Impl
     /// The chemical quantity instance
     ChemicalQuantity quantity;
 
+    /// The plan that evaluates the quantities to be output, created when the output is opened
+    ChemicalQuantityPlan plan;
+
+    /// The values of the quantities to be output at the current update
+    Vector values;
+
     /// The flag that indicates if output should be done at the terminal.
     bool terminal = false;
 
@@ -73,6 +100,9 @@ struct ChemicalOutput::Impl
     /// The flag that indicates if scientific format should be used.
     bool scientific = false;
 
+    /// The format of the output file.
+    ChemicalOutputFormat format = ChemicalOutputFormat::Text;
+
     /// The output stream of the data file.
     std::ofstream datafile;
 
@@ -88,6 +118,38 @@ struct ChemicalOutput::Impl
     /// The spacings between the columns
     std::vector<int> spacings;
 
+    /// The number of rows in each block of the binary output formats.
+    Index blocksize = 4096;
+
+    /// The block of rows being filled with values, one column per heading.
+    Matrix block;
+
+    /// The number of completed rows in the current block.
+    Index numrows = 0;
+
+    /// The flag that indicates if the current row of the block has been started by an update.
+    bool rowopen = false;
+
+    /// The blocks waiting to be written by the writer thread, with their number of rows.
+    std::deque<std::pair<Matrix, Index>> pending;
+
+    /// The thread that writes the blocks of the binary output formats to the data file.
+    /// It is started when a binary output file is first opened and kept alive until this
+    /// instance is destroyed, so that files opened and closed repeatedly reuse it.
+    std::thread writer;
+
+    /// The mutex that protects the blocks waiting to be written.
+    std::mutex mutex;
+
+    /// The condition variable that signals changes in the blocks waiting to be written.
+    std::condition_variable condition;
+
+    /// The flag that indicates if the writer thread is writing a block to the data file.
+    bool writing = false;
+
+    /// The flag that indicates that the writer thread should terminate.
+    bool finished = false;
+
     Impl()
     {}
 
@@ -102,6 +164,22 @@ struct ChemicalOutput::Impl
     ~Impl()
     {
         close();
+
+        // Terminate the writer thread
+        if(writer.joinable())
+        {
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                finished = true;
+            }
+            condition.notify_all();
+            writer.join();
+        }
+    }
+
+    auto binary() const -> bool
+    {
+        return format != ChemicalOutputFormat::Text;
     }
 
     auto spacing(std::string word) const -> std::size_t
@@ -123,9 +201,20 @@ struct ChemicalOutput::Impl
         if(headings.empty())
             headings = data;
 
+        // Resolve the quantities to be output only once, with the iteration number evaluated separately
+        std::vector<std::string> words = data;
+        for(auto& word : words)
+            if(word == "i") word = "tag";
+        plan = ChemicalQuantityPlan(quantity, words);
+        values.resize(words.size());
+
         // Open the data file
         if(!filename.empty())
-            datafile.open(filename, std::ofstream::out | std::ofstream::trunc);
+        {
+            auto mode = std::ofstream::out | std::ofstream::trunc;
+            if(binary()) mode |= std::ofstream::binary;
+            datafile.open(filename, mode);
+        }
 
         // Check if scientific format should be used
         if(scientific)
@@ -139,12 +228,29 @@ struct ChemicalOutput::Impl
         for(auto word : headings)
             spacings.push_back(spacing(word));
 
+        // Output the header of the binary data file and start the thread that writes its blocks
+        if(binary() && datafile.is_open())
+        {
+            writeBinary(datafile, chemical_output_magic);
+            writeBinary(datafile, chemical_output_version);
+            writeBinary(datafile, static_cast<std::uint8_t>(format == ChemicalOutputFormat::Binary32 ? 4 : 8));
+            writeBinary(datafile, static_cast<std::uint64_t>(headings.size()));
+            for(auto word : headings)
+                writeBinary(datafile, word);
+
+            block.resize(blocksize, headings.size());
+            numrows = 0;
+            rowopen = false;
+            if(!writer.joinable())
+                writer = std::thread([this]() { write(); });
+        }
+
         // Output the header of the data file
         icolumn = 0;
         for(auto word : headings)
         {
             auto space = spacings[icolumn];
-            if(datafile.is_open()) datafile << std::left << std::setw(space) << word;
+            if(datafile.is_open() && !binary()) datafile << std::left << std::setw(space) << word;
             if(terminal)
             {
                 std::ios::fmtflags flags(std::cout.flags());
@@ -159,25 +265,100 @@ struct ChemicalOutput::Impl
 
     auto close() -> void
     {
+        // Submit the last rows to the writer thread and wait until all blocks are written
+        if(binary() && datafile.is_open())
+        {
+            if(rowopen) commit();
+            if(numrows) submit();
+            std::unique_lock<std::mutex> lock(mutex);
+            condition.wait(lock, [&]() { return pending.empty() && !writing; });
+        }
+
         datafile.close();
     }
 
+    /// Complete the current row of the block, submitting the block to the writer thread if it is full.
+    auto commit() -> void
+    {
+        rowopen = false;
+        if(++numrows == blocksize)
+            submit();
+    }
+
+    /// Submit the current block to the writer thread, waiting if too many blocks are still to be written.
+    auto submit() -> void
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        condition.wait(lock, [&]() { return pending.size() < max_pending_blocks; });
+        pending.emplace_back(std::move(block), numrows);
+        lock.unlock();
+        condition.notify_all();
+        block.resize(blocksize, headings.size());
+        numrows = 0;
+    }
+
+    /// Write the submitted blocks to the data file until this instance is destroyed (executed by the writer thread).
+    auto write() -> void
+    {
+        std::vector<float> values;
+        std::pair<Matrix, Index> item;
+        while(true)
+        {
+            {
+                std::unique_lock<std::mutex> lock(mutex);
+                writing = false;
+                condition.notify_all();
+                condition.wait(lock, [&]() { return !pending.empty() || finished; });
+                if(pending.empty())
+                    return;
+                item = std::move(pending.front());
+                pending.pop_front();
+                writing = true;
+            }
+            condition.notify_all();
+
+            const Matrix& values64 = item.first;
+            const Index rows = item.second;
+            writeBinary(datafile, static_cast<std::uint64_t>(rows));
+            for(Index j = 0; j < Index(values64.cols()); ++j)
+            {
+                if(format == ChemicalOutputFormat::Binary64)
+                    datafile.write(reinterpret_cast<const char*>(values64.col(j).data()), rows * sizeof(double));
+                else
+                {
+                    values.assign(values64.col(j).data(), values64.col(j).data() + rows);
+                    datafile.write(reinterpret_cast<const char*>(values.data()), rows * sizeof(float));
+                }
+            }
+        }
+    }
+
     auto update(const ChemicalState& state, double t) -> void
     {
-        // Output values on a new line
-        if(datafile.is_open()) datafile << std::endl;
+        const bool binaryfile = binary() && datafile.is_open();
+        const bool textfile = !binary() && datafile.is_open();
+
+        // Output values on a new line or a new row of the binary block
+        if(binaryfile)
+        {
+            if(rowopen) commit();
+            block.row(numrows).fill(std::numeric_limits<double>::quiet_NaN());
+            rowopen = true;
+        }
+        if(textfile) datafile << '\n';
         if(terminal) std::cout << std::endl;
 
         // Output the current chemical state to the data file.
-        quantity.update(state, t);
+        plan.evaluate(state, t, values);
 
         // For each quantity, ouput its value on each column
         icolumn = 0;
-        for(auto word : data)
+        for(const auto& word : data)
         {
             auto space = spacings[icolumn];
-            auto val = (word == "i") ? iteration : quantity.value(word);
-            if(datafile.is_open()) datafile << std::left << std::setw(space) << val;
+            auto val = (word == "i") ? iteration : values[icolumn];
+            if(binaryfile) block(numrows, icolumn) = val;
+            if(textfile) datafile << std::left << std::setw(space) << val;
             if(terminal) std::cout << std::left << std::setw(space) << val;
             ++icolumn;
         }
@@ -190,10 +371,25 @@ struct ChemicalOutput::Impl
     auto attach(ValueType value) -> void
     {
         auto space = spacings[icolumn];
-        if(datafile.is_open()) datafile << std::left << std::setw(space) << value;
+        if(binary() && datafile.is_open()) block(numrows, icolumn) = binaryValue(value);
+        if(datafile.is_open() && !binary()) datafile << std::left << std::setw(space) << value;
         if(terminal) std::cout << std::left << std::setw(space) << value;
         ++icolumn;
     }
+
+    /// Return the value of an attachment to be written in the binary output formats.
+    auto binaryValue(double value) const -> double
+    {
+        return value;
+    }
+
+    /// Return the value of a text attachment to be written in the binary output formats.
+    auto binaryValue(std::string value) const -> double
+    {
+        RuntimeError("Cannot attach the value `" + value + "` to the output.",
+            "Text values cannot be written in the binary output formats.");
+        return 0.0;
+    }
 };
 
 ChemicalOutput::ChemicalOutput()
@@ -291,6 +487,21 @@ auto ChemicalOutput::terminal(bool enabled) -> void
     pimpl->terminal = enabled;
 }
 
+auto ChemicalOutput::format(ChemicalOutputFormat format) -> void
+{
+    pimpl->format = format;
+}
+
+auto ChemicalOutput::format() const -> ChemicalOutputFormat
+{
+    return pimpl->format;
+}
+
+auto ChemicalOutput::blockSize(unsigned rows) -> void
+{
+    pimpl->blocksize = std::max(rows, 1u);
+}
+
 auto ChemicalOutput::quantities() const -> std::vector<std::string>
 {
     return pimpl->data;
@@ -321,4 +532,124 @@ ChemicalOutput::operator bool() const
     return pimpl->terminal || pimpl->filename.size();
 }
 
+ChemicalOutputReader::ChemicalOutputReader()
+{}
+
+ChemicalOutputReader::ChemicalOutputReader(std::string filename)
+{
+    read(filename);
+}
+
+auto ChemicalOutputReader::read(std::string filename) -> void
+{
+    MemoryMappedFile file(filename);
+    MemoryInputStream in(file);
+
+    std::string magic;
+    std::uint32_t version = 0;
+    std::uint8_t bytes = 0;
+    std::uint64_t numcols = 0;
+
+    readBinary(in, magic);
+
+    Assert(in.good() && magic == chemical_output_magic,
+        "Could not read the output file `" << filename << "`.",
+        "The file is not a binary output file of ChemicalOutput.");
+
+    readBinary(in, version);
+
+    Assert(version == chemical_output_version,
+        "Could not read the output file `" << filename << "`.",
+        "The file has format version " << version << ", but version " << chemical_output_version << " was expected.");
+
+    readBinary(in, bytes);
+    readBinary(in, numcols);
+
+    Assert(in.good() && (bytes == 4 || bytes == 8),
+        "Could not read the output file `" << filename << "`.",
+        "The file has an invalid header.");
+
+    // Every heading is stored with at least the bytes of its length
+    Assert(numcols <= remainingBytes(in)/sizeof(std::uint64_t),
+        "Could not read the output file `" << filename << "`.",
+        "The file has " << numcols << " columns in its header, which is more than its size allows.");
+
+    m_headings.resize(numcols);
+    for(auto& word : m_headings)
+        readBinary(in, word);
+
+    // Read the blocks of rows until the end of the file
+    std::vector<Matrix> blocks;
+    std::vector<float> values;
+    Index numrows = 0;
+    while(in.good() && in.peek() != std::char_traits<char>::eof())
+    {
+        std::uint64_t rows = 0;
+        readBinary(in, rows);
+        if(!in.good())
+            break;
+        Assert(numcols == 0 || rows <= remainingBytes(in)/(numcols*bytes),
+            "Could not read the output file `" << filename << "`.",
+            "The file has a block of " << rows << " rows, which is more than its size allows.");
+        Matrix block(rows, numcols);
+        for(Index j = 0; j < numcols; ++j)
+        {
+            if(bytes == 8)
+                in.read(reinterpret_cast<char*>(block.col(j).data()), rows * sizeof(double));
+            else
+            {
+                values.resize(rows);
+                in.read(reinterpret_cast<char*>(values.data()), rows * sizeof(float));
+                for(Index i = 0; i < rows; ++i)
+                    block(i, j) = values[i];
+            }
+        }
+        numrows += rows;
+        blocks.push_back(std::move(block));
+    }
+
+    Assert(!in.fail(), "Could not read the output file `" << filename << "`.",
+        "The file is truncated or corrupted.");
+
+    m_values.resize(numrows, numcols);
+    Index offset = 0;
+    for(const auto& block : blocks)
+    {
+        m_values.middleRows(offset, block.rows()) = block;
+        offset += block.rows();
+    }
+}
+
+auto ChemicalOutputReader::column(std::string heading) const -> Vector
+{
+    const Index icol = index(heading, m_headings);
+    Assert(icol < m_headings.size(), "Cannot get the values of the column `" << heading << "`.",
+        "There is no column with this heading in the output file.");
+    return m_values.col(icol);
+}
+
+auto ChemicalOutputReader::csv(std::string filename, int precision) const -> void
+{
+    std::ofstream out(filename, std::ofstream::out | std::ofstream::trunc);
+
+    Assert(out.is_open(), "Could not write the output to file `" << filename << "`.",
+        "The file could not be opened for writing.");
+
+    out << std::setprecision(precision);
+
+    for(Index j = 0; j < m_headings.size(); ++j)
+        out << (j ? "," : "") << m_headings[j];
+    out << '\n';
+
+    for(Index i = 0; i < Index(m_values.rows()); ++i)
+    {
+        for(Index j = 0; j < Index(m_values.cols()); ++j)
+            out << (j ? "," : "") << m_values(i, j);
+        out << '\n';
+    }
+
+    Assert(out.good(), "Could not write the output to file `" << filename << "`.",
+        "An error occurred while writing to the file.");
+}
+
 } // namespace Reaktoro
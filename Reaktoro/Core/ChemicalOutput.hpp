@@ -23,6 +23,9 @@
 #include <sstream>
 #include <string>
 
+// Reaktoro includes
+#include <Reaktoro/Math/Matrix.hpp>
+
 namespace Reaktoro {
 
 // Forward declarations
@@ -31,7 +34,25 @@ class ChemicalSystem;
 class ReactionSystem;
 class StringList;
 
+/// The formats of the output files written by ChemicalOutput.
+enum class ChemicalOutputFormat
+{
+    /// The values are written as text in aligned columns, one line per update.
+    Text,
+
+    /// The values are written as blocks of binary columns of double-precision numbers.
+    Binary64,
+
+    /// The values are written as blocks of binary columns of single-precision numbers.
+    Binary32,
+};
+
 /// A type used to output sequence of chemical states to a file or terminal.
+/// In the binary formats, the file starts with a header with the headings of the columns,
+/// followed by blocks of rows, with the values of each column stored contiguously in each block.
+/// The blocks are written to the file by a background thread, so that the calculations
+/// proceed while previous blocks are written. Use @ref ChemicalOutputReader to read
+/// these files.
 class ChemicalOutput
 {
 public:
@@ -95,6 +116,17 @@ public:
     /// Enable or disable the output to the terminal.
     auto terminal(bool enabled) -> void;
 
+    /// Set the format of the output file (the default is ChemicalOutputFormat::Text).
+    auto format(ChemicalOutputFormat format) -> void;
+
+    /// Return the format of the output file.
+    auto format() const -> ChemicalOutputFormat;
+
+    /// Set the number of rows in each block of the binary output formats.
+    /// At most two blocks are kept in memory waiting to be written, so that this
+    /// number bounds the memory used by the output (the default is 4096).
+    auto blockSize(unsigned rows) -> void;
+
     /// Return the name of the quantities in the output file.
     auto quantities() const -> std::vector<std::string>;
 
@@ -108,6 +140,7 @@ public:
     auto update(const ChemicalState& state, double t) -> void;
 
     /// Close the output file.
+    /// In the binary formats, this waits until all values have been written to the file.
     auto close() -> void;
 
     /// Convert this ChemicalOutput instance to bool.
@@ -119,4 +152,39 @@ private:
     std::shared_ptr<Impl> pimpl;
 };
 
+/// A type used to read the output files written by ChemicalOutput in binary formats.
+class ChemicalOutputReader
+{
+public:
+    /// Construct a default ChemicalOutputReader instance.
+    ChemicalOutputReader();
+
+    /// Construct a ChemicalOutputReader instance with the contents of a binary output file.
+    explicit ChemicalOutputReader(std::string filename);
+
+    /// Read the contents of a binary output file.
+    auto read(std::string filename) -> void;
+
+    /// Return the headings of the columns in the output file.
+    auto headings() const -> const std::vector<std::string>& { return m_headings; }
+
+    /// Return the values in the output file, one row per update and one column per heading.
+    auto values() const -> MatrixConstRef { return m_values; }
+
+    /// Return the values of a column in the output file with given heading.
+    auto column(std::string heading) const -> Vector;
+
+    /// Write the contents of the output file to a file with comma-separated values.
+    /// @param filename The name of the CSV file
+    /// @param precision The number of significant digits of the values
+    auto csv(std::string filename, int precision = 17) const -> void;
+
+private:
+    /// The headings of the columns in the output file.
+    std::vector<std::string> m_headings;
+
+    /// The values in the output file, one row per update and one column per heading.
+    Matrix m_values;
+};
+
 } // namespace Reaktoro
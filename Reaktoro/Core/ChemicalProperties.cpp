@@ -59,6 +59,29 @@ auto ChemicalProperties::update(VectorConstRef n_) -> void
     }
 }
 
+auto ChemicalProperties::update(VectorConstRef n_, const Indices& iphases) -> void
+{
+    // Use the chemical model of the system if a phase has none of its own
+    for(const Phase& phase : system.phases())
+        if(!phase.chemicalModel())
+            return update(n_);
+
+    n = n_;
+    for(Index iphase : iphases)
+    {
+        const auto offset = system.indexFirstSpeciesInPhase(iphase);
+        const auto size = system.numSpeciesInPhase(iphase);
+        const auto np = rows(n, offset, size);
+        auto cp = cres.phaseProperties(iphase, offset, size);
+        system.phase(iphase).properties(cp, T, P, np);
+
+        // Update the mole fractions of the phase
+        const auto npc = Composition(np);
+        auto xp = rows(x, offset, offset, size, size);
+        xp = npc/sum(npc);
+    }
+}
+
 auto ChemicalProperties::update(double T, double P, VectorConstRef n) -> void
 {
     update(T, P);
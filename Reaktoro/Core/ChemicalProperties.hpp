@@ -47,6 +47,14 @@ public:
     /// @param n The amounts of the species in the system (in units of mol)
     auto update(VectorConstRef n) -> void;
 
+    /// Update the chemical properties of only some phases of the chemical system.
+    /// The properties of the other phases are kept from their last update. This
+    /// requires every phase to have its own chemical model, which is the case for
+    /// systems created with ChemicalEditor. Otherwise, all phases are updated.
+    /// @param n The amounts of the species in the system (in units of mol)
+    /// @param iphases The indices of the phases to be updated
+    auto update(VectorConstRef n, const Indices& iphases) -> void;
+
     /// Update the thermodynamic and chemical properties of the chemical system.
     /// @param T The temperature in the system (in units of K)
     /// @param P The pressure in the system (in units of Pa)
@@ -18,6 +18,7 @@
 #include "ChemicalQuantity.hpp"
 
 // C++ includes
+#include <limits>
 #include <map>
 
 // Reaktoro includes
@@ -31,6 +32,7 @@
 #include <Reaktoro/Core/ChemicalProperties.hpp>
 #include <Reaktoro/Core/ChemicalProperty.hpp>
 #include <Reaktoro/Core/ReactionSystem.hpp>
+#include <Reaktoro/Core/Utils.hpp>
 #include <Reaktoro/Thermodynamics/Water/WaterConstants.hpp>
 
 namespace Reaktoro {
@@ -174,6 +176,15 @@ struct ChemicalQuantity::Impl
     /// The rates of the reactions in the chemical system (in units of mol/s).
     ChemicalVector rates;
 
+    /// The flag that indicates if the chemical properties correspond to the current chemical state.
+    bool properties_updated = false;
+
+    /// The flag that indicates if the reaction rates correspond to the current chemical state.
+    bool rates_updated = false;
+
+    /// The temperature and pressure at which the thermodynamic model was last evaluated.
+    double Tthermo = std::numeric_limits<double>::quiet_NaN(), Pthermo = std::numeric_limits<double>::quiet_NaN();
+
     /// All created chemical quantity functions from formatted strings
     std::map<std::string, Function> function_map;
 
@@ -183,13 +194,13 @@ struct ChemicalQuantity::Impl
 
     /// Construct a custom Impl instance with given ChemicalSystem object
     Impl(const ChemicalSystem& system)
-    : system(system)
+    : system(system), properties(system)
     {
     }
 
     /// Construct a custom Impl instance with given ReactionSystem object
     Impl(const ReactionSystem& reactions)
-    : system(reactions.system()), reactions(reactions)
+    : system(reactions.system()), reactions(reactions), properties(reactions.system())
     {
     }
 
@@ -214,12 +225,39 @@ struct ChemicalQuantity::Impl
         P = state.pressure();
         n = state.speciesAmounts();
 
-        // Update the thermodynamic properties of the system
-        properties = system.properties(T, P, n);
+        // The properties and rates are evaluated only when a quantity needs them
+        properties_updated = false;
+        rates_updated = false;
+    }
 
-        // Update the rates of the reactions
-        if(!reactions.reactions().empty())
-            rates = reactions.rates(properties);
+    /// Return the chemical properties of the current chemical state, evaluating them if needed
+    auto updatedProperties() -> const ChemicalProperties&
+    {
+        if(!properties_updated)
+        {
+            // Evaluate the thermodynamic model only if temperature or pressure changed since its last evaluation
+            if(T != Tthermo || P != Pthermo)
+            {
+                properties.update(T, P);
+                Tthermo = T;
+                Pthermo = P;
+            }
+            properties.update(n);
+            properties_updated = true;
+        }
+        return properties;
+    }
+
+    /// Return the rates of the reactions at the current chemical state, evaluating them if needed
+    auto updatedRates() -> const ChemicalVector&
+    {
+        if(!rates_updated)
+        {
+            if(!reactions.reactions().empty())
+                rates = reactions.rates(updatedProperties());
+            rates_updated = true;
+        }
+        return rates;
     }
 
     auto function(const ChemicalQuantity& quantity, std::string str) -> const Function&
@@ -287,12 +325,12 @@ auto ChemicalQuantity::state() const -> const ChemicalState&
 
 auto ChemicalQuantity::properties() const -> const ChemicalProperties&
 {
-    return pimpl->properties;
+    return pimpl->updatedProperties();
 }
 
 auto ChemicalQuantity::rates() const -> const ChemicalVector&
 {
-    return pimpl->rates;
+    return pimpl->updatedRates();
 }
 
 auto ChemicalQuantity::tag() const -> double
@@ -327,6 +365,34 @@ auto ChemicalQuantity::operator()(std::string str) const -> double
     return value(str);
 }
 
+ChemicalQuantityPlan::ChemicalQuantityPlan()
+{}
+
+ChemicalQuantityPlan::ChemicalQuantityPlan(const ChemicalSystem& system, const std::vector<std::string>& quantities)
+: ChemicalQuantityPlan(ChemicalQuantity(system), quantities)
+{}
+
+ChemicalQuantityPlan::ChemicalQuantityPlan(const ChemicalQuantity& quantity, const std::vector<std::string>& quantities)
+: m_quantity(quantity), m_quantities(quantities)
+{
+    m_functions.reserve(quantities.size());
+    for(const auto& str : quantities)
+        m_functions.push_back(m_quantity.function(str));
+}
+
+auto ChemicalQuantityPlan::evaluate(const ChemicalState& state, double t, VectorRef values) -> void
+{
+    Assert(values.rows() == static_cast<long>(m_functions.size()),
+        "Cannot evaluate the chemical quantities in the plan.",
+        "The size of the vector of values differs from the number of quantities.");
+
+    // The update only stores the state, and the first quantity that needs properties triggers their evaluation
+    m_quantity.update(state, t);
+
+    for(Index i = 0; i < m_functions.size(); ++i)
+        values[i] = m_functions[i]();
+}
+
 namespace quantity {
 
 /// A type used to describe the list of arguments for quantity querying.
@@ -698,8 +764,8 @@ auto phaseAmount(const ChemicalQuantity& quantity, std::string arguments) -> std
     const double factor = units::convert(1.0, "mol", units);
     auto func = [=]() -> double
     {
-        const ChemicalProperties& properties = quantity.properties();
-        const double val = properties.phaseAmounts().val[iphase];
+        const ChemicalState& state = quantity.state();
+        const double val = state.phaseAmount(iphase);
         return factor * val;
     };
     return func;
@@ -711,12 +777,15 @@ auto phaseMass(const ChemicalQuantity& quantity, std::string arguments) -> std::
     const ChemicalSystem& system = quantity.system();
     const std::string phase = args.argument(0);
     const Index iphase = system.indexPhaseWithError(phase);
+    const Index ifirst = system.indexFirstSpeciesInPhase(iphase);
+    const Index size = system.numSpeciesInPhase(iphase);
+    const Vector molar_masses = molarMasses(system.species()).segment(ifirst, size);
     const std::string units = args.argument("units", "kg");
     const double factor = units::convert(1.0, "kg", units);
     auto func = [=]() -> double
     {
-        const ChemicalProperties& properties = quantity.properties();
-        const double val = properties.phaseMasses().val[iphase];
+        const ChemicalState& state = quantity.state();
+        const double val = molar_masses.dot(state.speciesAmounts().segment(ifirst, size));
         return factor * val;
     };
     return func;
@@ -18,12 +18,15 @@
 #pragma once
 
 // C++ includes
+#include <functional>
 #include <memory>
 #include <string>
+#include <vector>
 
 // Reaktoro includes
 #include <Reaktoro/Common/Index.hpp>
 #include <Reaktoro/Common/ChemicalVector.hpp>
+#include <Reaktoro/Math/Matrix.hpp>
 
 namespace Reaktoro {
 
@@ -154,4 +157,52 @@ private:
     std::shared_ptr<Impl> pimpl;
 };
 
+/// A class that evaluates a fixed list of chemical quantities for many chemical states.
+/// The formatted strings of the quantities are parsed and their names resolved to indices
+/// only once, at construction. The chemical properties of a state are evaluated only if
+/// a quantity in the list needs them (e.g., not for amounts of species and elements), and
+/// the thermodynamic model is evaluated again only if temperature or pressure changed.
+///
+/// ~~~
+/// ChemicalQuantityPlan plan(system, {"pH", "speciesMolality(Ca++)", "elementAmount(C)"});
+///
+/// Matrix values(plan.size(), field.size());
+/// field.evaluate(plan, values);
+/// ~~~
+class ChemicalQuantityPlan
+{
+public:
+    /// Construct a default ChemicalQuantityPlan instance.
+    ChemicalQuantityPlan();
+
+    /// Construct a ChemicalQuantityPlan instance for the quantities of a chemical system.
+    ChemicalQuantityPlan(const ChemicalSystem& system, const std::vector<std::string>& quantities);
+
+    /// Construct a ChemicalQuantityPlan instance with the quantities of a ChemicalQuantity object.
+    /// The plan shares the ChemicalQuantity object, so that it can also evaluate the rates of its reactions.
+    ChemicalQuantityPlan(const ChemicalQuantity& quantity, const std::vector<std::string>& quantities);
+
+    /// Return the number of quantities in the plan.
+    auto size() const -> Index { return m_quantities.size(); }
+
+    /// Return the formatted strings of the quantities in the plan.
+    auto quantities() const -> const std::vector<std::string>& { return m_quantities; }
+
+    /// Evaluate the quantities in the plan at a chemical state.
+    /// @param state The chemical state
+    /// @param t The tag variable of the chemical state (e.g., time)
+    /// @param values The values of the quantities in the order of the plan
+    auto evaluate(const ChemicalState& state, double t, VectorRef values) -> void;
+
+private:
+    /// The chemical quantity instance with the state at which the quantities are evaluated.
+    ChemicalQuantity m_quantity;
+
+    /// The formatted strings of the quantities in the plan.
+    std::vector<std::string> m_quantities;
+
+    /// The functions that calculate the quantities in the plan.
+    std::vector<ChemicalQuantity::Function> m_functions;
+};
+
 } // namespace Reaktoro
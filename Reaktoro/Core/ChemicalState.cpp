@@ -39,40 +39,94 @@ struct ChemicalState::Impl
     /// The chemical system instance
     ChemicalSystem system;
 
+    /// The storage of the temperature, pressure, molar amounts and dual potentials when not a view
+    Vector data;
+
+    /// The boolean flag that indicates if the data is stored externally
+    bool view = false;
+
     /// The temperature state of the chemical system (in units of K)
-    double T = 298.15;
+    double* T = nullptr;
 
     /// The pressure state of the chemical system (in units of Pa)
-    double P = 1.0e+05;
+    double* P = nullptr;
 
     /// The molar amounts of the chemical species
-    Vector n;
+    VectorMap n{nullptr, 0};
 
     /// The dual chemical potentials of the elements (in units of J/mol)
-    Vector y;
+    VectorMap y{nullptr, 0};
 
     /// The dual chemical potentials of the species (in units of J/mol)
-    Vector z;
+    VectorMap z{nullptr, 0};
 
     /// Construct a default ChemicalState::Impl instance
     Impl()
-    {}
+    {
+        allocate(0, 0);
+    }
 
     /// Construct a custom ChemicalState::Impl instance
     Impl(const ChemicalSystem& system)
     : system(system)
     {
         // Initialise the molar amounts of the species and dual potentials
-        n = zeros(system.numSpecies());
-        y = zeros(system.numElements());
-        z = zeros(system.numSpecies());
+        allocate(system.numSpecies(), system.numElements());
+    }
+
+    /// Construct a ChemicalState::Impl instance whose data is stored externally
+    Impl(const ChemicalSystem& system, double* Tptr, double* Pptr, double* nptr, double* yptr, double* zptr)
+    : system(system), view(true)
+    {
+        bind(Tptr, Pptr, nptr, yptr, zptr, system.numSpecies(), system.numElements());
+    }
+
+    /// Construct a copy of a ChemicalState::Impl instance, which always owns its data
+    Impl(const Impl& other)
+    : system(other.system)
+    {
+        allocate(other.n.size(), other.y.size());
+        assign(other);
+    }
+
+    /// Allocate the storage for the data of a chemical state with given number of species and elements
+    auto allocate(Index N, Index E) -> void
+    {
+        data = zeros(2 + 2*N + E);
+        data[0] = 298.15;
+        data[1] = 1.0e+05;
+        double* ptr = data.data();
+        bind(ptr, ptr + 1, ptr + 2, ptr + 2 + N, ptr + 2 + N + E, N, E);
+    }
+
+    /// Bind the temperature, pressure, molar amounts and dual potentials to given memory locations
+    auto bind(double* Tptr, double* Pptr, double* nptr, double* yptr, double* zptr, Index N, Index E) -> void
+    {
+        T = Tptr;
+        P = Pptr;
+        new (&n) VectorMap(nptr, N);
+        new (&y) VectorMap(yptr, E);
+        new (&z) VectorMap(zptr, N);
+    }
+
+    /// Copy the temperature, pressure, molar amounts and dual potentials of another chemical state
+    auto assign(const Impl& other) -> void
+    {
+        Assert(n.size() == other.n.size() && y.size() == other.y.size(),
+            "Could not assign a chemical state to another.",
+            "The chemical states have different number of species or elements.");
+        *T = *other.T;
+        *P = *other.P;
+        n = other.n;
+        y = other.y;
+        z = other.z;
     }
 
     auto setTemperature(double val) -> void
     {
         Assert(val > 0.0, "Cannot set temperature of the chemical "
             "state with a non-positive value.", "");
-        T = val;
+        *T = val;
     }
 
     auto setTemperature(double val, std::string units) -> void
@@ -84,7 +138,7 @@ struct ChemicalState::Impl
     {
         Assert(val > 0.0, "Cannot set pressure of the chemical "
             "state with a non-positive value.", "");
-        P = val;
+        *P = val;
     }
 
     auto setPressure(double val, std::string units) -> void
@@ -229,7 +283,7 @@ struct ChemicalState::Impl
             "The given volume is negative.");
         Assert(index < system.numPhases(), "Cannot set the volume of the phase.",
             "The given phase index is out of range.");
-        ChemicalProperties properties = system.properties(T, P, n);
+        ChemicalProperties properties = system.properties(*T, *P, n);
         const Vector v = properties.phaseVolumes().val;
         const double scalar = (v[index] != 0.0) ? volume/v[index] : 0.0;
         scaleSpeciesAmountsInPhase(index, scalar);
@@ -285,7 +339,7 @@ struct ChemicalState::Impl
     {
         Assert(volume >= 0.0, "Cannot set the volume of the chemical state.",
             "The given volume is negative.");
-        ChemicalProperties properties = system.properties(T, P, n);
+        ChemicalProperties properties = system.properties(*T, *P, n);
         const Vector v = properties.phaseVolumes().val;
         const double vtotal = sum(v);
         const double scalar = (vtotal != 0.0) ? volume/vtotal : 0.0;
@@ -416,7 +470,7 @@ struct ChemicalState::Impl
     auto properties() const -> ChemicalProperties
     {
         ChemicalProperties res(system);
-        res.update(T, P, n);
+        res.update(*T, *P, n);
         return res;
     }
 
@@ -426,7 +480,7 @@ struct ChemicalState::Impl
         // Auxiliary variables
         const double ln10 = 2.302585092994046;
         const unsigned num_phases = system.numPhases();
-        const double RT = universalGasConstant * T;
+        const double RT = universalGasConstant * (*T);
 
         // Calculate the normalized z-Lagrange multipliers for all species
         const Vector zRT = z/RT;
@@ -471,6 +525,10 @@ ChemicalState::ChemicalState(const ChemicalSystem& system)
 : pimpl(new Impl(system))
 {}
 
+ChemicalState::ChemicalState(const ChemicalSystem& system, double* T, double* P, double* n, double* y, double* z)
+: pimpl(new Impl(system, T, P, n, y, z))
+{}
+
 ChemicalState::ChemicalState(const ChemicalState& other)
 : pimpl(new Impl(*other.pimpl))
 {}
@@ -480,10 +538,18 @@ ChemicalState::~ChemicalState()
 
 auto ChemicalState::operator=(ChemicalState other) -> ChemicalState&
 {
-    pimpl = std::move(other.pimpl);
+    if(pimpl->view)
+        pimpl->assign(*other.pimpl);
+    else
+        pimpl = std::move(other.pimpl);
     return *this;
 }
 
+auto ChemicalState::isView() const -> bool
+{
+    return pimpl->view;
+}
+
 auto ChemicalState::setTemperature(double val) -> void
 {
     pimpl->setTemperature(val);
@@ -636,12 +702,12 @@ auto ChemicalState::system() const -> const ChemicalSystem&
 
 auto ChemicalState::temperature() const -> double
 {
-    return pimpl->T;
+    return *pimpl->T;
 }
 
 auto ChemicalState::pressure() const -> double
 {
-    return pimpl->P;
+    return *pimpl->P;
 }
 
 auto ChemicalState::speciesAmounts() const -> VectorConstRef
@@ -69,6 +69,20 @@ public:
     /// @param system The chemical system instance
     explicit ChemicalState(const ChemicalSystem& system);
 
+    /// Construct a ChemicalState instance that is a view of externally stored data.
+    /// The temperature, pressure, molar amounts of the species, and dual potentials of the
+    /// elements and species are read from and written to the given memory locations, which
+    /// must outlive this instance. This permits, for example, the states of all cells in a
+    /// ChemicalField to be stored in contiguous arrays. Assigning another chemical state to a
+    /// view copies its data into the external storage, while a copy of a view owns its data.
+    /// @param system The chemical system instance
+    /// @param T The pointer to the temperature (in units of K)
+    /// @param P The pointer to the pressure (in units of Pa)
+    /// @param n The pointer to the molar amounts of the species (in units of mol)
+    /// @param y The pointer to the dual potentials of the elements (in units of J/mol)
+    /// @param z The pointer to the dual potentials of the species (in units of J/mol)
+    ChemicalState(const ChemicalSystem& system, double* T, double* P, double* n, double* y, double* z);
+
     /// Construct a copy of a ChemicalState instance
     ChemicalState(const ChemicalState& other);
 
@@ -233,6 +247,9 @@ public:
     /// @param units The volume units
     auto scaleVolume(double volume, std::string units) -> void;
 
+    /// Return true if this chemical state is a view of externally stored data.
+    auto isView() const -> bool;
+
     /// Return the chemical system instance
     auto system() const -> const ChemicalSystem&;
 
@@ -23,7 +23,9 @@
 #include <set>
 
 // Reaktoro includes
+#include <Reaktoro/Common/BinaryUtils.hpp>
 #include <Reaktoro/Common/Exception.hpp>
+#include <Reaktoro/Common/Profiling.hpp>
 #include <Reaktoro/Common/SetUtils.hpp>
 #include <Reaktoro/Common/StringUtils.hpp>
 #include <Reaktoro/Core/ChemicalProperties.hpp>
@@ -94,6 +96,9 @@ struct ChemicalSystem::Impl
     /// The formula matrix of the system
     Matrix formula_matrix;
 
+    /// The formula matrix of the system in sparse storage
+    SparseMatrix formula_matrix_sparse;
+
     Impl()
     {}
 
@@ -128,18 +133,21 @@ struct ChemicalSystem::Impl
         for(unsigned i = 0; i < num_species; ++i)
             for(unsigned j = 0; j < num_elements; ++j)
                 formula_matrix(j, i) = species[i].elementCoefficient(elements[j].name());
+        formula_matrix_sparse = sparse(formula_matrix);
     }
 
     auto initializeThermoModel() -> void
     {
         thermo_model = [&](ThermoModelResult& res, double T, double P)
         {
+            ProfilerScope("ChemicalSystem::thermoModel");
             const Index num_phases = phases.size();
             Index offset = 0;
             for(Index iphase = 0; iphase < num_phases; ++iphase)
             {
                 const Index size = phases[iphase].numSpecies();
                 auto tp = res.phaseProperties(iphase, offset, size);
+                ProfilerScopeNamed("ThermoModel[" + phases[iphase].name() + "]");
                 phases[iphase].properties(tp, T, P);
                 offset += size;
             }
@@ -150,6 +158,7 @@ struct ChemicalSystem::Impl
     {
         chemical_model = [&](ChemicalModelResult& res, double T, double P, VectorConstRef n)
         {
+            ProfilerScope("ChemicalSystem::chemicalModel");
             const Index num_phases = phases.size();
             Index offset = 0;
             for(Index iphase = 0; iphase < num_phases; ++iphase)
@@ -157,6 +166,7 @@ struct ChemicalSystem::Impl
                 const Index size = phases[iphase].numSpecies();
                 const auto np = n.segment(offset, size);
                 auto cp = res.phaseProperties(iphase, offset, size);
+                ProfilerScopeNamed("ChemicalModel[" + phases[iphase].name() + "]");
                 phases[iphase].properties(cp, T, P, np);
                 offset += size;
             }
@@ -262,6 +272,11 @@ auto ChemicalSystem::formulaMatrix() const -> MatrixConstRef
     return pimpl->formula_matrix;
 }
 
+auto ChemicalSystem::formulaMatrixSparse() const -> const SparseMatrix&
+{
+    return pimpl->formula_matrix_sparse;
+}
+
 auto ChemicalSystem::indexElement(std::string name) const -> Index
 {
     return index(name, elements());
@@ -443,26 +458,28 @@ auto ChemicalSystem::indicesSolidSpecies() const -> Indices
 
 auto ChemicalSystem::elementAmounts(VectorConstRef n) const -> Vector
 {
-    MatrixConstRef W = formulaMatrix();
-    return W * n;
+    const SparseMatrix& W = formulaMatrixSparse();
+    Vector b(W.rows());
+    multiply(W, n, b);
+    return b;
 }
 
 auto ChemicalSystem::elementAmountsInPhase(Index iphase, VectorConstRef n) const -> Vector
 {
-    MatrixConstRef W = formulaMatrix();
+    const SparseMatrix& W = formulaMatrixSparse();
     const unsigned first = indexFirstSpeciesInPhase(iphase);
     const unsigned size = numSpeciesInPhase(iphase);
-    const auto Wp = cols(W, first, size);
     const auto np = rows(n, first, size);
-    return Wp * np;
+    Vector b(W.rows());
+    multiplyColumns(W, first, size, np, b);
+    return b;
 }
 
 auto ChemicalSystem::elementAmountsInSpecies(const Indices& ispecies, VectorConstRef n) const -> Vector
 {
-    MatrixConstRef W = formulaMatrix();
-    Vector b = zeros(W.rows());
-    for(Index i : ispecies)
-        b += W.col(i) * n[i];
+    const SparseMatrix& W = formulaMatrixSparse();
+    Vector b(W.rows());
+    multiplyColumns(W, ispecies, n, b);
     return b;
 }
 
@@ -566,4 +583,44 @@ auto operator<<(std::ostream& out, const ChemicalSystem& system) -> std::ostream
     return out;
 }
 
+auto fingerprint(const ChemicalSystem& system) -> std::uint64_t
+{
+    // Hash a vector of doubles after rounding them to single precision, so
+    // that round-off differences between builds do not change the fingerprint
+    auto hashValues = [](VectorConstRef values, std::uint64_t hash)
+    {
+        for(Index i = 0; i < values.size(); ++i)
+        {
+            const float value = static_cast<float>(values[i]);
+            hash = hashBytes(&value, sizeof(float), hash);
+        }
+        return hash;
+    };
+
+    std::uint64_t hash = hashString("Elements");
+    for(const Element& element : system.elements())
+        hash = hashString(element.name(), hash);
+
+    hash = hashString("Phases", hash);
+    for(const Phase& phase : system.phases())
+    {
+        hash = hashString(phase.name(), hash);
+        for(const Species& species : phase.species())
+            hash = hashString(species.name(), hash);
+    }
+
+    const Matrix A = system.formulaMatrix();
+    hash = hashValues(Eigen::Map<const Vector>(A.data(), A.size()), hash);
+
+    const double T = 298.15;
+    const double P = 1.0e5;
+    const Vector n = ones(system.numSpecies());
+    const ChemicalProperties properties = system.properties(T, P, n);
+
+    hash = hashValues(properties.standardPartialMolarGibbsEnergies().val, hash);
+    hash = hashValues(properties.lnActivityCoefficients().val, hash);
+
+    return hash;
+}
+
 } // namespace Reaktoro
@@ -17,8 +17,12 @@
 
 #pragma once
 
+// C++ includes
+#include <cstdint>
+
 // Reaktoro includes
 #include <Reaktoro/Math/Matrix.hpp>
+#include <Reaktoro/Math/SparseMatrix.hpp>
 #include <Reaktoro/Core/Element.hpp>
 #include <Reaktoro/Core/Species.hpp>
 #include <Reaktoro/Core/Phase.hpp>
@@ -82,6 +86,13 @@ public:
     /// is given by the number of atoms of its `j`-th element in its `i`-th species.
     auto formulaMatrix() const -> MatrixConstRef;
 
+    /// Return the formula matrix of the system in compressed sparse column storage.
+    /// Since a species is typically composed of only a few elements, products with this
+    /// matrix (e.g., when computing the amounts of elements) are much cheaper than
+    /// with the dense formula matrix.
+    /// @see formulaMatrix
+    auto formulaMatrixSparse() const -> const SparseMatrix&;
+
     /// Return an element of the system
     /// @param index The index of the element
     auto element(Index index) const -> const Element&;
@@ -242,4 +253,11 @@ private:
 /// Output a ChemicalSystem instance
 auto operator<<(std::ostream& out, const ChemicalSystem& system) -> std::ostream&;
 
+/// Return a fingerprint that identifies the elements, species, phases and models of a chemical system.
+/// The thermodynamic and chemical models are identified by evaluating them at a reference condition
+/// (25 °C, 1 bar and unit molar amounts of all species), so that two systems built from the same
+/// database with the same activity models share the same fingerprint. This is useful for checking
+/// that data saved to disk (e.g., learned equilibrium states) is compatible with a chemical system.
+auto fingerprint(const ChemicalSystem& system) -> std::uint64_t;
+
 } // namespace Reaktoro
@@ -52,6 +52,13 @@ auto Element::molarMass() const -> double
     return pimpl->molar_mass;
 }
 
+auto Element::clone() const -> Element
+{
+    Element copy;
+    *copy.pimpl = *pimpl;
+    return copy;
+}
+
 auto operator<(const Element& lhs, const Element& rhs) -> bool
 {
     return lhs.name() < rhs.name();
@@ -42,6 +42,9 @@ public:
     /// Return the molar mass of the element (in units of kg/mol)
     auto molarMass() const -> double;
 
+    /// Return a copy of the chemical element that does not share its data with this one.
+    auto clone() const -> Element;
+
 private:
     struct Impl;
 
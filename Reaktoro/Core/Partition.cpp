@@ -160,6 +160,16 @@ struct Partition::Impl
     Matrix formula_matrix_inert_solid;
 
 
+    /// The formula matrix of the equilibrium partition in sparse storage
+    SparseMatrix formula_matrix_equilibrium_sparse;
+
+    /// The formula matrix of the kinetic partition in sparse storage
+    SparseMatrix formula_matrix_kinetic_sparse;
+
+    /// The formula matrix of the inert partition in sparse storage
+    SparseMatrix formula_matrix_inert_sparse;
+
+
     Impl()
     {}
 
@@ -251,6 +261,10 @@ struct Partition::Impl
         formula_matrix_inert       = submatrix(system.formulaMatrix(), indices_inert_elements, indices_inert_species);
         formula_matrix_inert_fluid = submatrix(system.formulaMatrix(), indices_inert_fluid_elements, indices_inert_fluid_species);
         formula_matrix_inert_solid = submatrix(system.formulaMatrix(), indices_inert_solid_elements, indices_inert_solid_species);
+
+        formula_matrix_equilibrium_sparse = sparse(formula_matrix_equilibrium);
+        formula_matrix_kinetic_sparse     = sparse(formula_matrix_kinetic);
+        formula_matrix_inert_sparse       = sparse(formula_matrix_inert);
     }
 };
 
@@ -612,4 +626,19 @@ auto Partition::formulaMatrixInertSolidPartition() const -> MatrixConstRef
     return pimpl->formula_matrix_inert_solid;
 }
 
+auto Partition::formulaMatrixEquilibriumPartitionSparse() const -> const SparseMatrix&
+{
+    return pimpl->formula_matrix_equilibrium_sparse;
+}
+
+auto Partition::formulaMatrixKineticPartitionSparse() const -> const SparseMatrix&
+{
+    return pimpl->formula_matrix_kinetic_sparse;
+}
+
+auto Partition::formulaMatrixInertPartitionSparse() const -> const SparseMatrix&
+{
+    return pimpl->formula_matrix_inert_sparse;
+}
+
 } // namespace Reaktoro
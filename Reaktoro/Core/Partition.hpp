@@ -25,6 +25,7 @@
 // Reaktoro includes
 #include <Reaktoro/Common/Index.hpp>
 #include <Reaktoro/Math/Matrix.hpp>
+#include <Reaktoro/Math/SparseMatrix.hpp>
 
 namespace Reaktoro {
 
@@ -273,6 +274,15 @@ public:
     /// Return the formula matrix of the inert-solid partition.
     auto formulaMatrixInertSolidPartition() const -> MatrixConstRef;
 
+    /// Return the formula matrix of the equilibrium partition in sparse storage.
+    auto formulaMatrixEquilibriumPartitionSparse() const -> const SparseMatrix&;
+
+    /// Return the formula matrix of the kinetic partition in sparse storage.
+    auto formulaMatrixKineticPartitionSparse() const -> const SparseMatrix&;
+
+    /// Return the formula matrix of the inert partition in sparse storage.
+    auto formulaMatrixInertPartitionSparse() const -> const SparseMatrix&;
+
 private:
     struct Impl;
 
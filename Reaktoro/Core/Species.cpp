@@ -127,6 +127,16 @@ auto Species::elementCoefficient(std::string element) const -> double
     return 0.0;
 }
 
+auto Species::clone() const -> Species
+{
+    Species copy;
+    *copy.pimpl = *pimpl;
+    copy.pimpl->elements.clear();
+    for(const auto& pair : pimpl->elements)
+        copy.pimpl->elements.emplace(pair.first.clone(), pair.second);
+    return copy;
+}
+
 auto operator<(const Species& lhs, const Species& rhs) -> bool
 {
     return lhs.name() < rhs.name();
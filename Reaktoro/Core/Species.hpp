@@ -74,6 +74,10 @@ public:
     /// Return the stoichiometry of an element in the species.
     auto elementCoefficient(std::string element) const -> double;
 
+    /// Return a copy of the chemical species that does not share its data with this one.
+    /// Copies of a Species object share their data, so that changes in one are seen by the others.
+    auto clone() const -> Species;
+
 private:
     struct Impl;
 
@@ -29,3 +29,5 @@
 #include <Reaktoro/Equilibrium/EquilibriumSensitivity.hpp>
 #include <Reaktoro/Equilibrium/EquilibriumSolver.hpp>
 #include <Reaktoro/Equilibrium/EquilibriumUtils.hpp>
+#include <Reaktoro/Equilibrium/SmartEquilibriumDatabase.hpp>
+#include <Reaktoro/Equilibrium/SmartEquilibriumSolver.hpp>
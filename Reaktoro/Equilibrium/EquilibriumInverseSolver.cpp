@@ -114,15 +114,38 @@ struct EquilibriumInverseSolver::Impl
         nonlinear_problem.A = C;
         nonlinear_problem.b = -be0;
 
-        // Set the non-linear function of the non-linear problem
-        nonlinear_problem.f = [&](VectorConstRef x) mutable
+        // The chemical state of the last successful evaluation, used as initial guess if a calculation fails
+        ChemicalState last = state;
+
+        // The amounts of the species and elements at the last evaluation of the sensitivity of the equilibrium state
+        Vector nsens, besens;
+
+        // The function that evaluates the residual of the equilibrium constraints and, if requested, its Jacobian
+        auto evaluate = [&](VectorConstRef x, bool jacobian) -> NonlinearResidual
         {
             // The amounts of elements in the equilibrium partition
             const Vector be = be0 + Ce*x;
 
+            // Predict the amounts of the species at `be` using the last sensitivity of the equilibrium state
+            if(nsens.size())
+            {
+                Vector n = nsens;
+                n(ies) += sensitivity.dndb * (be - besens);
+                n = (n.array() > 0.1*nsens.array()).select(n, 0.1*nsens);
+                state.setSpeciesAmounts(n);
+            }
+
             // Solve the equilibrium problem with update `be`
             result += solver.solve(state, T, P, be);
 
+            // Check if the equilibrium calculation converged
+            if(!result.optimum.succeeded)
+            {
+                // If not, solve using the state of the last successful evaluation as initial guess
+                state = last;
+                result += solver.solve(state, T, P, be);
+            }
+
             // Check if the equilibrium calculation converged
             if(!result.optimum.succeeded)
             {
@@ -134,19 +157,34 @@ struct EquilibriumInverseSolver::Impl
             // Check if the function evaluation was successful
             nonlinear_residual.succeeded = result.optimum.succeeded;
 
-            // Update the sensitivity of the equilibrium state
-            sensitivity = solver.sensitivity();
+            // Store the state of this evaluation to be used in the next ones
+            if(nonlinear_residual.succeeded)
+                last = state;
 
             // Calculate the residuals of the equilibrium constraints
             res = problem.residualEquilibriumConstraints(x, state);
 
-            // Calculate the residual vector `F` and its Jacobian `J`
+            // Calculate the residual vector `F`
             F = res.val;
-            J = res.ddx + res.ddn * sensitivity.dndb * C;
+
+            // Calculate the Jacobian `J` using the sensitivity of the equilibrium state
+            if(jacobian)
+            {
+                sensitivity = solver.sensitivity();
+                nsens = state.speciesAmounts();
+                besens = be;
+                J = res.ddx + res.ddn * sensitivity.dndb * C;
+            }
 
             return nonlinear_residual;
         };
 
+        // Set the non-linear function of the non-linear problem
+        nonlinear_problem.f = [&](VectorConstRef x) { return evaluate(x, true); };
+
+        // Set the non-linear function without Jacobian, used when it is approximated by Broyden updates
+        nonlinear_problem.fval = [&](VectorConstRef x) { return evaluate(x, false); };
+
         // Initialize the initial guess of the titrant amounts
         Vector x = problem.titrantInitialAmounts();
 
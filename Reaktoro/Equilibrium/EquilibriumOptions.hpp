@@ -50,6 +50,24 @@ struct SmartEquilibriumOptions
     double abstol = 1e-14;
 };
 
+/// The options for the reduction of an equilibrium calculation to its active species.
+struct EquilibriumReductionOptions
+{
+    /// The boolean flag that indicates if species pinned at their lower bounds should be removed from the calculation.
+    /// The species of a phase are considered pinned if all their amounts in the initial guess are below `factor * epsilon`.
+    /// The pinned species are kept fixed while the remaining ones are equilibrated, so that only the phases with
+    /// active species are evaluated. The optimality conditions of the pinned species are then checked using all
+    /// phases, and those that should have larger amounts are released before the calculation is repeated.
+    /// This is only effective when warm-start is used, since no species is pinned in a cold-start calculation.
+    bool active = false;
+
+    /// The factor multiplying epsilon that defines the amount below which a species is considered pinned.
+    double factor = 1e3;
+
+    /// The maximum number of reduced calculations before falling back to the full equilibrium calculation.
+    unsigned max_checks = 3;
+};
+
 /// The options for the equilibrium calculations
 struct EquilibriumOptions
 {
@@ -87,6 +105,9 @@ struct EquilibriumOptions
 
     /// The options for the smart equilibrium calculation.
     SmartEquilibriumOptions smart;
+
+    /// The options for the reduction of the equilibrium calculation to its active species.
+    EquilibriumReductionOptions reduction;
 };
 
 } // namespace Reaktoro
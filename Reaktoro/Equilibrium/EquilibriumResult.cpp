@@ -22,6 +22,7 @@ namespace Reaktoro {
 auto EquilibriumResult::operator+=(const EquilibriumResult& other) -> EquilibriumResult&
 {
     optimum += other.optimum;
+    pinned = other.pinned;
     return *this;
 }
 
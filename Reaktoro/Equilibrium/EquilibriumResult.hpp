@@ -18,6 +18,7 @@
 #pragma once
 
 // Reaktoro includes
+#include <Reaktoro/Common/Index.hpp>
 #include <Reaktoro/Optimization/OptimumResult.hpp>
 
 namespace Reaktoro {
@@ -39,6 +40,10 @@ struct EquilibriumResult
     /// The boolean flag that indicates if smart equilibrium calculation was used.
     SmartEquilibriumResult smart;
 
+    /// The number of species pinned at their lower bounds in the last reduced calculation.
+    /// @see EquilibriumOptions::reduction
+    Index pinned = 0;
+
     /// Apply an addition assignment to this instance
     auto operator+=(const EquilibriumResult& other) -> EquilibriumResult&;
 };
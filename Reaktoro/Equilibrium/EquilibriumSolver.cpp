@@ -17,11 +17,16 @@
 
 #include "EquilibriumSolver.hpp"
 
+// Eigen includes
+#include <Reaktoro/Math/Eigen/QR>
+
 // Reaktoro includes
 #include <Reaktoro/Common/ChemicalVector.hpp>
 #include <Reaktoro/Common/Constants.hpp>
 #include <Reaktoro/Common/ConvertUtils.hpp>
 #include <Reaktoro/Common/Exception.hpp>
+#include <Reaktoro/Common/Profiling.hpp>
+#include <Reaktoro/Common/SetUtils.hpp>
 #include <Reaktoro/Core/ChemicalProperties.hpp>
 #include <Reaktoro/Core/ChemicalState.hpp>
 #include <Reaktoro/Core/ChemicalSystem.hpp>
@@ -33,6 +38,7 @@
 #include <Reaktoro/Equilibrium/EquilibriumResult.hpp>
 #include <Reaktoro/Equilibrium/EquilibriumSensitivity.hpp>
 #include <Reaktoro/Math/MathUtils.hpp>
+#include <Reaktoro/Math/SparseMatrix.hpp>
 #include <Reaktoro/Optimization/OptimumOptions.hpp>
 #include <Reaktoro/Optimization/OptimumProblem.hpp>
 #include <Reaktoro/Optimization/OptimumResult.hpp>
@@ -89,6 +95,9 @@ struct EquilibriumSolver::Impl
     /// The chemical potentials of the inert species
     Vector ui;
 
+    /// The contribution of the elements to the dual potentials of the inert species
+    Vector zi;
+
     /// The mole fractions of the equilibrium species
     ChemicalVector xe;
 
@@ -122,8 +131,32 @@ struct EquilibriumSolver::Impl
     /// The formula matrix of the species in the equilibrium partition
     Matrix Ae;
 
-    /// The formula matrix of the inert species
-    Matrix Ai;
+    /// The formula matrix of the inert species in sparse storage
+    SparseMatrix Ai;
+
+    /// The local indices of the active equilibrium species (i.e., those not pinned at their lower bounds)
+    Indices jas;
+
+    /// The local indices of the equilibrium species pinned at their lower bounds
+    Indices jps;
+
+    /// The indices of the active equilibrium species
+    Indices ias;
+
+    /// The indices of the equilibrium species pinned at their lower bounds
+    Indices ips;
+
+    /// The indices of the phases containing active equilibrium species
+    Indices iaphases;
+
+    /// The number of active equilibrium species
+    unsigned Na;
+
+    /// The formula matrix of the active equilibrium species
+    Matrix Aa;
+
+    /// The formula matrix of the pinned equilibrium species
+    Matrix Ap;
 
     /// Construct a default Impl instance
     Impl()
@@ -168,7 +201,98 @@ struct EquilibriumSolver::Impl
         iis.insert(iis.end(), partition.indicesKineticSpecies().begin(), partition.indicesKineticSpecies().end());
 
         // Initialize the formula matrix of the inert species
-        Ai = cols(A, iis);
+        Ai = cols(system.formulaMatrixSparse(), iis);
+        zi.resize(iis.size());
+
+        // Initialize all equilibrium species as active
+        setPinnedSpecies(Indices());
+    }
+
+    /// Set the equilibrium species pinned at their lower bounds (given by their local indices)
+    auto setPinnedSpecies(const Indices& jps_) -> void
+    {
+        jps = jps_;
+        jas = difference(range<Index>(Ne), jps);
+        ias = extract(ies, jas);
+        ips = extract(ies, jps);
+        Na = jas.size();
+        Aa = cols(Ae, jas);
+        Ap = cols(Ae, jps);
+        iaphases = unique(system.indicesPhasesWithSpecies(ias));
+    }
+
+    /// Return the local indices of the pinned species whose formula vectors are not in the span of given formula vectors
+    auto outsideSpan(MatrixConstRef M, const Indices& pinned) const -> Indices
+    {
+        Matrix Q;
+        if(M.cols())
+        {
+            Eigen::ColPivHouseholderQR<Matrix> qr(M);
+            Q = qr.householderQ() * Matrix::Identity(M.rows(), qr.rank());
+        }
+        else Q = zeros(M.rows(), 0);
+
+        Indices outside;
+        for(Index j : pinned)
+        {
+            const Vector a = Ae.col(j);
+            if((a - Q * (tr(Q) * a)).norm() > 1e-10 * a.norm())
+                outside.push_back(j);
+        }
+        return outside;
+    }
+
+    /// Return the local indices of the equilibrium species pinned at their lower bounds in a chemical state.
+    /// Only species in phases with all their equilibrium species pinned are considered, since trace species
+    /// in a present phase usually carry degrees of freedom (e.g., its redox state) not available otherwise.
+    auto pinnedSpecies(const ChemicalState& state) const -> Indices
+    {
+        const double nmin = options.reduction.factor * options.epsilon;
+
+        // Determine the phases containing equilibrium species with non-negligible amounts
+        std::vector<bool> present(system.numPhases(), false);
+        for(Index i : ies)
+            if(state.speciesAmount(i) > nmin)
+                present[system.indexPhaseWithSpecies(i)] = true;
+
+        Indices pinned;
+        for(Index j = 0; j < Ne; ++j)
+            if(!present[system.indexPhaseWithSpecies(ies[j])])
+                pinned.push_back(j);
+
+        if(pinned.empty())
+            return pinned;
+
+        // Release the pinned species needed to span the same space as all equilibrium species (e.g., when an element has no other species)
+        const Indices active = difference(range<Index>(Ne), pinned);
+        return difference(pinned, outsideSpan(cols(Ae, active), pinned));
+    }
+
+    /// Return the local indices of the pinned species that violate their optimality conditions.
+    /// This requires the chemical potentials of all species to be evaluated at the current state.
+    /// Species that could not exceed the pinning threshold given the amounts of their elements are ignored.
+    auto violatedPinnedSpecies() const -> Indices
+    {
+        const double nmin = options.reduction.factor * options.epsilon;
+        const Vector zp = u.val(ips) - tr(Ap) * optimum_state.y;
+
+        Indices violated;
+        for(Index k = 0; k < jps.size(); ++k)
+        {
+            if(zp[k] >= 0.0)
+                continue;
+
+            // The maximum amount of the pinned species permitted by the amounts of its elements
+            double nmax = std::numeric_limits<double>::infinity();
+            for(Index r = 0; r < Ee; ++r)
+                if(Ap(r, k) > 0.0 && system.element(iee[r]).name() != "Z")
+                    nmax = std::min(nmax, be[r]/Ap(r, k));
+
+            if(nmax > nmin)
+                violated.push_back(jps[k]);
+        }
+
+        return violated;
     }
 
     /// Update the OptimumOptions instance with given EquilibriumOptions instance
@@ -195,7 +319,7 @@ struct EquilibriumSolver::Impl
             auto& znames = optimum_options.output.znames;
 
             // Initialize the names of the primal variables `n`
-            for(Index i : ies)
+            for(Index i : ias)
                 xnames.push_back(system.species(i).name());
 
             // Initialize the names of the dual variables `y`
@@ -221,8 +345,10 @@ struct EquilibriumSolver::Impl
         // Update the standard thermodynamic properties of the chemical system
         properties.update(T, P);
 
-        // Update the normalized standard Gibbs energies of the species
+        // Update the normalized standard Gibbs energies of the species, whose
+        // temperature derivatives also account for the derivative of 1/RT
         u0 = properties.standardPartialMolarGibbsEnergies()/RT;
+        u0.ddT -= u0.val/T;
 
         // The result of the objective evaluation
         ObjectiveResult res;
@@ -231,19 +357,21 @@ struct EquilibriumSolver::Impl
         optimum_problem.objective = [=](VectorConstRef ne) mutable
         {
             // Set the molar amounts of the species
-            n(ies) = ne;
+            n(ias) = ne;
 
-            // Update the chemical properties of the chemical system
-            properties.update(T, P, n);
+            // Update the chemical properties of the chemical system (only the phases with active species if some are pinned)
+            if(jps.empty())
+                properties.update(T, P, n);
+            else properties.update(n, iaphases);
 
             // Set the scaled chemical potentials of the species
             u = u0 + properties.lnActivities();
 
-            // Set the scaled chemical potentials of the equilibrium species
-            ue = rows(u, ies, ies);
+            // Set the scaled chemical potentials of the active equilibrium species
+            ue = rows(u, ias, ias);
 
-            // Set the mole fractions of the equilibrium species
-            xe = rows(properties.moleFractions(), ies, ies);
+            // Set the mole fractions of the active equilibrium species
+            xe = rows(properties.moleFractions(), ias, ias);
 
             // Set the objective result
             res.val = dot(ne, ue.val);
@@ -274,10 +402,14 @@ struct EquilibriumSolver::Impl
         };
 
         optimum_problem.c.resize(0);
-        optimum_problem.n = Ne;
-        optimum_problem.A = Ae;
+        optimum_problem.n = Na;
+        optimum_problem.A = Aa;
         optimum_problem.b = be;
-        optimum_problem.l.setConstant(Ne, options.epsilon);
+        optimum_problem.l.setConstant(Na, options.epsilon);
+
+        // Remove the contribution of the pinned species from the amounts of the elements
+        if(!jps.empty())
+            optimum_problem.b -= Ap * n(ips);
     }
 
     /// Initialize the optimum state from a chemical state
@@ -297,9 +429,9 @@ struct EquilibriumSolver::Impl
         z = state.speciesDualPotentials()/RT;
 
         // Initialize the optimum state
-        optimum_state.x = n(ies);
+        optimum_state.x = n(ias);
         optimum_state.y = y(iee);
-        optimum_state.z = z(ies);
+        optimum_state.z = z(ias);
     }
 
     /// Initialize the chemical state from a optimum state
@@ -309,8 +441,8 @@ struct EquilibriumSolver::Impl
         const double T  = state.temperature();
         const double RT = universalGasConstant*T;
 
-        // Update the molar amounts of the equilibrium species
-        n(ies) = optimum_state.x;
+        // Update the molar amounts of the active equilibrium species
+        n(ias) = optimum_state.x;
 
         // Update the normalized chemical potentials of the inert species
         ui = u.val(iis);
@@ -319,8 +451,13 @@ struct EquilibriumSolver::Impl
         y = zeros(E); y(iee) = optimum_state.y;
 
         // Update the normalized dual potentials of the equilibrium and inert species
-        z(ies) = optimum_state.z;
-        z(iis) = ui - tr(Ai) * y;
+        z(ias) = optimum_state.z;
+        multiplyTranspose(Ai, y, zi);
+        z(iis) = ui - zi;
+
+        // Update the normalized dual potentials of the pinned species as done for the inert ones
+        if(!jps.empty())
+            z(ips) = u.val(ips) - tr(Ap) * optimum_state.y;
 
         // Scale the normalized dual potentials of elements and species to units of J/mol
         y *= RT;
@@ -350,6 +487,10 @@ struct EquilibriumSolver::Impl
         const double RT = universalGasConstant*T;
         const double inf = std::numeric_limits<double>::infinity();
 
+        // Consider all equilibrium species as active in the approximate calculation
+        if(!jps.empty())
+            setPinnedSpecies(Indices());
+
         // Update the internal state of n, y, z
         n = state.speciesAmounts();
         y = state.elementDualPotentials();
@@ -454,6 +595,8 @@ struct EquilibriumSolver::Impl
     /// Solve the equilibrium problem
     auto solve(ChemicalState& state, double T, double P, const double* b) -> EquilibriumResult
     {
+        ProfilerScope("EquilibriumSolver::solve");
+
         // Set the molar amounts of the elements
         be = Vector::Map(b, Ee);
 
@@ -462,44 +605,96 @@ struct EquilibriumSolver::Impl
         state.setPressure(P);
 
         // Check if a simplex cold-start approximation must be performed
-        if(coldstart(state))
+        const bool cold = coldstart(state);
+        if(cold)
             initialguess(state, T, P, be);
 
+        // Pin the species at their lower bounds if the reduced calculation is active
+        if(options.reduction.active && !cold)
+            setPinnedSpecies(pinnedSpecies(state));
+        else if(!jps.empty())
+            setPinnedSpecies(Indices());
+
+        // The initial state used if a reduced calculation fails
+        const ChemicalState initial = jps.empty() ? ChemicalState() : state;
+
         // The result of the equilibrium calculation
         EquilibriumResult result;
 
-        // Update the optimum options
-        updateOptimumOptions();
+        // Set the method for the optimisation calculation
+        solver.setMethod(options.method);
 
-        // Update the optimum problem
-        updateOptimumProblem(state);
+        // Solve the reduced problems until no pinned species need to be released
+        for(unsigned check = 1; ; ++check)
+        {
+            // Update the optimum options
+            updateOptimumOptions();
 
-        // Update the optimum state
-        updateOptimumState(state);
+            // Update the optimum problem
+            updateOptimumProblem(state);
 
-        // Set the method for the optimisation calculation
-        solver.setMethod(options.method);
+            // Update the optimum state
+            updateOptimumState(state);
 
-        // Set the maximum number of iterations in each optimization pass
-        optimum_options.max_iterations = 10;
+            // Set the maximum number of iterations in each optimization pass
+            optimum_options.max_iterations = 10;
 
-        // Start the several opmization passes (stop if convergence attained)
-        auto counter = 0;
-        while(counter < options.optimum.max_iterations)
-        {
-            // Solve the optimisation problem
-            result.optimum += solver.solve(optimum_problem, optimum_state, optimum_options);
+            // Start the several opmization passes (stop if convergence attained)
+            auto counter = 0;
+            while(counter < options.optimum.max_iterations)
+            {
+                // Solve the optimisation problem
+                result.optimum += solver.solve(optimum_problem, optimum_state, optimum_options);
+
+                // Exit this loop if last solve succeeded
+                if(result.optimum.succeeded)
+                    break;
+
+                counter += optimum_options.max_iterations;
+            }
+
+            // Exit this loop if no species were pinned
+            if(jps.empty())
+                break;
+
+            // Restart from the initial state with all species active if the reduced calculation failed
+            if(!result.optimum.succeeded)
+            {
+                state = initial;
+                setPinnedSpecies(Indices());
+                continue;
+            }
+
+            // Update the chemical potentials of all species to check the optimality of the pinned ones
+            n(ias) = optimum_state.x;
+            properties.update(n);
+            u = u0 + properties.lnActivities();
 
-            // Exit this loop if last solve succeeded
-            if(result.optimum.succeeded)
+            // Exit this loop if all pinned species are at their optimum
+            const Indices violated = violatedPinnedSpecies();
+            if(violated.empty())
                 break;
 
-            counter += optimum_options.max_iterations;
+            // Update the chemical state and reset the dual potentials of the released species (later set to epsilon/n)
+            updateChemicalState(state);
+            for(Index j : violated)
+                z[ies[j]] = 0.0;
+            state.setSpeciesDualPotentials(z);
+
+            // Release the violated species, or all of them if the maximum number of checks was reached
+            if(check < options.reduction.max_checks)
+                setPinnedSpecies(difference(jps, violated));
+            else setPinnedSpecies(Indices());
         }
 
         // Update the chemical state from the optimum state
         updateChemicalState(state);
 
+        // Set the number of species that remained pinned in the last calculation
+        result.pinned = jps.size();
+
+        ProfilerCount("EquilibriumSolver::iterations", result.optimum.iterations);
+
         return result;
     }
 
@@ -507,19 +702,19 @@ struct EquilibriumSolver::Impl
     auto sensitivity() -> const EquilibriumSensitivity&
     {
         zerosEe = zeros(Ee);
-        zerosNe = zeros(Ne);
+        zerosNe = zeros(Na);
         unitjEe = zeros(Ee);
 
         sensitivities.dndT = zeros(Ne);
         sensitivities.dndP = zeros(Ne);
         sensitivities.dndb = zeros(Ne, Ee);
 
-        sensitivities.dndT = solver.dxdp(ue.ddT, zerosEe);
-        sensitivities.dndP = solver.dxdp(ue.ddP, zerosEe);
+        sensitivities.dndT(jas) = solver.dxdp(ue.ddT, zerosEe);
+        sensitivities.dndP(jas) = solver.dxdp(ue.ddP, zerosEe);
         for(Index j = 0; j < Ee; ++j)
         {
             unitjEe = unit(Ee, j);
-            sensitivities.dndb.col(j) = solver.dxdp(zerosNe, unitjEe);
+            sensitivities.dndb.col(j)(jas) = solver.dxdp(zerosNe, unitjEe);
         }
 
         return sensitivities;
@@ -528,36 +723,33 @@ struct EquilibriumSolver::Impl
     /// Compute the sensitivity of the species amounts with respect to temperature.
     auto dndT() -> VectorConstRef
     {
-        const auto& ieq_species = partition.indicesEquilibriumSpecies();
         zerosEe = zeros(Ee);
         sensitivities.dndT = zeros(N);
-        sensitivities.dndT(ieq_species) = solver.dxdp(ue.ddT, zerosEe);
+        sensitivities.dndT(ias) = solver.dxdp(ue.ddT, zerosEe);
         return sensitivities.dndT;
     }
 
     /// Compute the sensitivity of the species amounts with respect to pressure.
     auto dndP() -> VectorConstRef
     {
-        const auto& ieq_species = partition.indicesEquilibriumSpecies();
         zerosEe = zeros(Ee);
         sensitivities.dndP = zeros(N);
-        sensitivities.dndP(ieq_species) = solver.dxdp(ue.ddP, zerosEe);
+        sensitivities.dndP(ias) = solver.dxdp(ue.ddP, zerosEe);
         return sensitivities.dndP;
     }
 
     /// Compute the sensitivity of the species amounts with respect to element amounts.
     auto dndb() -> VectorConstRef
     {
-        const auto& ieq_species = partition.indicesEquilibriumSpecies();
         const auto& ieq_elements = partition.indicesEquilibriumElements();
         zerosEe = zeros(Ee);
-        zerosNe = zeros(Ne);
+        zerosNe = zeros(Na);
         unitjEe = zeros(Ee);
         sensitivities.dndb = zeros(Ne, Ee);
         for(Index j : ieq_elements)
         {
             unitjEe = unit(Ee, j);
-            sensitivities.dndb.col(j)(ieq_species) = solver.dxdp(zerosNe, unitjEe);
+            sensitivities.dndb.col(j)(ias) = solver.dxdp(zerosNe, unitjEe);
         }
         return sensitivities.dndb;
     }
@@ -629,6 +821,11 @@ auto EquilibriumSolver::solve(ChemicalState& state, const EquilibriumProblem& pr
     return solve(state, problem.temperature(), problem.pressure(), problem.elementAmounts());
 }
 
+auto EquilibriumSolver::system() const -> const ChemicalSystem&
+{
+    return pimpl->system;
+}
+
 auto EquilibriumSolver::properties() const -> const ChemicalProperties&
 {
     return pimpl->properties;
@@ -95,6 +95,9 @@ public:
     /// @param state[in,out] The initial guess and the final state of the equilibrium calculation
     auto solve(ChemicalState& state) -> EquilibriumResult;
 
+    /// Return the chemical system of the equilibrium solver.
+    auto system() const -> const ChemicalSystem&;
+
     /// Return the chemical properties of the calculated equilibrium state.
     auto properties() const -> const ChemicalProperties&;
 
@@ -0,0 +1,263 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright (C) 2014-2018 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+#include "SmartEquilibriumDatabase.hpp"
+
+// C++ includes
+#include <atomic>
+#include <fstream>
+#include <mutex>
+
+// Reaktoro includes
+#include <Reaktoro/Common/BinaryUtils.hpp>
+#include <Reaktoro/Common/Exception.hpp>
+#include <Reaktoro/Common/MemoryMappedFile.hpp>
+#include <Reaktoro/Core/ChemicalSystem.hpp>
+
+namespace Reaktoro {
+namespace {
+
+/// The identifier written at the beginning of learned equilibrium database files
+const std::string smart_database_magic = "REAKTORO-SMART-EQUILIBRIUM";
+
+/// The version of the binary format of learned equilibrium database files
+const std::uint32_t smart_database_version = 1;
+
+} // namespace
+
+struct SmartEquilibriumDatabase::Impl
+{
+    /// The chemical system of the learned reference states
+    ChemicalSystem system;
+
+    /// The current snapshot of the learned reference states
+    std::shared_ptr<const ReferenceList> snapshot = std::make_shared<const ReferenceList>();
+
+    /// The mutex that serializes the writers
+    std::mutex mutex;
+
+    /// Construct a default SmartEquilibriumDatabase::Impl instance.
+    Impl()
+    {}
+
+    /// Construct a SmartEquilibriumDatabase::Impl instance.
+    Impl(const ChemicalSystem& system)
+    : system(system)
+    {}
+
+    /// Return the current snapshot of the learned reference states.
+    auto references() const -> std::shared_ptr<const ReferenceList>
+    {
+        return std::atomic_load(&snapshot);
+    }
+
+    /// Publish a new snapshot with the given reference states appended to the current ones.
+    auto publish(const std::vector<std::shared_ptr<const SmartEquilibriumReference>>& added) -> void
+    {
+        using Chunk = ReferenceList::Chunk;
+        using Chunks = std::vector<std::shared_ptr<Chunk>>;
+
+        const Index chunk_size = ReferenceList::chunk_size;
+
+        std::lock_guard<std::mutex> lock(mutex);
+        const auto current = std::atomic_load(&snapshot);
+
+        auto updated = std::make_shared<ReferenceList>(*current);
+
+        for(const auto& reference : added)
+        {
+            // Start a new chunk if the last one is full, copying only the pointers to the chunks
+            if(updated->m_size % chunk_size == 0)
+            {
+                auto chunks = updated->m_chunks ? std::make_shared<Chunks>(*updated->m_chunks) : std::make_shared<Chunks>();
+                chunks->push_back(std::make_shared<Chunk>(chunk_size));
+                updated->m_chunks = std::move(chunks);
+            }
+
+            // Fill the slot after the last state, which is beyond the size of every published snapshot
+            (*updated->m_chunks->back())[updated->m_size % chunk_size] = reference;
+            ++updated->m_size;
+        }
+
+        std::atomic_store(&snapshot, std::shared_ptr<const ReferenceList>(std::move(updated)));
+    }
+
+    /// Add a learned reference state to the database.
+    auto add(const SmartEquilibriumReference& reference) -> void
+    {
+        publish({ std::make_shared<const SmartEquilibriumReference>(reference) });
+    }
+
+    /// Add learned reference states to the database.
+    auto add(const std::vector<SmartEquilibriumReference>& references) -> void
+    {
+        std::vector<std::shared_ptr<const SmartEquilibriumReference>> added;
+        added.reserve(references.size());
+        for(const auto& reference : references)
+            added.push_back(std::make_shared<const SmartEquilibriumReference>(reference));
+        publish(added);
+    }
+
+    /// Save the learned reference states to a binary file.
+    auto save(std::string filename) const -> void
+    {
+        std::ofstream out(filename, std::ios::out | std::ios::binary | std::ios::trunc);
+
+        Assert(out.is_open(), "Could not save the learned equilibrium states to file `" << filename << "`.",
+            "The file could not be opened for writing.");
+
+        const auto refs = references();
+
+        writeBinary(out, smart_database_magic);
+        writeBinary(out, smart_database_version);
+        writeBinary(out, fingerprint(system));
+        writeBinary(out, static_cast<std::uint64_t>(refs->size()));
+
+        for(Index i = 0; i < refs->size(); ++i)
+        {
+            const SmartEquilibriumReference& ref = (*refs)[i];
+            writeBinary(out, ref.be);
+            writeBinary(out, ref.state.temperature());
+            writeBinary(out, ref.state.pressure());
+            writeBinary(out, ref.state.speciesAmounts());
+            writeBinary(out, ref.state.elementDualPotentials());
+            writeBinary(out, ref.state.speciesDualPotentials());
+            writeBinary(out, ref.sensitivity.dndT);
+            writeBinary(out, ref.sensitivity.dndP);
+            writeBinary(out, ref.sensitivity.dndb);
+        }
+
+        Assert(out.good(), "Could not save the learned equilibrium states to file `" << filename << "`.",
+            "An error occurred while writing to the file.");
+    }
+
+    /// Load learned reference states from a binary file and append them to the database.
+    auto load(std::string filename) -> void
+    {
+        MemoryMappedFile file(filename);
+        MemoryInputStream in(file);
+
+        std::string magic;
+        std::uint32_t version = 0;
+        std::uint64_t hash = 0;
+        std::uint64_t size = 0;
+
+        readBinary(in, magic);
+
+        Assert(in.good() && magic == smart_database_magic,
+            "Could not load the learned equilibrium states from file `" << filename << "`.",
+            "The file is not a learned equilibrium database.");
+
+        readBinary(in, version);
+
+        Assert(version == smart_database_version,
+            "Could not load the learned equilibrium states from file `" << filename << "`.",
+            "The file has format version " << version << ", but version " << smart_database_version << " was expected.");
+
+        readBinary(in, hash);
+
+        Assert(hash == fingerprint(system),
+            "Could not load the learned equilibrium states from file `" << filename << "`.",
+            "The file was created for a different chemical system.");
+
+        readBinary(in, size);
+
+        std::vector<std::shared_ptr<const SmartEquilibriumReference>> loaded;
+        loaded.reserve(size);
+
+        Vector n, y, z;
+        double T, P;
+
+        for(std::uint64_t i = 0; i < size; ++i)
+        {
+            auto ref = std::make_shared<SmartEquilibriumReference>();
+
+            readBinary(in, ref->be);
+            readBinary(in, T);
+            readBinary(in, P);
+            readBinary(in, n);
+            readBinary(in, y);
+            readBinary(in, z);
+            readBinary(in, ref->sensitivity.dndT);
+            readBinary(in, ref->sensitivity.dndP);
+            readBinary(in, ref->sensitivity.dndb);
+
+            Assert(in.good(), "Could not load the learned equilibrium states from file `" << filename << "`.",
+                "The file is truncated or corrupted.");
+
+            ref->state = ChemicalState(system);
+            ref->state.setTemperature(T);
+            ref->state.setPressure(P);
+            ref->state.setSpeciesAmounts(n);
+            ref->state.setElementDualPotentials(y);
+            ref->state.setSpeciesDualPotentials(z);
+            ref->properties = system.properties(T, P, n);
+
+            loaded.push_back(ref);
+        }
+
+        publish(loaded);
+    }
+};
+
+SmartEquilibriumDatabase::SmartEquilibriumDatabase()
+: pimpl(new Impl())
+{}
+
+SmartEquilibriumDatabase::SmartEquilibriumDatabase(const ChemicalSystem& system)
+: pimpl(new Impl(system))
+{}
+
+SmartEquilibriumDatabase::~SmartEquilibriumDatabase()
+{}
+
+auto SmartEquilibriumDatabase::system() const -> const ChemicalSystem&
+{
+    return pimpl->system;
+}
+
+auto SmartEquilibriumDatabase::add(const SmartEquilibriumReference& reference) -> void
+{
+    pimpl->add(reference);
+}
+
+auto SmartEquilibriumDatabase::add(const std::vector<SmartEquilibriumReference>& references) -> void
+{
+    pimpl->add(references);
+}
+
+auto SmartEquilibriumDatabase::references() const -> std::shared_ptr<const ReferenceList>
+{
+    return pimpl->references();
+}
+
+auto SmartEquilibriumDatabase::size() const -> unsigned
+{
+    return references()->size();
+}
+
+auto SmartEquilibriumDatabase::save(std::string filename) const -> void
+{
+    pimpl->save(filename);
+}
+
+auto SmartEquilibriumDatabase::load(std::string filename) -> void
+{
+    pimpl->load(filename);
+}
+
+} // namespace Reaktoro
@@ -0,0 +1,142 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright (C) 2014-2018 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+// C++ includes
+#include <memory>
+#include <string>
+#include <vector>
+
+// Reaktoro includes
+#include <Reaktoro/Common/Index.hpp>
+#include <Reaktoro/Core/ChemicalProperties.hpp>
+#include <Reaktoro/Core/ChemicalState.hpp>
+#include <Reaktoro/Equilibrium/EquilibriumSensitivity.hpp>
+#include <Reaktoro/Math/Matrix.hpp>
+
+namespace Reaktoro {
+
+// Forward declarations
+class ChemicalSystem;
+
+/// A reference equilibrium state learned by a smart equilibrium calculation.
+struct SmartEquilibriumReference
+{
+    /// The amounts of the equilibrium elements used to calculate the reference state (in units of mol).
+    Vector be;
+
+    /// The calculated equilibrium state.
+    ChemicalState state;
+
+    /// The chemical properties at the calculated equilibrium state.
+    ChemicalProperties properties;
+
+    /// The sensitivity derivatives at the calculated equilibrium state.
+    EquilibriumSensitivity sensitivity;
+};
+
+/// A thread-safe store of reference equilibrium states learned by smart equilibrium calculations.
+/// Copies of a SmartEquilibriumDatabase instance refer to the same store, so that several
+/// SmartEquilibriumSolver instances (e.g., one per thread) can share their learned states.
+/// A state learned by any of them is immediately available to all others.
+///
+/// Lookups never block on writers. The learned states are published as immutable snapshots:
+/// readers atomically acquire the current snapshot with @ref references and keep using it for
+/// as long as they need, while writers serialize among themselves, append the added states,
+/// and atomically replace the current snapshot with one that includes them.
+/// @see SmartEquilibriumSolver
+class SmartEquilibriumDatabase
+{
+public:
+    /// An immutable snapshot of the learned reference states.
+    /// The states are stored in chunks of fixed capacity shared by all snapshots. A writer fills
+    /// the slots after the last state of the current snapshot, which no existing snapshot reads,
+    /// so that adding a state copies neither the previous states nor the pointers to them.
+    class ReferenceList
+    {
+    public:
+        /// Return the number of reference states in the snapshot.
+        auto size() const -> Index { return m_size; }
+
+        /// Return true if the snapshot has no reference states.
+        auto empty() const -> bool { return m_size == 0; }
+
+        /// Return the reference state with given index in the order they were added.
+        auto operator[](Index i) const -> const SmartEquilibriumReference& { return *(*(*m_chunks)[i/chunk_size])[i%chunk_size]; }
+
+    private:
+        friend class SmartEquilibriumDatabase;
+
+        /// The number of reference states in each chunk.
+        static const Index chunk_size = 256;
+
+        /// The type of a chunk of reference states, whose size is fixed when it is created.
+        using Chunk = std::vector<std::shared_ptr<const SmartEquilibriumReference>>;
+
+        /// The chunks of reference states, copied only when a new chunk is needed.
+        std::shared_ptr<const std::vector<std::shared_ptr<Chunk>>> m_chunks;
+
+        /// The number of reference states in the snapshot.
+        Index m_size = 0;
+    };
+
+    /// Construct a default SmartEquilibriumDatabase instance.
+    SmartEquilibriumDatabase();
+
+    /// Construct a SmartEquilibriumDatabase instance for a chemical system.
+    explicit SmartEquilibriumDatabase(const ChemicalSystem& system);
+
+    /// Destroy this SmartEquilibriumDatabase instance.
+    virtual ~SmartEquilibriumDatabase();
+
+    /// Return the chemical system of the learned reference states.
+    auto system() const -> const ChemicalSystem&;
+
+    /// Add a learned reference state to the database.
+    auto add(const SmartEquilibriumReference& reference) -> void;
+
+    /// Add learned reference states to the database, publishing them in a single snapshot.
+    auto add(const std::vector<SmartEquilibriumReference>& references) -> void;
+
+    /// Return the current snapshot of the learned reference states.
+    auto references() const -> std::shared_ptr<const ReferenceList>;
+
+    /// Return the number of learned reference states.
+    auto size() const -> unsigned;
+
+    /// Save the learned reference states to a binary file.
+    /// The file is tagged with the @ref fingerprint of the chemical system, so that
+    /// it can only be loaded by databases created with an equivalent chemical system.
+    /// @param filename The name of the file
+    auto save(std::string filename) const -> void;
+
+    /// Load learned reference states from a binary file created with @ref save.
+    /// The loaded states are appended to the ones already in the database, so that a
+    /// database shared among several runs can be accumulated by loading it, solving,
+    /// and saving it back. An exception is thrown if the file was created for a
+    /// different chemical system.
+    /// @param filename The name of the file
+    auto load(std::string filename) -> void;
+
+private:
+    struct Impl;
+
+    std::shared_ptr<Impl> pimpl;
+};
+
+} // namespace Reaktoro
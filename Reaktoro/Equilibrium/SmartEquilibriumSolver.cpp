@@ -19,8 +19,6 @@
 
 // C++ includes
 #include <iostream> // todo remove
-#include <list>
-#include <tuple>
 
 // Reaktoro includes
 #include <Reaktoro/Common/Exception.hpp>
@@ -33,6 +31,7 @@
 #include <Reaktoro/Equilibrium/EquilibriumResult.hpp>
 #include <Reaktoro/Equilibrium/EquilibriumSensitivity.hpp>
 #include <Reaktoro/Equilibrium/EquilibriumSolver.hpp>
+#include <Reaktoro/Equilibrium/SmartEquilibriumDatabase.hpp>
 
 namespace Reaktoro {
 
@@ -50,8 +49,8 @@ struct SmartEquilibriumSolver::Impl
     /// The solver for the equilibrium calculations
     EquilibriumSolver solver;
 
-    /// The tree used to save the calculated equilibrium states and respective sensitivities
-    std::list<std::tuple<Vector, ChemicalState, ChemicalProperties, EquilibriumSensitivity>> tree;
+    /// The database used to save the calculated equilibrium states and respective sensitivities
+    SmartEquilibriumDatabase database;
 
     /// The vector of amounts of species
     Vector n;
@@ -64,7 +63,7 @@ struct SmartEquilibriumSolver::Impl
 
     /// Construct an SmartEquilibriumSolver::Impl instance.
     Impl(const ChemicalSystem& system)
-    : system(system), solver(system)
+    : system(system), solver(system), database(system)
     {}
 
     /// Set the options for the equilibrium calculation.
@@ -84,35 +83,56 @@ struct SmartEquilibriumSolver::Impl
     auto learn(ChemicalState& state, double T, double P, VectorConstRef be) -> EquilibriumResult
     {
         EquilibriumResult res = solver.solve(state, T, P, be);
-        tree.emplace_back(be, state, solver.properties(), solver.sensitivity());
+        database.add({be, state, solver.properties(), solver.sensitivity()});
         return res;
     }
 
     auto estimate(ChemicalState& state, double T, double P, VectorConstRef be) -> EquilibriumResult
     {
-        if(tree.empty())
-            return {};
+        // The snapshot of the learned states, which remains valid even if other threads add new ones
+        const auto references = database.references();
 
-        using TreeNodeType = std::tuple<Vector, ChemicalState, ChemicalProperties, EquilibriumSensitivity>;
+        if(references->empty())
+            return {};
 
         EquilibriumResult res;
 
-        auto comp = [&](const TreeNodeType& a, const TreeNodeType& b)
+        // The weights that make relative changes in temperature and pressure
+        // comparable to relative changes in the amounts of elements in the
+        // search for the nearest learned state in the (T, P, be) space
+        const double bnorm2 = be.squaredNorm();
+        const double wT = bnorm2/(T*T);
+        const double wP = bnorm2/(P*P);
+
+        auto distance = [&](const SmartEquilibriumReference& a)
         {
-            const auto& be_a = std::get<0>(a);
-            const auto& be_b = std::get<0>(b);
-            return (be_a - be).squaredNorm() < (be_b - be).squaredNorm();
+            const double dT = a.state.temperature() - T;
+            const double dP = a.state.pressure() - P;
+            return (a.be - be).squaredNorm() + wT*dT*dT + wP*dP*dP;
         };
 
-        auto it = std::min_element(tree.begin(), tree.end(), comp);
+        // Find the learned state nearest to the given conditions
+        Index imin = 0;
+        double dmin = distance((*references)[0]);
+        for(Index i = 1; i < references->size(); ++i)
+        {
+            const double d = distance((*references)[i]);
+            if(d < dmin) { dmin = d; imin = i; }
+        }
+
+        const SmartEquilibriumReference& reference = (*references)[imin];
 
-        const auto& be0 = std::get<0>(*it);
-        const ChemicalState& state0 = std::get<1>(*it);
-        const ChemicalProperties& properties0 = std::get<2>(*it);
-        const EquilibriumSensitivity& sensitivity0 = std::get<3>(*it);
+        const auto& be0 = reference.be;
+        const ChemicalState& state0 = reference.state;
+        const ChemicalProperties& properties0 = reference.properties;
+        const EquilibriumSensitivity& sensitivity0 = reference.sensitivity;
         const auto& n0 = state0.speciesAmounts();
+        const double T0 = state0.temperature();
+        const double P0 = state0.pressure();
 
         MatrixConstRef dlnadn = properties0.lnActivities().ddn; // TODO this line is assuming all species are equilibrium specie! get the rows and columns corresponding to equilibrium species
+        const auto& dlnadT = properties0.lnActivities().ddT;
+        const auto& dlnadP = properties0.lnActivities().ddP;
         const auto& lna0 = properties0.lnActivities().val;
 
         // TODO Fixing negative amounts
@@ -132,10 +152,15 @@ struct SmartEquilibriumSolver::Impl
 
 //        n = n0 + sensitivity0.dnedbe * (be - be0);
         dn.noalias() = sensitivity0.dndb * (be - be0); // n is actually delta(n)
+        dn.noalias() += sensitivity0.dndT * (T - T0);
+        dn.noalias() += sensitivity0.dndP * (P - P0);
 
         n.noalias() = n0 + dn;
 
+        // The first-order change in ln(a) due to changes in n, T, and P
         delta_lna.noalias() = dlnadn * dn;
+        delta_lna.noalias() += dlnadT * (T - T0);
+        delta_lna.noalias() += dlnadP * (P - P0);
 
         // The estimated ln(a[i]) of each species must not be
         // too far away from the reference value ln(aref[i])
@@ -159,6 +184,8 @@ struct SmartEquilibriumSolver::Impl
 //        if(((n - n0).array().abs() <= abstol + reltol*n0.array().abs()).all())
         {
             n.noalias() = abs(n); // TODO abs needs only to be applied to negative values
+            state.setTemperature(T);
+            state.setPressure(P);
             state.setSpeciesAmounts(n);
             res.optimum.succeeded = true;
             res.smart.succeeded = true;
@@ -273,5 +300,41 @@ auto SmartEquilibriumSolver::properties() const -> const ChemicalProperties&
             "This method has not been implemented yet.");
 }
 
+auto SmartEquilibriumSolver::setDatabase(const SmartEquilibriumDatabase& database) -> void
+{
+    Assert(database.system().numSpecies() == pimpl->system.numSpecies() &&
+        database.system().numElements() == pimpl->system.numElements(),
+        "Could not set the database of learned equilibrium states.",
+        "The database has learned states of a chemical system with " << database.system().numSpecies() << " species and " <<
+        database.system().numElements() << " elements, but the solver has " << pimpl->system.numSpecies() << " species and " <<
+        pimpl->system.numElements() << " elements.");
+
+    Assert(fingerprint(database.system()) == fingerprint(pimpl->system),
+        "Could not set the database of learned equilibrium states.",
+        "The database has learned states of a different chemical system, with other species or models.");
+
+    pimpl->database = database;
+}
+
+auto SmartEquilibriumSolver::database() const -> const SmartEquilibriumDatabase&
+{
+    return pimpl->database;
+}
+
+auto SmartEquilibriumSolver::numLearnedStates() const -> unsigned
+{
+    return pimpl->database.size();
+}
+
+auto SmartEquilibriumSolver::save(std::string filename) const -> void
+{
+    pimpl->database.save(filename);
+}
+
+auto SmartEquilibriumSolver::load(std::string filename) -> void
+{
+    pimpl->database.load(filename);
+}
+
 } // namespace Reaktoro
 
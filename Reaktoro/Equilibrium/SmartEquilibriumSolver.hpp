@@ -19,6 +19,7 @@
 
 // C++ includes
 #include <memory>
+#include <string>
 
 // Reaktoro includes
 #include <Reaktoro/Math/Matrix.hpp>
@@ -30,11 +31,17 @@ class ChemicalProperties;
 class ChemicalState;
 class ChemicalSystem;
 class Partition;
+class SmartEquilibriumDatabase;
 struct EquilibriumOptions;
 class EquilibriumProblem;
 struct EquilibriumResult;
 
 /// A class used to perform equilibrium calculations using machine learning scheme.
+/// The learned equilibrium states are kept in a SmartEquilibriumDatabase, which is
+/// shared among copies of a SmartEquilibriumSolver instance. To run smart equilibrium
+/// calculations concurrently, create one solver per thread (e.g., by copying a solver)
+/// so that each thread has its own workspace, while all of them share the learned states.
+/// @see SmartEquilibriumDatabase
 class SmartEquilibriumSolver
 {
 public:
@@ -66,6 +73,9 @@ public:
     auto learn(ChemicalState& state, const EquilibriumProblem& problem) -> EquilibriumResult;
 
     /// Estimate the equilibrium state using sensitivity derivatives.
+    /// The nearest learned state in the space of temperature, pressure and amounts of elements
+    /// is used as reference, and the species amounts are predicted with a first-order
+    /// expansion using the derivatives of the reference state with respect to `T`, `P` and `be`.
     auto estimate(ChemicalState& state, double T, double P, VectorConstRef be) -> EquilibriumResult;
 
     /// Estimate the equilibrium state using sensitivity derivatives.
@@ -82,6 +92,25 @@ public:
     /// Return the chemical properties of the calculated equilibrium state.
     auto properties() const -> const ChemicalProperties&;
 
+    /// Set the database of learned equilibrium states used by this solver.
+    /// Use this method to share a database among several solvers, possibly in different threads.
+    /// An exception is thrown if the database has states of a chemical system with a different @ref fingerprint.
+    auto setDatabase(const SmartEquilibriumDatabase& database) -> void;
+
+    /// Return the database of learned equilibrium states used by this solver.
+    auto database() const -> const SmartEquilibriumDatabase&;
+
+    /// Return the number of equilibrium states learned so far.
+    auto numLearnedStates() const -> unsigned;
+
+    /// Save the learned equilibrium states and their sensitivities to a binary file.
+    /// @see SmartEquilibriumDatabase::save
+    auto save(std::string filename) const -> void;
+
+    /// Load learned equilibrium states from a binary file created with @ref save.
+    /// @see SmartEquilibriumDatabase::load
+    auto load(std::string filename) -> void;
+
 private:
     struct Impl;
 
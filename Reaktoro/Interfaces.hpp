@@ -21,3 +21,4 @@
 #include <Reaktoro/Interfaces/Phreeqc.hpp>
 #include <Reaktoro/Interfaces/PhreeqcDatabase.hpp>
 #include <Reaktoro/Interfaces/PhreeqcEditor.hpp>
+#include <Reaktoro/Interfaces/PhreeqcPool.hpp>
@@ -20,6 +20,7 @@
 #ifdef LINK_PHREEQC
 
 // C++ includes
+#include <cmath>
 #include <map>
 
 // Eigen includes
@@ -98,6 +99,18 @@ struct Phreeqc::Impl
     // The name of the database file loaded into this instance
     std::string database;
 
+    // The input scripts executed in this instance after the database was loaded
+    std::vector<std::string> inputs;
+
+    // The temperature (in units of K) at which the T and P dependent properties were last updated
+    double thermo_T = NAN;
+
+    // The pressure (in units of Pa) at which the T and P dependent properties were last updated
+    double thermo_P = NAN;
+
+    // The ionic strength (in units of molal) at which the T, P, and I dependent properties were last updated
+    double thermo_I = NAN;
+
     // The set of elements composing the species
     std::vector<element*> elements;
 
@@ -341,6 +354,9 @@ auto Phreeqc::Impl::execute(std::string input, std::string output) -> void
     // Execute the given input script file
     PhreeqcUtils::execute(phreeqc, input, output);
 
+    // Record the input so that independent instances can be created with the same state
+    inputs.push_back(input);
+
     // Initialize the data members after executing the PHREEQC script
     initialize();
 }
@@ -678,6 +694,9 @@ void Phreeqc::Impl::initializeChemicalState()
     // Initialize the amounts of species
     n.resize(numSpecies());
 
+    // Invalidate the cached T, P, and I dependent properties
+    thermo_T = thermo_P = thermo_I = NAN;
+
     n << PhreeqcUtils::speciesAmounts(phreeqc, aqueous_species),
          PhreeqcUtils::speciesAmounts(phreeqc, gaseous_species),
          PhreeqcUtils::speciesAmounts(phreeqc, mineral_species);
@@ -701,8 +720,9 @@ auto Phreeqc::Impl::set(double T, double P) -> void
     // Update the pressure member (in units of atm)
     phreeqc.patm_x = P * pascal_to_atm;
 
-    // Update the thermodynamic properties (T and P dependent)
-    updateThermoProperties();
+    // Update the thermodynamic properties (T and P dependent) if T or P changed
+    if(T != thermo_T || P != thermo_P)
+        updateThermoProperties();
 }
 
 auto Phreeqc::Impl::set(double T, double P, const Vector& n) -> void
@@ -723,8 +743,9 @@ auto Phreeqc::Impl::set(double T, double P, const Vector& n) -> void
     // Update the amounts of the species
     setSpeciesAmounts(n);
 
-    // Update the thermodynamic properties (T and P dependent)
-    updateThermoProperties();
+    // Update the thermodynamic properties (T and P dependent) if T or P changed
+    if(T != thermo_T || P != thermo_P)
+        updateThermoProperties();
 
     // Update the thermodynamic properties (T, P, and n dependent)
     updateChemicalProperties();
@@ -754,20 +775,35 @@ auto Phreeqc::Impl::updateThermoProperties() -> void
 
     // Update the ln activity constants
     ln_activity_constants = lnActivityConstants();
+
+    // Register the T and P conditions of the properties above, and invalidate the ones also depending on I
+    thermo_T = T;
+    thermo_P = P;
+    thermo_I = NAN;
 }
 
 auto Phreeqc::Impl::updateChemicalProperties() -> void
 {
-    // Update equilibrium constants of reactions with T, P, and I corrections.
-    // This Phreeqc::k_temp call also updates density and dielectric
-    // properties of water at the given T and P conditions.
-    phreeqc.k_temp(phreeqc.tc_x, phreeqc.patm_x);
+    // Update the properties with T, P, and I corrections only if the ionic
+    // strength changed, since T and P are the same as in the last update
+    if(I != thermo_I)
+    {
+        // Update equilibrium constants of reactions with T, P, and I corrections.
+        // This Phreeqc::k_temp call also updates density and dielectric
+        // properties of water at the given T and P conditions. As in PHREEQC
+        // calculations, the ionic strength corrections are only recomputed if
+        // the ionic strength changed by more than its relative tolerance.
+        phreeqc.k_temp(phreeqc.tc_x, phreeqc.patm_x);
 
-    // Update the standard Gibbs energies of the species with T, P, and I corrections
-    standard_molar_gibbs_energies_TPI = speciesMolarGibbsEnergies();
+        // Update the standard Gibbs energies of the species with T, P, and I corrections
+        standard_molar_gibbs_energies_TPI = speciesMolarGibbsEnergies();
 
-    // Update the standard molar volumes of the species with T, P, and I corrections
-    standard_molar_volumes_TPI = speciesMolarVolumes();
+        // Update the standard molar volumes of the species with T, P, and I corrections
+        standard_molar_volumes_TPI = speciesMolarVolumes();
+
+        // Register the ionic strength of the properties above
+        thermo_I = I;
+    }
 
     updateAqueousProperties();
 
@@ -1235,6 +1271,18 @@ auto Phreeqc::execute(std::string input) -> void
     pimpl->execute(input, {});
 }
 
+auto Phreeqc::replicate() const -> Phreeqc
+{
+    Phreeqc copy;
+    if(!pimpl->database.empty())
+        copy.load(pimpl->database);
+    for(const auto& input : pimpl->inputs)
+        copy.execute(input);
+    if(copy.numSpecies())
+        copy.set(temperature(), pressure(), speciesAmounts());
+    return copy;
+}
+
 auto Phreeqc::reset() -> void
 {
     pimpl.reset(new Phreeqc::Impl());
@@ -1496,6 +1544,12 @@ auto Phreeqc::set(double T, double P, VectorConstRef n) -> void
     throwPhreeqcNotBuiltError();
 }
 
+auto Phreeqc::replicate() const -> Phreeqc
+{
+    throwPhreeqcNotBuiltError();
+    return {};
+}
+
 auto Phreeqc::standardMolarGibbsEnergies() const -> Vector
 {
     throwPhreeqcNotBuiltError();
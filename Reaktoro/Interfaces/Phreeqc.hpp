@@ -131,6 +131,14 @@ public:
     /// @param input The input either as a filename or as an input script coded in a string.
     auto execute(std::string input) -> void;
 
+    /// Return an independent Phreeqc instance in the same state of this one.
+    /// The returned instance has its own low-level PHREEQC instance, created by
+    /// loading the same database and executing the same input scripts. This is
+    /// needed to evaluate properties concurrently, since the low-level PHREEQC
+    /// instance is not thread-safe, and copies of a Phreeqc instance share it.
+    /// @see PhreeqcPool
+    auto replicate() const -> Phreeqc;
+
     /// Reset this Phreeqc instance to a clean state.
     /// After this Phreeqc instance is reset, one must again
     /// load a new database and execute a new input script file.
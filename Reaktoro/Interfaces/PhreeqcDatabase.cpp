@@ -528,7 +528,7 @@ auto PhreeqcDatabase::cross(const Database& reference_database) -> Database
         if(primary_species.count(species.name()))
         {
             const std::string reaktoro_name = reaktoro_naming(species.name());
-            AqueousSpecies refspecies = reference_database.aqueousSpecies(reaktoro_name);
+            AqueousSpecies refspecies = reference_database.aqueousSpecies(reaktoro_name).clone();
             AqueousSpeciesThermoData data = refspecies.thermoData();
             data.phreeqc.set(species.thermoData().phreeqc.get());
             data.phreeqc.get().reaction = {};
@@ -543,7 +543,7 @@ auto PhreeqcDatabase::cross(const Database& reference_database) -> Database
             const std::string alternative = master_species_to_alternative[species.name()];
 
             // Create a copy of the given aqueous species and set its thermodynamic data.
-            AqueousSpecies copy = species;
+            AqueousSpecies copy = species.clone();
             AqueousSpeciesThermoData data = species.thermoData();
 
             if(containsAqueousSpecies(alternative))
@@ -567,7 +567,7 @@ auto PhreeqcDatabase::cross(const Database& reference_database) -> Database
         // Check if the gaseous species is a product species that is being promoted as master species
         if(primary_species.count(species.name()))
         {
-            GaseousSpecies refspecies = reference_database.gaseousSpecies(species.name());
+            GaseousSpecies refspecies = reference_database.gaseousSpecies(species.name()).clone();
             GaseousSpeciesThermoData data = refspecies.thermoData();
             data.phreeqc.set(species.thermoData().phreeqc.get());
             data.phreeqc.get().reaction = {};
@@ -583,7 +583,7 @@ auto PhreeqcDatabase::cross(const Database& reference_database) -> Database
         // Check if the mineral species is a product species that is being promoted as master species
         if(primary_species.count(species.name()))
         {
-            MineralSpecies refspecies = reference_database.mineralSpecies(species.name());
+            MineralSpecies refspecies = reference_database.mineralSpecies(species.name()).clone();
             MineralSpeciesThermoData data = refspecies.thermoData();
             data.phreeqc.set(species.thermoData().phreeqc.get());
             data.phreeqc.get().reaction = {};
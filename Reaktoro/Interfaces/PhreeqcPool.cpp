@@ -0,0 +1,190 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright (C) 2014-2018 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+#include "PhreeqcPool.hpp"
+
+// C++ includes
+#include <condition_variable>
+#include <mutex>
+
+// Reaktoro includes
+#include <Reaktoro/Common/Exception.hpp>
+#include <Reaktoro/Interfaces/Phreeqc.hpp>
+
+namespace Reaktoro {
+
+struct PhreeqcPool::Impl
+{
+    // The independent Phreeqc instances in the pool
+    std::vector<Phreeqc> instances;
+
+    // The indices of the Phreeqc instances not in use
+    std::vector<Index> available;
+
+    // The mutex that protects the indices of the available instances
+    std::mutex mutex;
+
+    // The condition variable used to wait for an available instance
+    std::condition_variable returned;
+
+    // The temperature of the Phreeqc instance used to create the pool (in units of K)
+    double T;
+
+    // The pressure of the Phreeqc instance used to create the pool (in units of Pa)
+    double P;
+
+    // The amounts of the species of the Phreeqc instance used to create the pool (in units of mol)
+    Vector n;
+
+    // Construct a PhreeqcPool::Impl instance
+    Impl(const Phreeqc& phreeqc, unsigned size)
+    : T(phreeqc.temperature()), P(phreeqc.pressure()), n(phreeqc.speciesAmounts())
+    {
+        Assert(size > 0, "Cannot create a PhreeqcPool instance.",
+            "The number of Phreeqc instances in the pool must be positive.");
+
+        // Create the replicas, so that the given instance can still be used elsewhere
+        instances.reserve(size);
+        for(unsigned i = 0; i < size; ++i)
+            instances.push_back(phreeqc.replicate());
+
+        // All instances are available, with the first one taken first
+        for(unsigned i = 0; i < size; ++i)
+            available.push_back(size - 1 - i);
+    }
+
+    // Evaluate a function with a Phreeqc instance taken from the pool for the duration of the call
+    template<typename Function>
+    auto evaluate(const Function& f) -> void
+    {
+        // A Phreeqc instance taken from the pool and returned to it on destruction, even if an exception is thrown
+        struct Lease
+        {
+            Impl& pool;
+            Index i;
+
+            Lease(Impl& pool) : pool(pool)
+            {
+                std::unique_lock<std::mutex> lock(pool.mutex);
+                pool.returned.wait(lock, [&]() { return !pool.available.empty(); });
+                i = pool.available.back();
+                pool.available.pop_back();
+            }
+
+            ~Lease()
+            {
+                {
+                    std::lock_guard<std::mutex> lock(pool.mutex);
+                    pool.available.push_back(i);
+                }
+                pool.returned.notify_one();
+            }
+        };
+
+        Lease lease(*this);
+        f(instances[lease.i]);
+    }
+};
+
+PhreeqcPool::PhreeqcPool(const Phreeqc& phreeqc, unsigned size)
+: pimpl(new Impl(phreeqc, size))
+{}
+
+PhreeqcPool::~PhreeqcPool()
+{}
+
+auto PhreeqcPool::size() const -> unsigned
+{
+    return pimpl->instances.size();
+}
+
+auto PhreeqcPool::temperature() const -> double
+{
+    return pimpl->T;
+}
+
+auto PhreeqcPool::pressure() const -> double
+{
+    return pimpl->P;
+}
+
+auto PhreeqcPool::speciesAmounts() const -> Vector
+{
+    return pimpl->n;
+}
+
+auto PhreeqcPool::numElements() const -> unsigned
+{
+    return pimpl->instances.front().numElements();
+}
+
+auto PhreeqcPool::numSpecies() const -> unsigned
+{
+    return pimpl->instances.front().numSpecies();
+}
+
+auto PhreeqcPool::numPhases() const -> unsigned
+{
+    return pimpl->instances.front().numPhases();
+}
+
+auto PhreeqcPool::numSpeciesInPhase(Index iphase) const -> unsigned
+{
+    return pimpl->instances.front().numSpeciesInPhase(iphase);
+}
+
+auto PhreeqcPool::elementName(Index ielement) const -> std::string
+{
+    return pimpl->instances.front().elementName(ielement);
+}
+
+auto PhreeqcPool::elementMolarMass(Index ielement) const -> double
+{
+    return pimpl->instances.front().elementMolarMass(ielement);
+}
+
+auto PhreeqcPool::elementStoichiometry(Index ispecies, Index ielement) const -> double
+{
+    return pimpl->instances.front().elementStoichiometry(ispecies, ielement);
+}
+
+auto PhreeqcPool::speciesName(Index ispecies) const -> std::string
+{
+    return pimpl->instances.front().speciesName(ispecies);
+}
+
+auto PhreeqcPool::phaseName(Index iphase) const -> std::string
+{
+    return pimpl->instances.front().phaseName(iphase);
+}
+
+auto PhreeqcPool::properties(ThermoModelResult& res, double T, double P) -> void
+{
+    pimpl->evaluate([&](Phreeqc& phreeqc) { phreeqc.properties(res, T, P); });
+}
+
+auto PhreeqcPool::properties(ChemicalModelResult& res, double T, double P, VectorConstRef n) -> void
+{
+    pimpl->evaluate([&](Phreeqc& phreeqc) { phreeqc.properties(res, T, P, n); });
+}
+
+auto PhreeqcPool::clone() const -> std::shared_ptr<Interface>
+{
+    return std::make_shared<PhreeqcPool>(*this);
+}
+
+} // namespace Reaktoro
@@ -0,0 +1,113 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright (C) 2014-2018 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+// Reaktoro includes
+#include <Reaktoro/Interfaces/Interface.hpp>
+
+namespace Reaktoro {
+
+// Forward declarations
+class Phreeqc;
+
+/// A pool of independent Phreeqc instances for thread-parallel calculations.
+/// A Phreeqc instance wraps a single low-level PHREEQC instance, which cannot be
+/// used by more than one thread at a time. A PhreeqcPool owns a given number of
+/// independent Phreeqc instances, all in the same state. Every evaluation of
+/// properties takes an available instance from the pool and returns it when it
+/// finishes, waiting for one if all of them are in use. A ChemicalSystem created
+/// from a PhreeqcPool can thus be used concurrently by any number of threads, with
+/// up to @ref size of them evaluating properties at the same time.
+/// ~~~{.cpp}
+/// Phreeqc phreeqc("phreeqc.dat");
+/// phreeqc.execute("script.pqi");
+/// PhreeqcPool pool(phreeqc, 8);
+/// ChemicalSystem system = pool;
+/// ~~~
+/// @see Phreeqc::replicate
+class PhreeqcPool : public Interface
+{
+public:
+    /// Construct a PhreeqcPool instance with given Phreeqc instance and number of replicas.
+    /// @param phreeqc The Phreeqc instance, already loaded with a database and input script
+    /// @param size The number of independent Phreeqc instances in the pool
+    PhreeqcPool(const Phreeqc& phreeqc, unsigned size);
+
+    /// Destroy this PhreeqcPool instance
+    virtual ~PhreeqcPool();
+
+    /// Return the number of independent Phreeqc instances in the pool
+    auto size() const -> unsigned;
+
+    /// Return the temperature of the Phreeqc instance used to create the pool (in units of K)
+    virtual auto temperature() const -> double;
+
+    /// Return the pressure of the Phreeqc instance used to create the pool (in units of Pa)
+    virtual auto pressure() const -> double;
+
+    /// Return the amounts of the species of the Phreeqc instance used to create the pool (in units of mol)
+    virtual auto speciesAmounts() const -> Vector;
+
+    /// Return the number of elements
+    virtual auto numElements() const -> unsigned;
+
+    /// Return the number of species
+    virtual auto numSpecies() const -> unsigned;
+
+    /// Return the number of phases
+    virtual auto numPhases() const -> unsigned;
+
+    /// Return the number of species in a phase
+    virtual auto numSpeciesInPhase(Index iphase) const -> unsigned;
+
+    /// Return the name of an element
+    virtual auto elementName(Index ielement) const -> std::string;
+
+    /// Return the molar mass of an element (in units of kg/mol)
+    virtual auto elementMolarMass(Index ielement) const -> double;
+
+    /// Return the stoichiometry of an element in a species
+    virtual auto elementStoichiometry(Index ispecies, Index ielement) const -> double;
+
+    /// Return the name of a species
+    virtual auto speciesName(Index ispecies) const -> std::string;
+
+    /// Return the name of a phase
+    virtual auto phaseName(Index iphase) const -> std::string;
+
+    /// Return the thermodynamic properties of the phases and its species.
+    /// @param T The temperature (in units of K)
+    /// @param P The pressure (in units of Pa)
+    virtual auto properties(ThermoModelResult& res, double T, double P) -> void;
+
+    /// Return the chemical properties of the phases and its species.
+    /// @param T The temperature (in units of K)
+    /// @param P The pressure (in units of Pa)
+    /// @param n The amounts of the species (in units of mol)
+    virtual auto properties(ChemicalModelResult& res, double T, double P, VectorConstRef n) -> void;
+
+    /// Return a clone of this PhreeqcPool instance, sharing the same pool of Phreeqc instances
+    virtual auto clone() const -> std::shared_ptr<Interface>;
+
+private:
+    struct Impl;
+
+    std::shared_ptr<Impl> pimpl;
+};
+
+} // namespace Reaktoro
@@ -24,7 +24,9 @@ using namespace std::placeholders;
 // Reaktoro includes
 #include <Reaktoro/Common/ChemicalVector.hpp>
 #include <Reaktoro/Common/Exception.hpp>
+#include <Reaktoro/Common/Profiling.hpp>
 #include <Reaktoro/Math/Matrix.hpp>
+#include <Reaktoro/Math/SparseMatrix.hpp>
 #include <Reaktoro/Common/StringUtils.hpp>
 #include <Reaktoro/Common/Units.hpp>
 #include <Reaktoro/Core/ChemicalProperties.hpp>
@@ -77,8 +79,8 @@ struct KineticSolver::Impl
     /// The number of elements in the equilibrium and kinetic partition
     Index Ee, Ek;
 
-    /// The formula matrix of the equilibrium species
-    Matrix Ae;
+    /// The formula matrix of the equilibrium species in sparse storage
+    SparseMatrix Ae;
 
     /// The stoichiometric matrix w.r.t. the equilibrium species
     Matrix Se;
@@ -168,7 +170,7 @@ struct KineticSolver::Impl
         Ek = ike.size();
 
         // Initialise the formula matrix of the equilibrium partition
-        Ae = partition.formulaMatrixEquilibriumPartition();
+        Ae = partition.formulaMatrixEquilibriumPartitionSparse();
 
         // Initialise the stoichiometric matrices w.r.t. the equilibrium and kinetic species
         Se = cols(reactions.stoichiometricMatrix(), ies);
@@ -176,7 +178,7 @@ struct KineticSolver::Impl
 
         // Initialise the coefficient matrix `A` of the kinetic rates
         A.resize(Ee + Nk, reactions.numReactions());
-        A.topRows(Ee) = Ae * tr(Se);
+        multiplyTransposeRight(Ae, Se, A.topRows(Ee));
         A.bottomRows(Nk) = tr(Sk);
 
         // Auxiliary identity matrix
@@ -292,7 +294,7 @@ struct KineticSolver::Impl
 
         // Assemble the vector benk = [be nk]
         benk.resize(Ee + Nk);
-        benk.head(Ee) = Ae * ne;
+        multiply(Ae, ne, benk.head(Ee));
         benk.tail(Nk) = nk;
 
         // Define the ODE function
@@ -340,7 +342,7 @@ struct KineticSolver::Impl
         nk = n(iks);
 
         // Assemble the vector benk = [be nk]
-        benk.head(Ee) = Ae * ne;
+        multiply(Ae, ne, benk.head(Ee));
         benk.tail(Nk) = nk;
 
         // Perform one ODE step integration
@@ -380,6 +382,8 @@ struct KineticSolver::Impl
 
     auto function(ChemicalState& state, double t, VectorConstRef u, VectorRef res) -> int
     {
+        ProfilerScope("KineticSolver::function");
+
         // Extract the `be` and `nk` entries of the vector [be, nk]
         be = u.head(Ee);
         nk = u.tail(Nk);
@@ -431,6 +435,8 @@ struct KineticSolver::Impl
 
     auto jacobian(ChemicalState& state, double t, VectorConstRef u, MatrixRef res) -> int
     {
+        ProfilerScope("KineticSolver::jacobian");
+
         // Calculate the sensitivity of the equilibrium state
         sensitivity = equilibrium.sensitivity();
 
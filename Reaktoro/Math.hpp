@@ -17,11 +17,14 @@
 
 #pragma once
 
+#include <Reaktoro/Math/BicubicInterpolator.hpp>
 #include <Reaktoro/Math/BilinearInterpolator.hpp>
 #include <Reaktoro/Math/Derivatives.hpp>
+#include <Reaktoro/Math/FixedSizeLU.hpp>
 #include <Reaktoro/Math/LagrangeInterpolator.hpp>
 #include <Reaktoro/Math/LU.hpp>
 #include <Reaktoro/Math/MathUtils.hpp>
 #include <Reaktoro/Math/Matrix.hpp>
 #include <Reaktoro/Math/ODE.hpp>
 #include <Reaktoro/Math/Roots.hpp>
+#include <Reaktoro/Math/SparseMatrix.hpp>
@@ -0,0 +1,188 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright (C) 2014-2018 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+#include "BicubicInterpolator.hpp"
+
+// C++ includes
+#include <algorithm>
+
+// Reaktoro includes
+#include <Reaktoro/Common/Exception.hpp>
+
+namespace Reaktoro {
+namespace {
+
+/// The weights of the cubic Hermite basis functions along one coordinate direction.
+struct HermiteWeights
+{
+    /// The index of the first point of the interval containing the coordinate
+    unsigned i = 0;
+
+    /// The number of points used in the interpolation (one if there is only one coordinate)
+    unsigned npoints = 1;
+
+    /// The weights of the values and slopes at the interval points
+    double v[2] = {}, s[2] = {};
+
+    /// The derivatives of the weights of the values and slopes with respect to the coordinate
+    double dv[2] = {}, ds[2] = {};
+};
+
+auto hermiteWeights(double x, const std::vector<double>& coordinates) -> HermiteWeights
+{
+    HermiteWeights w;
+
+    // With a single coordinate, use the value and the slope of the data at it
+    if(coordinates.size() == 1)
+    {
+        w.v[0] = 1.0;
+        w.ds[0] = 1.0;
+        return w;
+    }
+
+    x = std::max(coordinates.front(), std::min(x, coordinates.back()));
+
+    const unsigned size = coordinates.size();
+    const unsigned i = std::upper_bound(coordinates.begin(), coordinates.end(), x) - coordinates.begin();
+
+    w.i = std::min(std::max(i, 1u), size - 1) - 1;
+    w.npoints = 2;
+
+    const double h = coordinates[w.i + 1] - coordinates[w.i];
+    const double t = (x - coordinates[w.i])/h;
+    const double t2 = t*t;
+    const double t3 = t*t2;
+
+    w.v[0] =  2*t3 - 3*t2 + 1;
+    w.v[1] = -2*t3 + 3*t2;
+    w.s[0] = (t3 - 2*t2 + t)*h;
+    w.s[1] = (t3 - t2)*h;
+
+    w.dv[0] = (6*t2 - 6*t)/h;
+    w.dv[1] = (6*t - 6*t2)/h;
+    w.ds[0] = 3*t2 - 4*t + 1;
+    w.ds[1] = 3*t2 - 2*t;
+
+    return w;
+}
+
+} // namespace
+
+BicubicInterpolator::BicubicInterpolator()
+{}
+
+BicubicInterpolator::BicubicInterpolator(
+    const std::vector<double>& xcoordinates,
+    const std::vector<double>& ycoordinates,
+    const std::vector<double>& data,
+    const std::vector<double>& ddx,
+    const std::vector<double>& ddy)
+: m_xcoordinates(xcoordinates),
+  m_ycoordinates(ycoordinates),
+  m_data(data),
+  m_ddx(ddx),
+  m_ddy(ddy),
+  m_ddxy(data.size())
+{
+    const unsigned sizex = xcoordinates.size();
+    const unsigned sizey = ycoordinates.size();
+
+    Assert(data.size() == sizex * sizey && ddx.size() == data.size() && ddy.size() == data.size(),
+        "Cannot initialize the bicubic interpolator.",
+        "The number of data values or derivatives does not match the number of (x, y) points.");
+
+    const auto k = [=](unsigned i, unsigned j) { return i + j*sizex; };
+
+    // Estimate the mixed derivatives with finite differences of the partial derivatives
+    for(unsigned j = 0; j < sizey; ++j)
+    {
+        for(unsigned i = 0; i < sizex; ++i)
+        {
+            const unsigned im = i > 0 ? i - 1 : i;
+            const unsigned ip = i + 1 < sizex ? i + 1 : i;
+            const unsigned jm = j > 0 ? j - 1 : j;
+            const unsigned jp = j + 1 < sizey ? j + 1 : j;
+
+            const double ddy_ddx = (ip != im) ? (ddy[k(ip, j)] - ddy[k(im, j)])/(xcoordinates[ip] - xcoordinates[im]) : 0.0;
+            const double ddx_ddy = (jp != jm) ? (ddx[k(i, jp)] - ddx[k(i, jm)])/(ycoordinates[jp] - ycoordinates[jm]) : 0.0;
+
+            m_ddxy[k(i, j)] = 0.5*(ddy_ddx + ddx_ddy);
+        }
+    }
+}
+
+auto BicubicInterpolator::xCoordinates() const -> const std::vector<double>&
+{
+    return m_xcoordinates;
+}
+
+auto BicubicInterpolator::yCoordinates() const -> const std::vector<double>&
+{
+    return m_ycoordinates;
+}
+
+auto BicubicInterpolator::data() const -> const std::vector<double>&
+{
+    return m_data;
+}
+
+auto BicubicInterpolator::empty() const -> bool
+{
+    return m_data.empty();
+}
+
+auto BicubicInterpolator::operator()(double x, double y) const -> double
+{
+    double ddx, ddy;
+    return (*this)(x, y, ddx, ddy);
+}
+
+auto BicubicInterpolator::operator()(double x, double y, double& ddx, double& ddy) const -> double
+{
+    Assert(!empty(), "Cannot perform the bicubic interpolation.",
+        "The interpolator has not been initialized with data.");
+
+    const HermiteWeights wx = hermiteWeights(x, m_xcoordinates);
+    const HermiteWeights wy = hermiteWeights(y, m_ycoordinates);
+
+    const unsigned sizex = m_xcoordinates.size();
+
+    double val = 0.0;
+    ddx = 0.0;
+    ddy = 0.0;
+
+    for(unsigned b = 0; b < wy.npoints; ++b)
+    {
+        for(unsigned a = 0; a < wx.npoints; ++a)
+        {
+            const unsigned k = (wx.i + a) + (wy.i + b)*sizex;
+
+            const double f   = m_data[k];
+            const double fx  = m_ddx[k];
+            const double fy  = m_ddy[k];
+            const double fxy = m_ddxy[k];
+
+            val += (f*wx.v[a]  + fx*wx.s[a])*wy.v[b]  + (fy*wx.v[a]  + fxy*wx.s[a])*wy.s[b];
+            ddx += (f*wx.dv[a] + fx*wx.ds[a])*wy.v[b] + (fy*wx.dv[a] + fxy*wx.ds[a])*wy.s[b];
+            ddy += (f*wx.v[a]  + fx*wx.s[a])*wy.dv[b] + (fy*wx.v[a]  + fxy*wx.s[a])*wy.ds[b];
+        }
+    }
+
+    return val;
+}
+
+} // namespace Reaktoro
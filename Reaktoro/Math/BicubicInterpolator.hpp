@@ -0,0 +1,86 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright (C) 2014-2018 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+// C++ includes
+#include <vector>
+
+namespace Reaktoro {
+
+/// A class used to calculate bicubic Hermite interpolation of data in two dimensions.
+/// The interpolation uses the values of the data and of its partial derivatives at every
+/// (x, y) point. The resulting interpolant is continuously differentiable, and its
+/// partial derivatives are calculated analytically. The mixed derivatives at the points
+/// are estimated with finite differences of the given partial derivatives.
+class BicubicInterpolator
+{
+public:
+    /// Construct a default BicubicInterpolator instance
+    BicubicInterpolator();
+
+    /// Construct a BicubicInterpolator instance with given data
+    /// @param xcoordinates The x-coordinates for the interpolation
+    /// @param ycoordinates The y-coordinates for the interpolation
+    /// @param data The data to be interpolated over the (x, y) coordinates
+    /// @param ddx The partial derivatives of the data with respect to x
+    /// @param ddy The partial derivatives of the data with respect to y
+    BicubicInterpolator(
+        const std::vector<double>& xcoordinates,
+        const std::vector<double>& ycoordinates,
+        const std::vector<double>& data,
+        const std::vector<double>& ddx,
+        const std::vector<double>& ddy);
+
+    /// Return the x-coordinates of the interpolation
+    auto xCoordinates() const -> const std::vector<double>&;
+
+    /// Return the y-coordinates of the interpolation
+    auto yCoordinates() const -> const std::vector<double>&;
+
+    /// Return the interpolation data
+    auto data() const -> const std::vector<double>&;
+
+    /// Check if the BicubicInterpolator instance is empty
+    auto empty() const -> bool;
+
+    /// Calculate the interpolation at the provided (x, y) point
+    /// @param x The x-coordinate of the point
+    /// @param y The y-coordinate of the point
+    /// @return The interpolation of the data at (x, y) point
+    auto operator()(double x, double y) const -> double;
+
+    /// Calculate the interpolation and its partial derivatives at the provided (x, y) point
+    /// @param x The x-coordinate of the point
+    /// @param y The y-coordinate of the point
+    /// @param[out] ddx The partial derivative of the interpolation with respect to x
+    /// @param[out] ddy The partial derivative of the interpolation with respect to y
+    /// @return The interpolation of the data at (x, y) point
+    auto operator()(double x, double y, double& ddx, double& ddy) const -> double;
+
+private:
+    /// The coordinates of the x and y points
+    std::vector<double> m_xcoordinates, m_ycoordinates;
+
+    /// The interpolated data on every (x, y) point
+    std::vector<double> m_data;
+
+    /// The partial derivatives of the data with respect to x, y, and both x and y on every (x, y) point
+    std::vector<double> m_ddx, m_ddy, m_ddxy;
+};
+
+} // namespace Reaktoro
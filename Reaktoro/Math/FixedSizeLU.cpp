@@ -0,0 +1,201 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright (C) 2014-2018 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+#include "FixedSizeLU.hpp"
+
+// C++ includes
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <utility>
+
+// Reaktoro includes
+#include <Reaktoro/Common/Exception.hpp>
+
+namespace Reaktoro {
+namespace {
+
+/// The type of the functions that decompose a matrix with a fixed-size kernel.
+using FixedDecomposeFunction = void(*)(MatrixConstRef, Matrix&, VectorXi&);
+
+/// The type of the functions that solve a linear system with a fixed-size kernel.
+using FixedSolveFunction = void(*)(const Matrix&, const VectorXi&, VectorConstRef, Vector&);
+
+/// Decompose a matrix with dimension `Dim` using stack-allocated matrices.
+/// The loops have compile-time bounds, so that they are unrolled and vectorized.
+template<int Dim>
+auto decomposeFixed(MatrixConstRef A, Matrix& LU, VectorXi& P) -> void
+{
+    Eigen::Matrix<double, Dim, Dim> M = A;
+    int rows[Dim];
+    for(int i = 0; i < Dim; ++i)
+        rows[i] = i;
+    for(int k = 0; k < Dim; ++k)
+    {
+        // Find the pivot of the k-th column and move it to the diagonal
+        int ipivot = k;
+        for(int i = k + 1; i < Dim; ++i)
+            if(std::abs(M(i, k)) > std::abs(M(ipivot, k)))
+                ipivot = i;
+        if(ipivot != k)
+        {
+            M.row(k).swap(M.row(ipivot));
+            std::swap(rows[k], rows[ipivot]);
+        }
+
+        // Skip the elimination of a zero column, as PartialPivLU does for singular matrices
+        if(M(k, k) == 0.0)
+            continue;
+
+        const double inv = 1.0/M(k, k);
+        for(int i = k + 1; i < Dim; ++i)
+            M(i, k) *= inv;
+        for(int j = k + 1; j < Dim; ++j)
+            for(int i = k + 1; i < Dim; ++i)
+                M(i, j) -= M(i, k)*M(k, j);
+    }
+    LU = M;
+    P.resize(Dim);
+    for(int i = 0; i < Dim; ++i)
+        P[rows[i]] = i;
+}
+
+/// Solve a linear system with dimension `Dim` using stack-allocated vectors.
+template<int Dim>
+auto solveFixed(const Matrix& LU, const VectorXi& P, VectorConstRef b, Vector& x) -> void
+{
+    const double* lu = LU.data();
+    double y[Dim];
+    for(int i = 0; i < Dim; ++i)
+        y[P[i]] = b[i];
+    for(int j = 0; j < Dim; ++j)
+        for(int i = j + 1; i < Dim; ++i)
+            y[i] -= lu[i + j*Dim]*y[j];
+    for(int j = Dim - 1; j >= 0; --j)
+    {
+        y[j] /= lu[j + j*Dim];
+        for(int i = 0; i < j; ++i)
+            y[i] -= lu[i + j*Dim]*y[j];
+    }
+    x.resize(Dim);
+    for(int i = 0; i < Dim; ++i)
+        x[i] = y[i];
+}
+
+/// Return the table of fixed-size decomposition kernels, in which entry `i` handles dimension `i + 1`.
+template<int... Dims>
+auto fixedDecomposeFunctions(std::integer_sequence<int, Dims...>) -> std::array<FixedDecomposeFunction, sizeof...(Dims)>
+{
+    return {{ &decomposeFixed<Dims + 1>... }};
+}
+
+/// Return the table of fixed-size solve kernels, in which entry `i` handles dimension `i + 1`.
+template<int... Dims>
+auto fixedSolveFunctions(std::integer_sequence<int, Dims...>) -> std::array<FixedSolveFunction, sizeof...(Dims)>
+{
+    return {{ &solveFixed<Dims + 1>... }};
+}
+
+/// The fixed-size kernels for all dimensions from 1 to `FixedSizeLU::max_fixed_size`.
+const auto fixed_decompose_functions = fixedDecomposeFunctions(std::make_integer_sequence<int, FixedSizeLU::max_fixed_size>());
+const auto fixed_solve_functions = fixedSolveFunctions(std::make_integer_sequence<int, FixedSizeLU::max_fixed_size>());
+
+} // namespace
+
+const Index FixedSizeLU::max_fixed_size;
+const Index FixedSizeLU::default_threshold;
+
+FixedSizeLU::FixedSizeLU()
+{}
+
+FixedSizeLU::FixedSizeLU(MatrixConstRef A)
+{
+    compute(A);
+}
+
+auto FixedSizeLU::compute(MatrixConstRef A) -> void
+{
+    Assert(A.rows() == A.cols(),
+        "Cannot compute the LU decomposition of the matrix.",
+        "The matrix is not square.");
+
+    const Index n = A.rows();
+
+    kernel = n && n <= std::min(threshold, max_fixed_size);
+
+    if(n == 0)
+    {
+        LU.resize(0, 0);
+        P.resize(0);
+        return;
+    }
+
+    // Use the fixed-size kernel precompiled for the dimension of the matrix, if below the threshold
+    if(kernel)
+    {
+        fixed_decompose_functions[n - 1](A, LU, P);
+        return;
+    }
+
+    // Otherwise, decompose the matrix using the dynamic-size algorithm
+    dynamic.compute(A);
+    LU = dynamic.matrixLU();
+    P = dynamic.permutationP().indices();
+}
+
+auto FixedSizeLU::solve(VectorConstRef b) -> const Vector&
+{
+    const Index n = LU.rows();
+
+    Assert(b.rows() == static_cast<long>(n),
+        "Cannot solve the linear system with the LU decomposition.",
+        "The dimension of the right-hand side vector does not match the decomposed matrix.");
+
+    if(n == 0)
+    {
+        x.resize(0);
+        return x;
+    }
+
+    // Use the fixed-size kernel that decomposed the matrix, if any
+    if(fixed())
+    {
+        fixed_solve_functions[n - 1](LU, P, b, x);
+        return x;
+    }
+
+    // Otherwise, use the dynamic-size algorithm
+    x.noalias() = dynamic.solve(b);
+    return x;
+}
+
+auto FixedSizeLU::rows() const -> Index
+{
+    return LU.rows();
+}
+
+auto FixedSizeLU::cols() const -> Index
+{
+    return LU.cols();
+}
+
+auto FixedSizeLU::fixed() const -> bool
+{
+    return kernel;
+}
+
+} // namespace Reaktoro
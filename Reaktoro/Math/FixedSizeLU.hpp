@@ -0,0 +1,84 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright (C) 2014-2018 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+// Eigen includes
+#include <Reaktoro/Math/Eigen/LU>
+
+// Reaktoro includes
+#include <Reaktoro/Common/Index.hpp>
+#include <Reaktoro/Math/Matrix.hpp>
+
+namespace Reaktoro {
+
+/// The class that computes the partial pivoting LU decomposition of small matrices with fixed-size kernels.
+/// Matrices with dimension up to `threshold` are copied to stack-allocated, fixed-size Eigen matrices
+/// and decomposed with kernels precompiled for each of these dimensions, selected at runtime.
+/// Larger matrices are decomposed with the dynamic-size `Eigen::PartialPivLU` algorithm.
+/// The fixed-size kernels are faster only for small matrices (see demo-kktsolver-fixed-size-lu).
+struct FixedSizeLU
+{
+    /// The maximum dimension of a matrix for which fixed-size kernels are precompiled.
+    static const Index max_fixed_size = 16;
+
+    /// The default maximum dimension of a matrix decomposed with fixed-size kernels.
+    static const Index default_threshold = max_fixed_size;
+
+    /// Construct a default FixedSizeLU instance.
+    FixedSizeLU();
+
+    /// Construct a FixedSizeLU instance with given square matrix.
+    explicit FixedSizeLU(MatrixConstRef A);
+
+    /// Compute the LU decomposition of the given square matrix.
+    auto compute(MatrixConstRef A) -> void;
+
+    /// Solve the linear system `Ax = b` using the calculated LU decomposition.
+    auto solve(VectorConstRef b) -> const Vector&;
+
+    /// Return the number of rows of the decomposed matrix.
+    auto rows() const -> Index;
+
+    /// Return the number of columns of the decomposed matrix.
+    auto cols() const -> Index;
+
+    /// Return true if the last decomposition was performed with a fixed-size kernel.
+    auto fixed() const -> bool;
+
+    /// The matrix with the unit lower triangular factor `L` and the upper triangular factor `U` of `PA = LU`.
+    Matrix LU;
+
+    /// The row permutation indices of the permutation matrix `P` in `PA = LU`.
+    VectorXi P;
+
+    /// The solution of the last linear system.
+    Vector x;
+
+    /// The maximum dimension of a matrix decomposed with fixed-size kernels (zero to disable them).
+    /// Values above `max_fixed_size` are equivalent to `max_fixed_size`.
+    Index threshold = default_threshold;
+
+private:
+    /// The flag that indicates if the last decomposition was performed with a fixed-size kernel.
+    bool kernel = false;
+
+    /// The dynamic-size LU decomposition of the matrices with dimension above the threshold.
+    Eigen::PartialPivLU<Matrix> dynamic;
+};
+
+} // namespace Reaktoro
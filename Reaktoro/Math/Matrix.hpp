@@ -47,6 +47,10 @@ using MatrixConstRef = Eigen::Ref<const Eigen::MatrixXd>; ///< Alias to Eigen ty
 using MatrixMap      = Eigen::Map<Eigen::MatrixXd>;       ///< Alias to Eigen type Map<MatrixXd>.
 using MatrixConstMap = Eigen::Map<const Eigen::MatrixXd>; ///< Alias to Eigen type Map<const MatrixXd>.
 
+using MatrixRowMajor         = Eigen::Matrix<double, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor>; ///< Alias to a dynamic Eigen matrix with row-major storage.
+using MatrixRowMajorRef      = Eigen::Ref<MatrixRowMajor>;                                             ///< Alias to Eigen type Ref<MatrixRowMajor>.
+using MatrixRowMajorConstRef = Eigen::Ref<const MatrixRowMajor>;                                       ///< Alias to Eigen type Ref<const MatrixRowMajor>.
+
 using Vector = Eigen::VectorXd; /// Alias to Eigen type Eigen::VectorXd.
 using VectorXd = Eigen::VectorXd; /// Alias to Eigen type Eigen::VectorXd.
 using VectorXi = Eigen::VectorXi; /// Alias to Eigen type Eigen::VectorXi.
@@ -117,4 +117,30 @@ auto newton(const std::function<void(VectorConstRef, VectorRef, MatrixRef)>& f,
     return x;
 }
 
+auto newtonCubic(VectorConstRef a, VectorConstRef b, VectorConstRef c, VectorRef x, double epsilon, unsigned maxiter) -> void
+{
+    Assert(epsilon > 0.0, "Could not start Newton's method with given parameter.",
+        "Expecting a positive tolerance parameter.");
+    Assert(maxiter > 0, "Could not start Newton's method with given parameter.",
+        "Expecting a positive maximum number of iterations.");
+    Assert(a.rows() == x.rows() && b.rows() == x.rows() && c.rows() == x.rows(),
+        "Could not start Newton's method with given parameter.",
+        "Expecting coefficient vectors with the same dimension of the initial guesses.");
+    const Index n = x.rows();
+    Eigen::ArrayXd fx(n), dfx(n);
+    Eigen::Array<bool, Eigen::Dynamic, 1> converged = Eigen::Array<bool, Eigen::Dynamic, 1>::Constant(n, false);
+    for(unsigned i = 0; i < maxiter; ++i)
+    {
+        const auto xa = x.array();
+        fx = xa*xa*xa + a.array()*xa*xa + b.array()*xa + c.array();
+        dfx = 3*xa*xa + 2*a.array()*xa + b.array();
+        x = converged.select(xa, xa - fx/dfx).matrix();
+        converged = converged || (fx.abs() < epsilon);
+        if(converged.all())
+            return;
+    }
+    RuntimeError("Could not find the roots of the given cubic equations.",
+        "The maximum number of iterations " + std::to_string(maxiter) + " was achieved.");
+}
+
 } // namespace Reaktoro
@@ -60,4 +60,17 @@ auto newton(const std::function<std::tuple<double,double>(double)>& f,
 auto newton(const std::function<void(VectorConstRef, VectorRef, MatrixRef)>& f,
             VectorConstRef x0, double epsilon, unsigned maxiter) -> Vector;
 
+/// Calculate a real root of each cubic equation in a batch using Newton's method.
+/// The cubic equations are \f$ x^{3}+a_{k}x^{2}+b_{k}x+c_{k}=0 \f$, one for each entry @c k
+/// of the coefficient vectors. All equations are iterated together over contiguous arrays,
+/// and each one stops being updated once it has converged. Every equation therefore follows the
+/// same iterates as the scalar Newton's method started from the same initial guess.
+/// @param a The coefficients @c a of the cubic equations
+/// @param b The coefficients @c b of the cubic equations
+/// @param c The coefficients @c c of the cubic equations
+/// @param[in,out] x The initial guesses on input and the calculated roots on output
+/// @param epsilon The tolerance used in \f$ |f(x)| < \epsilon \f$ to check convergence.
+/// @param maxiter The maximum number of iterations.
+auto newtonCubic(VectorConstRef a, VectorConstRef b, VectorConstRef c, VectorRef x, double epsilon, unsigned maxiter) -> void;
+
 } // namespace Reaktoro
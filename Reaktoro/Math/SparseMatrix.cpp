@@ -0,0 +1,126 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright (C) 2014-2018 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+#include "SparseMatrix.hpp"
+
+// C++ includes
+#include <vector>
+
+namespace Reaktoro {
+
+auto sparse(MatrixConstRef A) -> SparseMatrix
+{
+    std::vector<Eigen::Triplet<double>> triplets;
+    for(Index j = 0; j < A.cols(); ++j)
+        for(Index i = 0; i < A.rows(); ++i)
+            if(A(i, j) != 0.0)
+                triplets.emplace_back(i, j, A(i, j));
+    SparseMatrix res(A.rows(), A.cols());
+    res.setFromTriplets(triplets.begin(), triplets.end());
+    res.makeCompressed();
+    return res;
+}
+
+auto multiply(const SparseMatrix& A, VectorConstRef x, VectorRef y) -> void
+{
+    const auto* outer = A.outerIndexPtr();
+    const auto* inner = A.innerIndexPtr();
+    const auto* values = A.valuePtr();
+    y.setZero();
+    for(Index j = 0; j < A.outerSize(); ++j)
+    {
+        const double xj = x[j];
+        for(auto k = outer[j]; k < outer[j + 1]; ++k)
+            y[inner[k]] += values[k] * xj;
+    }
+}
+
+auto multiplyColumns(const SparseMatrix& A, const Indices& icols, VectorConstRef x, VectorRef y) -> void
+{
+    const auto* outer = A.outerIndexPtr();
+    const auto* inner = A.innerIndexPtr();
+    const auto* values = A.valuePtr();
+    y.setZero();
+    for(Index j : icols)
+    {
+        const double xj = x[j];
+        for(auto k = outer[j]; k < outer[j + 1]; ++k)
+            y[inner[k]] += values[k] * xj;
+    }
+}
+
+auto multiplyColumns(const SparseMatrix& A, Index first, Index size, VectorConstRef x, VectorRef y) -> void
+{
+    const auto* outer = A.outerIndexPtr();
+    const auto* inner = A.innerIndexPtr();
+    const auto* values = A.valuePtr();
+    y.setZero();
+    for(Index j = 0; j < size; ++j)
+    {
+        const double xj = x[j];
+        for(auto k = outer[first + j]; k < outer[first + j + 1]; ++k)
+            y[inner[k]] += values[k] * xj;
+    }
+}
+
+auto multiplyTranspose(const SparseMatrix& A, VectorConstRef x, VectorRef y) -> void
+{
+    const auto* outer = A.outerIndexPtr();
+    const auto* inner = A.innerIndexPtr();
+    const auto* values = A.valuePtr();
+    for(Index j = 0; j < A.outerSize(); ++j)
+    {
+        double sum = 0.0;
+        for(auto k = outer[j]; k < outer[j + 1]; ++k)
+            sum += values[k] * x[inner[k]];
+        y[j] = sum;
+    }
+}
+
+auto multiplyTransposeRight(const SparseMatrix& A, MatrixConstRef B, MatrixRef C) -> void
+{
+    const auto* outer = A.outerIndexPtr();
+    const auto* inner = A.innerIndexPtr();
+    const auto* values = A.valuePtr();
+    C.setZero();
+    for(Index r = 0; r < B.rows(); ++r)
+        for(Index j = 0; j < A.outerSize(); ++j)
+        {
+            const double brj = B(r, j);
+            if(brj == 0.0) continue;
+            for(auto k = outer[j]; k < outer[j + 1]; ++k)
+                C(inner[k], r) += values[k] * brj;
+        }
+}
+
+auto cols(const SparseMatrix& A, const Indices& icols) -> SparseMatrix
+{
+    SparseMatrix res(A.rows(), icols.size());
+    if(icols.empty())
+        return res;
+    Eigen::VectorXi nnz(icols.size());
+    for(Index j = 0; j < icols.size(); ++j)
+        nnz[j] = A.outerIndexPtr()[icols[j] + 1] - A.outerIndexPtr()[icols[j]];
+    res.reserve(nnz);
+    for(Index j = 0; j < icols.size(); ++j)
+        for(SparseMatrix::InnerIterator it(A, icols[j]); it; ++it)
+            res.insert(it.row(), j) = it.value();
+    res.makeCompressed();
+    return res;
+}
+
+} // namespace Reaktoro
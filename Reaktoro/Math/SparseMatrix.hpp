@@ -0,0 +1,77 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright (C) 2014-2018 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+// Eigen includes
+#include <Reaktoro/Math/Eigen/SparseCore>
+
+// Reaktoro includes
+#include <Reaktoro/Common/Index.hpp>
+#include <Reaktoro/Math/Matrix.hpp>
+
+namespace Reaktoro {
+
+/// Alias to Eigen type SparseMatrix<double> in compressed sparse column (CSC) storage.
+/// This type is used to represent formula matrices, in which each species has only
+/// a few non-zero entries corresponding to the elements in its chemical formula.
+using SparseMatrix = Eigen::SparseMatrix<double, Eigen::ColMajor>;
+
+/// Return a sparse matrix with the non-zero entries of a dense matrix.
+/// @param A The dense matrix
+auto sparse(MatrixConstRef A) -> SparseMatrix;
+
+/// Calculate the product `y = A*x` of a sparse matrix and a vector.
+/// @param A The sparse matrix
+/// @param x The vector with as many rows as columns in `A`
+/// @param[out] y The result vector with as many rows as rows in `A`
+auto multiply(const SparseMatrix& A, VectorConstRef x, VectorRef y) -> void;
+
+/// Calculate the product `y = A(:, icols)*x(icols)` using only selected columns of a sparse matrix.
+/// @param A The sparse matrix
+/// @param icols The indices of the selected columns of `A`
+/// @param x The vector with as many rows as columns in `A`
+/// @param[out] y The result vector with as many rows as rows in `A`
+auto multiplyColumns(const SparseMatrix& A, const Indices& icols, VectorConstRef x, VectorRef y) -> void;
+
+/// Calculate the product `y = A(:, first:first+size)*x` using a contiguous range of columns of a sparse matrix.
+/// @param A The sparse matrix
+/// @param first The index of the first column in the range
+/// @param size The number of columns in the range
+/// @param x The vector with `size` rows
+/// @param[out] y The result vector with as many rows as rows in `A`
+auto multiplyColumns(const SparseMatrix& A, Index first, Index size, VectorConstRef x, VectorRef y) -> void;
+
+/// Calculate the product `y = tr(A)*x` of a transposed sparse matrix and a vector.
+/// @param A The sparse matrix
+/// @param x The vector with as many rows as rows in `A`
+/// @param[out] y The result vector with as many rows as columns in `A`
+auto multiplyTranspose(const SparseMatrix& A, VectorConstRef x, VectorRef y) -> void;
+
+/// Calculate the product `C = A*tr(B)` of a sparse matrix and a transposed dense matrix.
+/// This is used, for example, to compute `Ae*tr(Se)`, the element balance of the reactions.
+/// @param A The sparse matrix
+/// @param B The dense matrix with as many columns as columns in `A`
+/// @param[out] C The result matrix with as many rows as rows in `A` and as many columns as rows in `B`
+auto multiplyTransposeRight(const SparseMatrix& A, MatrixConstRef B, MatrixRef C) -> void;
+
+/// Return the sparse matrix with selected columns of another sparse matrix.
+/// @param A The sparse matrix
+/// @param icols The indices of the selected columns
+auto cols(const SparseMatrix& A, const Indices& icols) -> SparseMatrix;
+
+} // namespace Reaktoro
@@ -24,8 +24,10 @@ using namespace Eigen;
 
 // Reaktoro includes
 #include <Reaktoro/Common/Exception.hpp>
+#include <Reaktoro/Common/Profiling.hpp>
 #include <Reaktoro/Common/SetUtils.hpp>
 #include <Reaktoro/Common/TimeUtils.hpp>
+#include <Reaktoro/Math/FixedSizeLU.hpp>
 #include <Reaktoro/Math/MathUtils.hpp>
 
 namespace Reaktoro {
@@ -98,7 +100,7 @@ struct KktSolverRangespaceDiagonal : KktSolverBase
     Vector kkt_rhs, kkt_sol;
     Matrix kkt_lhs;
 
-    PartialPivLU<Matrix> lu;
+    FixedSizeLU lu;
 
     /// Decompose any necessary matrix before the KKT calculation.
     /// Note that this method should be called before `solve`,
@@ -483,7 +485,7 @@ struct KktSolver::Impl
 {
     KktResult result;
     KktOptions options;
-    KktSolverDense<PartialPivLU<Matrix>> kkt_partial_lu;
+    KktSolverDense<FixedSizeLU> kkt_partial_lu;
     KktSolverDense<FullPivLU<Matrix>> kkt_full_lu;
     KktSolverNullspace kkt_nullspace;
     KktSolverRangespaceDiagonal kkt_rangespace_diagonal;
@@ -570,15 +572,19 @@ auto KktSolver::result() const -> const KktResult&
 auto KktSolver::setOptions(const KktOptions& options) -> void
 {
     pimpl->options = options;
+    pimpl->kkt_partial_lu.kkt_lu.threshold = options.fixed_size_threshold;
+    pimpl->kkt_rangespace_diagonal.lu.threshold = options.fixed_size_threshold;
 }
 
 auto KktSolver::decompose(const KktMatrix& lhs) -> void
 {
+    ProfilerScope("KktSolver::decompose");
     pimpl->decompose(lhs);
 }
 
 auto KktSolver::solve(const KktVector& rhs, KktSolution& sol) -> void
 {
+    ProfilerScope("KktSolver::solve");
     pimpl->solve(rhs, sol);
 }
 
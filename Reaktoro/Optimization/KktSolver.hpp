@@ -21,6 +21,7 @@
 #include <memory>
 
 // Reaktoro includes
+#include <Reaktoro/Common/Index.hpp>
 #include <Reaktoro/Math/Matrix.hpp>
 #include <Reaktoro/Optimization/Hessian.hpp>
 
@@ -43,7 +44,8 @@ struct KktResult
 enum class KktMethod
 {
     /// Use a partial pivoting LU algorithm on the full KKT equation.
-    /// This can only be used for dense Hessian matrices.
+    /// This can only be used for dense Hessian matrices. KKT equations
+    /// of small dimension are solved with fixed-size kernels.
     PartialPivLU,
 
     /// Use a full pivoting LU algorithm on the full KKT equation.
@@ -72,6 +74,11 @@ struct KktOptions
 {
     /// The method for the solution of the KKT equations
     KktMethod method = KktMethod::Automatic;
+
+    /// The maximum dimension of the LU decompositions performed with fixed-size kernels (zero to disable them).
+    /// These kernels are precompiled up to dimension 16, and they are used by the `PartialPivLU` and
+    /// rangespace methods. Run demo-kktsolver-fixed-size-lu to compare them with the dynamic-size ones.
+    Index fixed_size_threshold = 16;
 };
 
 /// A type to represent the left-hand side matrix of a KKT equation
@@ -47,6 +47,12 @@ struct NonlinearSolver::Impl
     /// The trial iterate `x`
     Vector xtrial;
 
+    /// The residual vector at the current iterate `x` (used for Broyden updates)
+    Vector Fx;
+
+    /// The Jacobian matrix approximated by Broyden updates (or its inverse if the problem is square)
+    Matrix B;
+
     /// The outputter instance
     Outputter outputter;
 
@@ -73,6 +79,15 @@ struct NonlinearSolver::Impl
         auto& F = residual.val;
         auto& J = residual.jacobian;
 
+        // The non-linear function used for the iterates whose Jacobian matrices are approximated by Broyden updates
+        const auto& fval = problem.fval ? problem.fval : problem.f;
+
+        // The boolean flag that indicates if the Jacobian matrix in the residual was evaluated at the current iterate
+        bool exact = true;
+
+        // The boolean flag that indicates if the last iteration reduced the residual enough to use Broyden updates
+        bool contracting = false;
+
         // Define auxiliary references to general options
         const auto tol = options.tolerance;
         const auto tolx = options.tolerancex;
@@ -144,8 +159,21 @@ struct NonlinearSolver::Impl
             if(!residual.succeeded)
                 return false;
 
+            // Initialize the Broyden approximation from the Jacobian matrix of the current iterate
+            if(options.broyden && exact)
+            {
+                if(n == m)
+                    B = J.lu().inverse();
+                else
+                    B = J;
+            }
+
             // Compute the Newton step `dx`
-            if(n == m)
+            if(options.broyden && n == m)
+                dx = -B*F;
+            else if(options.broyden)
+                dx = -B.jacobiSvd(Eigen::ComputeThinU | Eigen::ComputeThinV).solve(F);
+            else if(n == m)
                 dx = -J.lu().solve(F);
             else
                 dx = -J.jacobiSvd(Eigen::ComputeThinU | Eigen::ComputeThinV).solve(F);
@@ -172,6 +200,16 @@ struct NonlinearSolver::Impl
             // Calculate the slope of the Newton step
             const double slope = tr(F) * dx;
 
+            // Use Broyden updates for the trial iterate only if the last iteration reduced the residual enough
+            const bool approximate = options.broyden && contracting;
+
+            // Store the residual at the current iterate for the Broyden update
+            if(approximate)
+                Fx = F;
+
+            // The boolean flag that indicates if the trial iterate passed the Armijo condition
+            bool accepted = false;
+
             // Repeat until a suitable xtrial iterate if found such that f(xtrial) is finite
             for(; tentatives < 4; ++tentatives)
             {
@@ -179,7 +217,7 @@ struct NonlinearSolver::Impl
                 xtrial = x + alpha*alphax*dx;
 
                 // Evaluate the objective function at the trial iterate
-                residual = problem.f(xtrial);
+                residual = approximate ? fval(xtrial) : problem.f(xtrial);
 
                 // Decrease step length if evaluation of f(xtrial) failed
                 if(!residual.succeeded)
@@ -189,25 +227,64 @@ struct NonlinearSolver::Impl
 
                 // Skip Armijo condition checking if we are in the 1st iteration
                 if(iterations == 1)
-                    break;
+                    { accepted = true; break; }
 
                 // Calculate the new quadratic residual function
                 const double f_new = 0.5 * tr(F) * F;
 
                 // Check if the trial iterate pass the Armijo condition
                 if(f_new <= 0.1*f || f_new <= f + armijo*alpha*alphax*slope + 1e-14*f)
-                    break;
+                    { accepted = true; break; }
 
                 // Decrease alpha in a hope that a shorter step results in f(xtrial) succeeded
                 alpha *= 0.5;
             }
 
+            // Restart from the current iterate with its Jacobian matrix if the Broyden step was not accepted
+            if(approximate && (!accepted || !residual.succeeded))
+            {
+                residual = problem.f(x);
+                error = max(abs(F));
+                exact = true;
+                contracting = false;
+                return residual.succeeded;
+            }
+
+            // Update the Broyden approximation using the secant condition (skipped if nearly singular)
+            if(approximate)
+            {
+                const Vector s = xtrial - x;
+                const Vector y = F - Fx;
+                if(n == m)
+                {
+                    const Vector By = B*y;
+                    const double sBy = dot(s, By);
+                    if(std::abs(sBy) > 1e-14 * norm(s) * norm(By))
+                        B += (s - By) * (tr(s) * B) / sBy;
+                }
+                else
+                {
+                    const double ss = dot(s, s);
+                    if(ss > 0.0)
+                        B += (y - B*s) * tr(s) / ss;
+                }
+            }
+
+            // Update the flag that indicates if the Jacobian matrix was evaluated at the new iterate
+            exact = !approximate;
+
             // Update the iterate x from xtrial
             x = xtrial;
 
+            // The residual error at the previous iterate
+            const double error_old = error;
+
             // Update the residuals of the calculation
             error = max(abs(F));
 
+            // Check if the residual decreased fast enough for Broyden updates to be used in the next iteration
+            contracting = error <= 0.5 * error_old;
+
             // Return true as found xtrial results in finite f(xtrial)
             return true;
         };
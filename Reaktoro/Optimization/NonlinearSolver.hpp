@@ -54,6 +54,11 @@ struct NonlinearProblem
     /// The non-linear residual function.
     NonlinearFunction f;
 
+    /// The non-linear residual function without the evaluation of its Jacobian matrix (optional).
+    /// This is used with Broyden updates (see NonlinearOptions::broyden) to evaluate the iterates
+    /// whose Jacobian matrices are approximated. The function `f` is used if this is left empty.
+    NonlinearFunction fval;
+
     /// The number of unknowns in the non-linear problem.
     Index n;
 
@@ -111,6 +116,12 @@ struct NonlinearOptions
     /// The Armijo parameter used in the backtracking line search algorithm.
     double armijo = 1.0e-4;
 
+    /// The boolean flag that indicates if the Jacobian matrix should be approximated by Broyden updates.
+    /// If true, the Jacobian matrix is evaluated only while the residual decreases by less than a half
+    /// per iteration, or when a step computed with its approximation is not accepted by the line search.
+    /// For square problems, its inverse is updated instead, so that no linear system is factorized.
+    bool broyden = false;
+
     /// The options for the output of the non-linear problem calculation.
     NonlinearOutput output;
 };
@@ -144,6 +144,19 @@ struct OptimumParamsRefiner
     bool use_lma_setup = true;
 };
 
+struct OptimumParamsSimplex
+{
+    /// The maximum number of product-form updates of the basis before it is factorized again.
+    unsigned refactorization_frequency = 50;
+
+    /// The relative magnitude of a pivot below which the basis is factorized again instead of updated.
+    double pivot_tolerance = 1.0e-10;
+
+    /// The flag that indicates if the basis of the last calculation should be tried first
+    /// when the next calculation has the same equality constraint matrix.
+    bool warmstart = true;
+};
+
 /// A type that describes the options for the output of a optimisation calculation
 struct OptimumOutputOptions : OutputterOptions
 {
@@ -230,6 +243,9 @@ struct OptimumOptions
     /// The parameters for the Refiner algorithm
     OptimumParamsRefiner refiner;
 
+    /// The parameters for the Simplex algorithm
+    OptimumParamsSimplex simplex;
+
     /// The regularization options for the optimisation calculation
     OptimumParamsRegularization regularization;
 
@@ -48,6 +48,9 @@ struct OptimumSolver::Impl
     /// The pointer to the optimization solver
     OptimumSolverBase* solver = nullptr;
 
+    /// The optimization method of the current solver
+    OptimumMethod method;
+
     /// The IpFeasible solver for approximation calculation
     OptimumSolverIpFeasible ipfeasible;
 
@@ -81,8 +84,14 @@ struct OptimumSolver::Impl
     // Set the optimization method for the solver
     auto setMethod(OptimumMethod method) -> void
     {
+        // Keep the current simplex solver, and the basis it reuses between calculations, if the method is unchanged
+        if(solver != nullptr && method == OptimumMethod::Simplex && this->method == OptimumMethod::Simplex)
+            return;
+
         if(solver != nullptr) delete solver;
 
+        this->method = method;
+
         switch(method)
         {
         case OptimumMethod::ActNewton:
@@ -24,6 +24,7 @@
 // Reaktoro includes
 #include <Reaktoro/Common/Exception.hpp>
 #include <Reaktoro/Common/Outputter.hpp>
+#include <Reaktoro/Common/Profiling.hpp>
 #include <Reaktoro/Common/SetUtils.hpp>
 #include <Reaktoro/Common/TimeUtils.hpp>
 #include <Reaktoro/Math/MathUtils.hpp>
@@ -420,6 +421,7 @@ auto OptimumSolverActNewton::Impl::solve(const OptimumProblem& problem, OptimumS
 
     do
     {
+        ProfilerScope("OptimumSolverActNewton::iteration");
         ++result.iterations; if(result.iterations > options.max_iterations) break;
         compute_newton_step();
         if(compute_newton_step_failed())
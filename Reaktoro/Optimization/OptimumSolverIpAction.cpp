@@ -23,6 +23,7 @@
 // Reaktoro includes
 #include <Reaktoro/Common/Exception.hpp>
 #include <Reaktoro/Common/Outputter.hpp>
+#include <Reaktoro/Common/Profiling.hpp>
 #include <Reaktoro/Common/SetUtils.hpp>
 #include <Reaktoro/Common/TimeUtils.hpp>
 #include <Reaktoro/Math/LU.hpp>
@@ -508,6 +509,7 @@ struct OptimumSolverIpAction::Impl
 
         for(iterations = 1; iterations <= maxiters && !succeeded; ++iterations)
         {
+            ProfilerScope("OptimumSolverIpAction::iteration");
             if(failed(compute_newton_step_diagonal()))
                 break;
             if(failed(update_iterates()))
@@ -20,6 +20,7 @@
 // Reaktoro includes
 #include <Reaktoro/Common/Exception.hpp>
 #include <Reaktoro/Common/Outputter.hpp>
+#include <Reaktoro/Common/Profiling.hpp>
 #include <Reaktoro/Common/TimeUtils.hpp>
 #include <Reaktoro/Math/MathUtils.hpp>
 #include <Reaktoro/Optimization/KktSolver.hpp>
@@ -400,6 +401,7 @@ struct OptimumSolverIpNewton::Impl
 
         for(iterations = 1; iterations <= maxiters && !succeeded; ++iterations)
         {
+            ProfilerScope("OptimumSolverIpNewton::iteration");
             if(failed(compute_newton_step()))
                 break;
             if(failed(update_iterates()))
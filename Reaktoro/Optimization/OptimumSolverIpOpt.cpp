@@ -20,6 +20,7 @@
 // Reaktoro includes
 #include <Reaktoro/Common/Exception.hpp>
 #include <Reaktoro/Common/Outputter.hpp>
+#include <Reaktoro/Common/Profiling.hpp>
 #include <Reaktoro/Common/TimeUtils.hpp>
 #include <Reaktoro/Math/MathUtils.hpp>
 #include <Reaktoro/Optimization/Filter.hpp>
@@ -460,6 +461,7 @@ struct OptimumSolverIpOpt::Impl
             restart(mu);
 
             do {
+                ProfilerScope("OptimumSolverIpOpt::iteration");
                 update_errors();
                 output_state();
                 if(converged()) break;
@@ -23,6 +23,7 @@
 // Reaktoro includes
 #include <Reaktoro/Common/Exception.hpp>
 #include <Reaktoro/Common/Outputter.hpp>
+#include <Reaktoro/Common/Profiling.hpp>
 #include <Reaktoro/Common/SetUtils.hpp>
 #include <Reaktoro/Common/TimeUtils.hpp>
 #include <Reaktoro/Math/MathUtils.hpp>
@@ -397,6 +398,7 @@ struct OptimumSolverKarpov::Impl
 
             for(; iter < max_iterations; ++iter)
             {
+                ProfilerScope("OptimumSolverKarpov::iteration");
                 calculate_descent_direction();
 
                 solve_line_search_minimization_problem();
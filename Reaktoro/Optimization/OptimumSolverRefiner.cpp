@@ -26,6 +26,7 @@
 // Reaktoro includes
 #include <Reaktoro/Common/Exception.hpp>
 #include <Reaktoro/Common/Outputter.hpp>
+#include <Reaktoro/Common/Profiling.hpp>
 #include <Reaktoro/Common/SetUtils.hpp>
 #include <Reaktoro/Common/TimeUtils.hpp>
 #include <Reaktoro/Math/MathUtils.hpp>
@@ -283,6 +284,7 @@ auto OptimumSolverRefiner::Impl::solve(const OptimumProblem& problem, OptimumSta
 
     do
     {
+        ProfilerScope("OptimumSolverRefiner::iteration");
         ++result.iterations; if(result.iterations > options.max_iterations) break;
 
         if(options.refiner.use_lma_setup)
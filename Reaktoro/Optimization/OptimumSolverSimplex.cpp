@@ -22,6 +22,7 @@
 
 // Reaktoro includes
 #include <Reaktoro/Common/Exception.hpp>
+#include <Reaktoro/Common/Profiling.hpp>
 #include <Reaktoro/Math/Matrix.hpp>
 #include <Reaktoro/Common/SetUtils.hpp>
 #include <Reaktoro/Common/TimeUtils.hpp>
@@ -35,7 +36,7 @@ namespace Reaktoro {
 namespace {
 
 template<typename Decomposition>
-auto solveTranspose(const Decomposition& lu, VectorConstRef b) -> Vector
+auto solveTranspose(const Decomposition& lu, VectorConstRef b, VectorRef x) -> void
 {
     const Matrix& LU = lu.matrixLU();
 
@@ -43,26 +44,23 @@ auto solveTranspose(const Decomposition& lu, VectorConstRef b) -> Vector
     const auto& U = LU.triangularView<Eigen::Upper>();
     const auto& P = lu.permutationP();
 
-    Vector x(b.rows());
-    x = U.transpose().solve(b);
-    x = L.transpose().solve(x);
+    x = b;
+    U.transpose().solveInPlace(x);
+    L.transpose().solveInPlace(x);
     x = P.transpose() * x;
-
-    return x;
 }
 
-inline auto findFirstNegative(VectorConstRef vec) -> Index
+/// Return the local index of the most negative entry `sign*r[i]` for `i` in `indices`, or `indices.size()` if none is negative.
+inline auto findMostNegative(VectorConstRef r, const Indices& indices, double sign) -> Index
 {
-    const Index size = vec.rows();
-    Index i = 0; while(i < size && vec[i] >= 0.0) ++i;
-    return i;
-}
-
-inline auto findMostNegative(VectorConstRef vec) -> Index
-{
-    Index i = 0;
-    if(vec.rows() == 0) return i;
-    else return vec.minCoeff(&i) < 0 ? i : vec.rows();
+    Index imin = indices.size();
+    double rmin = 0.0;
+    for(Index k = 0; k < indices.size(); ++k)
+    {
+        const double val = sign * r[indices[k]];
+        if(val < rmin) { rmin = val; imin = k; }
+    }
+    return imin;
 }
 
 template<typename T>
@@ -71,25 +69,155 @@ inline void erase(const Index& i, std::vector<T>& vec)
     vec.erase(vec.begin() + i);
 }
 
-template<typename T, typename U>
-inline void remove(const U& element, std::vector<T>& vec)
-{
-    std::remove(vec.begin(), vec.end(), element);
-}
-
 } // namespace
 
 struct OptimumSolverSimplex::Impl
 {
+    /// The indices of the basic variables and of the non-basic variables on their lower and upper bounds
     Indices ibasic, ilower, iupper;
 
+    /// The basis matrix assembled at the last refactorization
+    Matrix AB;
+
+    /// The LU decomposition of the basis matrix at the last refactorization
+    Eigen::PartialPivLU<Matrix> lu;
+
+    /// The eta columns of the product-form updates of the basis since the last refactorization
+    Matrix etas;
+
+    /// The basis positions of the pivots of the product-form updates since the last refactorization
+    Indices ipivots;
+
+    /// The workspace vectors for the basic variables, basic costs, reduced costs, step and transformed costs
+    Vector xb, cB, r, t, u;
+
+    /// The equality constraint matrix of the last successful calculation (used for warm-starting)
+    Matrix Alast;
+
+    /// The partitions of the variables at the solution of the last successful calculation (used for warm-starting)
+    Indices ibasic_last, ilower_last, iupper_last;
+
     auto feasible(const OptimumProblem& problem, OptimumState& state, const OptimumOptions& options) -> OptimumResult;
 
     auto simplex(const OptimumProblem& problem, OptimumState& state, const OptimumOptions& options) -> OptimumResult;
 
     auto solve(const OptimumProblem& problem, OptimumState& state, const OptimumOptions& options) -> OptimumResult;
+
+    /// Start from the basis of the last calculation if it is a basic feasible solution of the given problem.
+    auto warmstart(const OptimumProblem& problem, OptimumState& state, const OptimumOptions& options) -> bool;
+
+    /// Compute the LU decomposition of the basis matrix and discard the product-form updates.
+    auto factorize(MatrixConstRef A) -> void;
+
+    /// Replace the basic variable at position `p` of the basis, where `d` is the entering column in terms of the current basis.
+    auto update(MatrixConstRef A, Index p, VectorConstRef d, const OptimumOptions& options) -> void;
+
+    /// Compute `x = inv(B)*a`, with `B` the current basis matrix.
+    auto ftran(VectorConstRef a, VectorRef x) -> void;
+
+    /// Compute `x = inv(tr(B))*a`, with `B` the current basis matrix.
+    auto btran(VectorConstRef a, VectorRef x) -> void;
 };
 
+auto OptimumSolverSimplex::Impl::factorize(MatrixConstRef A) -> void
+{
+    const Index m = A.rows();
+    AB.resize(m, m);
+    for(Index i = 0; i < m; ++i)
+        AB.col(i) = A.col(ibasic[i]);
+    lu.compute(AB);
+    ipivots.clear();
+}
+
+auto OptimumSolverSimplex::Impl::update(MatrixConstRef A, Index p, VectorConstRef d, const OptimumOptions& options) -> void
+{
+    const Index m = A.rows();
+    const Index maxupdates = std::max(options.simplex.refactorization_frequency, 1u);
+
+    // Refactorize the basis if the number of updates is exhausted or the pivot is too small
+    if(ipivots.size() >= maxupdates || std::abs(d[p]) <= options.simplex.pivot_tolerance * d.cwiseAbs().maxCoeff())
+        return factorize(A);
+
+    if(etas.rows() != m || etas.cols() != maxupdates)
+        etas.resize(m, maxupdates);
+
+    etas.col(ipivots.size()) = d;
+    ipivots.push_back(p);
+}
+
+auto OptimumSolverSimplex::Impl::ftran(VectorConstRef a, VectorRef x) -> void
+{
+    x = lu.solve(a);
+
+    // Apply the eta transformations in the order they were created
+    for(Index k = 0; k < ipivots.size(); ++k)
+    {
+        const Index p = ipivots[k];
+        const auto d = etas.col(k);
+        const double xp = x[p]/d[p];
+        x -= xp * d;
+        x[p] = xp;
+    }
+}
+
+auto OptimumSolverSimplex::Impl::btran(VectorConstRef a, VectorRef x) -> void
+{
+    u = a;
+
+    // Apply the transpose of the eta transformations in reverse order
+    for(Index k = ipivots.size(); k-- > 0; )
+    {
+        const Index p = ipivots[k];
+        const auto d = etas.col(k);
+        u[p] = (u[p] - d.dot(u) + d[p]*u[p])/d[p];
+    }
+
+    solveTranspose(lu, u, x);
+}
+
+auto OptimumSolverSimplex::Impl::warmstart(const OptimumProblem& problem, OptimumState& state, const OptimumOptions& options) -> bool
+{
+    const auto& A = problem.A;
+    const auto& b = problem.b;
+    const auto& lower = problem.l;
+    const auto& upper = problem.u;
+    const Index n = A.cols();
+
+    // Check the last basis was computed for the same matrix `A`
+    if(ibasic_last.empty() || Alast.rows() != A.rows() || Alast.cols() != A.cols() || Alast != A)
+        return false;
+
+    ibasic = ibasic_last;
+    ilower = ilower_last;
+    iupper = iupper_last;
+
+    // Set the non-basic variables to their bounds, which must be finite
+    state.x.resize(n);
+    state.x.setZero();
+    for(Index i : ilower) state.x[i] = lower[i];
+    for(Index i : iupper) state.x[i] = upper[i];
+    if(!state.x.allFinite())
+        return false;
+
+    std::sort(ibasic.begin(), ibasic.end());
+
+    factorize(A);
+
+    // Check the basis matrix is not singular for the current problem
+    if(!(lu.rcond() > options.simplex.pivot_tolerance))
+        return false;
+
+    // Compute the basic variables and check they are within their bounds
+    ftran(b - A*state.x, xb);
+    for(Index i = 0; i < ibasic.size(); ++i)
+        if(!(xb[i] >= lower[ibasic[i]] && xb[i] <= upper[ibasic[i]]))
+            return false;
+
+    rows(state.x, ibasic) = xb;
+
+    return true;
+}
+
 auto OptimumSolverSimplex::Impl::feasible(const OptimumProblem& problem, OptimumState& state, const OptimumOptions& options) -> OptimumResult
 {
     OptimumResult result;
@@ -222,30 +350,32 @@ auto OptimumSolverSimplex::Impl::simplex(const OptimumProblem& problem, OptimumS
 
     std::sort(ibasic.begin(), ibasic.end());
 
-    Vector xb = rows(state.x, ibasic);
+    // Initialize the workspace vectors
+    xb = rows(state.x, ibasic);
+    cB.resize(m);
+    r.resize(n);
+    t.resize(m);
+    y.resize(m);
+
+    // Compute the LU decomposition of the initial basis, which is then updated at every pivot
+    factorize(A);
 
     for(iterations = 1; iterations <= maxiters; ++iterations)
     {
+        ProfilerScope("OptimumSolverSimplex::iteration");
         const unsigned nL = ilower.size();
         const unsigned nU = iupper.size();
 
-        Matrix AB = cols(A, ibasic);
-        Matrix AL = cols(A, ilower);
-        Matrix AU = cols(A, iupper);
-
-        Vector cB = rows(c, ibasic);
-        Vector cL = rows(c, ilower);
-        Vector cU = rows(c, iupper);
-
-        Eigen::PartialPivLU<Matrix> lu(AB);
+        for(unsigned i = 0; i < m; ++i)
+            cB[i] = c[ibasic[i]];
 
-        y = solveTranspose(lu, cB);
+        btran(cB, y);
 
-        Vector zL =  cL - AL.transpose() * y;
-        Vector zU = -cU + AU.transpose() * y;
+        // Compute the reduced costs, which are the dual variables zL and -zU of the non-basic variables
+        r.noalias() = c - tr(A) * y;
 
-        const Index qLower = findMostNegative(zL); // the index of the first negative entry in zL
-        const Index qUpper = findMostNegative(zU); // the index of the first negative entry in zU
+        const Index qLower = findMostNegative(r, ilower,  1.0); // the index of the most negative entry in zL
+        const Index qUpper = findMostNegative(r, iupper, -1.0); // the index of the most negative entry in zU
 
         // Check if all dual variables zL and zU are positive
         if(qLower == nL && qUpper == nU)
@@ -253,8 +383,8 @@ auto OptimumSolverSimplex::Impl::simplex(const OptimumProblem& problem, OptimumS
             rows(x, ibasic) = xb;
             z.setZero(n);
             w.setZero(n);
-            rows(z, ilower) = zL;
-            rows(w, iupper) = zU;
+            for(Index i : ilower) z[i] =  r[i];
+            for(Index i : iupper) w[i] = -r[i];
             break;
         }
 
@@ -268,7 +398,7 @@ auto OptimumSolverSimplex::Impl::simplex(const OptimumProblem& problem, OptimumS
             const Index qlocal = qLower;
 
             // Compute the step vector `t`
-            Vector t = lu.solve(A.col(q));
+            ftran(A.col(q), t);
 
             // Compute the step length `lambda`
             double lambda = upper[q] - lower[q];
@@ -325,6 +455,7 @@ auto OptimumSolverSimplex::Impl::simplex(const OptimumProblem& problem, OptimumS
             case 0:
                 erase(qlocal, ilower);      // L' = L - {q}
                 iupper.push_back(q);        // U' = U + {q}
+                xb -= lambda * t;           // step to the new vertex
                 x[q] = upper[q];            // set the q-th variable to its upper bound
                 break;
 
@@ -334,6 +465,7 @@ auto OptimumSolverSimplex::Impl::simplex(const OptimumProblem& problem, OptimumS
                 xb -= lambda * t;           // step to the new vertex
                 xb[plocal] = x[q] + lambda; // update the new basic variable
                 x[p] = lower[p];            // set the p-th variable to its lower bound
+                update(A, plocal, t, options);
                 break;
 
             case 2:
@@ -343,6 +475,7 @@ auto OptimumSolverSimplex::Impl::simplex(const OptimumProblem& problem, OptimumS
                 xb -= lambda * t;           // step to the new vertex
                 xb[plocal] = x[q] + lambda; // update the new basic variable
                 x[p] = upper[p];            // set the p-th variable to its upper bound
+                update(A, plocal, t, options);
                 break;
             }
         }
@@ -357,7 +490,7 @@ auto OptimumSolverSimplex::Impl::simplex(const OptimumProblem& problem, OptimumS
             const Index qlocal = qUpper;
 
             // Compute the step vector `t`
-            Vector t = lu.solve(A.col(q));
+            ftran(A.col(q), t);
 
             // Compute the step length `lambda`
             double lambda = upper[q] - lower[q];
@@ -414,6 +547,7 @@ auto OptimumSolverSimplex::Impl::simplex(const OptimumProblem& problem, OptimumS
             case 0:
                 erase(qlocal, iupper); // U' = U - {q}
                 ilower.push_back(q);   // L' = L + {q}
+                xb += lambda * t;      // step to the new vertex
                 x[q] = lower[q];       // set the q-th variable to its lower bound
                 break;
 
@@ -423,6 +557,7 @@ auto OptimumSolverSimplex::Impl::simplex(const OptimumProblem& problem, OptimumS
                 xb += lambda * t;           // step to the new vertex
                 xb[plocal] = x[q] - lambda; // update the new basic variable
                 x[p] = upper[p];            // set the p-th variable to its upper bound
+                update(A, plocal, t, options);
                 break;
 
             case 2:
@@ -432,6 +567,7 @@ auto OptimumSolverSimplex::Impl::simplex(const OptimumProblem& problem, OptimumS
                 xb += lambda * t;           // step to the new vertex
                 xb[plocal] = x[q] - lambda; // update the new basic variable
                 x[p] = lower[p];            // set the p-th variable to its lower bound
+                update(A, plocal, t, options);
                 break;
             }
         }
@@ -452,9 +588,23 @@ auto OptimumSolverSimplex::Impl::simplex(const OptimumProblem& problem, OptimumS
 
 auto OptimumSolverSimplex::Impl::solve(const OptimumProblem& problem, OptimumState& state, const OptimumOptions& options) -> OptimumResult
 {
-    // Solve the regularized optimization problem
-    auto result = feasible(problem, state, options);
+    OptimumResult result;
+
+    // Skip the Phase I problem if the basis of the last calculation is feasible for this one
+    if(!options.simplex.warmstart || !warmstart(problem, state, options))
+        result = feasible(problem, state, options);
+
     result += simplex(problem, state, options);
+
+    // Store the final basis for warm-starting the next calculation with the same matrix `A`
+    if(result.succeeded && options.simplex.warmstart)
+    {
+        Alast = problem.A;
+        ibasic_last = ibasic;
+        ilower_last = ilower;
+        iupper_last = iupper;
+    }
+
     return result;
 }
 
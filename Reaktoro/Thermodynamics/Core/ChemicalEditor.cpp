@@ -131,9 +131,15 @@ private:
     /// The pressures for constructing interpolation tables of thermodynamic properties (in units of Pa).
     std::vector<double> pressures;
 
+    /// The method for interpolating the standard thermodynamic properties of the species.
+    InterpolationMethod interpolation_method = InterpolationMethod::Bilinear;
+
+    /// The tolerance for the adaptive refinement of the interpolation tables (in units of J/mol).
+    double interpolation_tolerance = 0.0;
+
 public:
     Impl()
-    : Impl(Database("supcrt98"))
+    : Impl(Database::shared("supcrt98"))
     {
     }
 
@@ -165,6 +171,16 @@ public:
             x = units::convert(x, units, "pascal");
     }
 
+    auto setInterpolationMethod(InterpolationMethod method) -> void
+    {
+        interpolation_method = method;
+    }
+
+    auto setInterpolationTolerance(double tolerance) -> void
+    {
+        interpolation_tolerance = tolerance;
+    }
+
     auto initializePhasesWithElements(std::vector<std::string> elements) -> void
     {
     	aqueous_phase = {};
@@ -413,12 +429,33 @@ public:
             standard_heat_capacity_cv_fns[i] = [=](double T, double P) { return thermo.standardPartialMolarHeatCapacityConstV(T, P, name); };
         }
 
+        // The temperatures and pressures of the interpolation tables of this phase
+        std::vector<double> Ts = temperatures;
+        std::vector<double> Ps = pressures;
+
+        // Check the adaptive refinement of the interpolation tables is used only with bicubic interpolation
+        Assert(interpolation_tolerance <= 0.0 || interpolation_method == InterpolationMethod::Bicubic,
+            "Could not create the interpolation tables of thermodynamic properties.",
+            "The adaptive refinement with a tolerance requires InterpolationMethod::Bicubic.");
+
+        // Refine the interpolation tables until the standard Gibbs energies are interpolated within the tolerance
+        if(interpolation_tolerance > 0.0)
+        {
+            const bool converged = refineInterpolationPoints(Ts, Ps, standard_gibbs_energy_fns, interpolation_tolerance);
+
+            Assert(converged, "Could not create the interpolation tables of thermodynamic properties.",
+                "The standard Gibbs energies of the species could not be interpolated within the tolerance "
+                "of " + std::to_string(interpolation_tolerance) + " J/mol. Use a larger tolerance or more "
+                "initial temperature and pressure points.");
+        }
+
         // Create the interpolation functions for thermodynamic properties of the species
-        ThermoVectorFunction standard_gibbs_energies_interp     = interpolate(temperatures, pressures, standard_gibbs_energy_fns);
-        ThermoVectorFunction standard_enthalpies_interp         = interpolate(temperatures, pressures, standard_enthalpy_fns);
-        ThermoVectorFunction standard_volumes_interp            = interpolate(temperatures, pressures, standard_volume_fns);
-        ThermoVectorFunction standard_heat_capacities_cp_interp = interpolate(temperatures, pressures, standard_heat_capacity_cp_fns);
-        ThermoVectorFunction standard_heat_capacities_cv_interp = interpolate(temperatures, pressures, standard_heat_capacity_cv_fns);
+        const auto method = interpolation_method;
+        ThermoVectorFunction standard_gibbs_energies_interp     = interpolate(Ts, Ps, standard_gibbs_energy_fns, method);
+        ThermoVectorFunction standard_enthalpies_interp         = interpolate(Ts, Ps, standard_enthalpy_fns, method);
+        ThermoVectorFunction standard_volumes_interp            = interpolate(Ts, Ps, standard_volume_fns, method);
+        ThermoVectorFunction standard_heat_capacities_cp_interp = interpolate(Ts, Ps, standard_heat_capacity_cp_fns, method);
+        ThermoVectorFunction standard_heat_capacities_cv_interp = interpolate(Ts, Ps, standard_heat_capacity_cv_fns, method);
         ThermoVectorFunction ln_activity_constants_func         = lnActivityConstants(phase);
 
         // Define the thermodynamic model function of the species
@@ -435,9 +472,15 @@ public:
             return res;
         };
 
-        // Create the Phase instance
-        Phase converted = phase;
+        // Create the Phase instance, with its own copy of the chemical model so that
+        // chemical systems created by this editor do not share its evaluation state
+        Phase converted;
+        converted.setName(phase.name());
+        converted.setType(phase.type());
+        converted.setSpecies(phase.species());
+        converted.elements() = phase.elements();
         converted.setThermoModel(thermo_model);
+        converted.setChemicalModel(phase.chemicalModel());
 
         return converted;
     }
@@ -502,6 +545,16 @@ auto ChemicalEditor::setPressures(std::vector<double> values, std::string units)
     pimpl->setPressures(values, units);
 }
 
+auto ChemicalEditor::setInterpolationMethod(InterpolationMethod method) -> void
+{
+    pimpl->setInterpolationMethod(method);
+}
+
+auto ChemicalEditor::setInterpolationTolerance(double tolerance) -> void
+{
+    pimpl->setInterpolationTolerance(tolerance);
+}
+
 auto ChemicalEditor::initializePhasesWithElements(std::vector<std::string> elements) -> void
 {
 	pimpl->initializePhasesWithElements(elements);
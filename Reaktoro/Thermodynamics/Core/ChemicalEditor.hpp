@@ -34,6 +34,7 @@ class MineralPhase;
 class ChemicalSystem;
 class ReactionSystem;
 class MineralReaction;
+enum class InterpolationMethod;
 
 /// Provides convenient operations to initialize ChemicalSystem and ReactionSystem instances.
 /// The ChemicalEditor class is used to conveniently create instances of classes ChemicalSystem and ReactionSystem.
@@ -105,6 +106,19 @@ public:
     /// @param units The units of the pressure values
     auto setPressures(std::vector<double> values, std::string units) -> void;
 
+    /// Set the method for interpolating the standard thermodynamic properties of the species.
+    /// The default method is InterpolationMethod::Bilinear.
+    /// @param method The interpolation method
+    auto setInterpolationMethod(InterpolationMethod method) -> void;
+
+    /// Set the tolerance for the adaptive refinement of the interpolation tables of thermodynamic properties.
+    /// If positive, the points given by @ref setTemperatures and @ref setPressures are refined for
+    /// each phase until the bicubic interpolation of the standard Gibbs energies of its species
+    /// attains this tolerance, and an error is raised if this is not possible. This can only be
+    /// used with InterpolationMethod::Bicubic, otherwise an error is raised when creating the system.
+    /// @param tolerance The absolute tolerance on the standard Gibbs energies (in units of J/mol)
+    auto setInterpolationTolerance(double tolerance) -> void;
+
     /// Initialize all possible phases that can exist with given elements.
     /// @param elements The element symbols of interest.
     auto initializePhasesWithElements(std::vector<std::string> elements) -> void;
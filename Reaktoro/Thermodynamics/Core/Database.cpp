@@ -18,15 +18,24 @@
 #include "Database.hpp"
 
 // C++ includes
+#include <atomic>
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
 #include <map>
+#include <mutex>
+#include <random>
 #include <set>
+#include <sstream>
 #include <string>
 #include <vector>
 
 // Reaktoro includes
+#include <Reaktoro/Common/BinaryUtils.hpp>
 #include <Reaktoro/Common/Constants.hpp>
 #include <Reaktoro/Common/Exception.hpp>
 #include <Reaktoro/Common/GlobalOptions.hpp>
+#include <Reaktoro/Common/MemoryMappedFile.hpp>
 #include <Reaktoro/Common/Optional.hpp>
 #include <Reaktoro/Common/SetUtils.hpp>
 #include <Reaktoro/Common/StringUtils.hpp>
@@ -54,6 +63,28 @@ using AqueousSpeciesMap = std::map<std::string, AqueousSpecies>;
 using GaseousSpeciesMap = std::map<std::string, GaseousSpecies>;
 using MineralSpeciesMap = std::map<std::string, MineralSpecies>;
 
+/// The entry of a species in the index of a pre-parsed binary database file
+struct SpeciesIndexEntry
+{
+    /// The offset of the record of the species from the beginning of the records in the file
+    std::uint64_t offset = 0;
+
+    /// The names of the elements of the species
+    std::vector<std::string> elements;
+};
+
+/// Auxiliary type for the index of the species in a pre-parsed binary database file
+using SpeciesIndex = std::map<std::string, SpeciesIndexEntry>;
+
+/// The identifier written at the beginning of pre-parsed binary database files
+const std::string database_magic = "REAKTORO-DATABASE";
+
+/// The version of the binary format of pre-parsed database files
+const std::uint32_t database_version = 2;
+
+/// The extension of the pre-parsed binary files of cached built-in databases
+const std::string database_cache_extension = ".rkdb";
+
 auto errorNonExistentSpecies(std::string type, std::string name) -> void
 {
     Exception exception;
@@ -377,6 +408,300 @@ auto speciesWithElements(const std::vector<std::string>& elements, const std::ma
     return collectSpecies(map, f);
 }
 
+/// Read the header of a pre-parsed binary database file.
+/// @return true if the stream starts with the identifier of pre-parsed binary database files
+auto readDatabaseHeader(std::istream& in, std::uint32_t& version, bool& excluded, std::uint64_t& source) -> bool
+{
+    std::uint64_t size = 0;
+    readBinary(in, size);
+    if(!in.good() || size != database_magic.size())
+        return false;
+    std::string magic(size, ' ');
+    in.read(&magic[0], size);
+    if(!in.good() || magic != database_magic)
+        return false;
+    std::uint8_t flag = 0;
+    readBinary(in, version);
+    readBinary(in, flag);
+    readBinary(in, source);
+    excluded = flag != 0;
+    return in.good();
+}
+
+/// Return true if a file is a pre-parsed binary database file.
+auto isBinaryDatabase(std::string filename) -> bool
+{
+    std::ifstream in(filename, std::ios::in | std::ios::binary);
+    std::uint32_t version = 0;
+    bool excluded = false;
+    std::uint64_t source = 0;
+    return readDatabaseHeader(in, version, excluded, source);
+}
+
+/// Return true if a cached binary database file can be used with the current database options.
+/// @param source The hash of the built-in database from which the cached file must have been created
+auto isCachedDatabaseCurrent(std::string filename, std::uint64_t source) -> bool
+{
+    std::ifstream in(filename, std::ios::in | std::ios::binary);
+    std::uint32_t version = 0;
+    bool excluded = false;
+    std::uint64_t hash = 0;
+    return readDatabaseHeader(in, version, excluded, hash) && version == database_version &&
+        excluded == global::options.database.exclude_species_with_missing_data && hash == source;
+}
+
+auto writeEquation(std::ostream& out, const std::map<std::string, double>& equation) -> void
+{
+    writeBinary(out, static_cast<std::uint64_t>(equation.size()));
+    for(const auto& pair : equation)
+    {
+        writeBinary(out, pair.first);
+        writeBinary(out, pair.second);
+    }
+}
+
+auto readEquation(std::istream& in) -> std::map<std::string, double>
+{
+    std::map<std::string, double> equation;
+    std::uint64_t size = 0;
+    readBinary(in, size);
+    for(std::uint64_t i = 0; i < size && in.good(); ++i)
+    {
+        std::string name;
+        double value = 0.0;
+        readBinary(in, name);
+        readBinary(in, value);
+        equation.emplace(name, value);
+    }
+    return equation;
+}
+
+auto writeInterpolator(std::ostream& out, const BilinearInterpolator& interpolator) -> void
+{
+    writeBinary(out, interpolator.xCoodinates());
+    writeBinary(out, interpolator.yCoodinates());
+    writeBinary(out, interpolator.data());
+}
+
+auto readInterpolator(std::istream& in) -> BilinearInterpolator
+{
+    std::vector<double> xcoordinates, ycoordinates, data;
+    readBinary(in, xcoordinates);
+    readBinary(in, ycoordinates);
+    readBinary(in, data);
+    return BilinearInterpolator(xcoordinates, ycoordinates, data);
+}
+
+auto writeParams(std::ostream& out, const SpeciesThermoInterpolatedProperties& data) -> void
+{
+    writeInterpolator(out, data.gibbs_energy);
+    writeInterpolator(out, data.helmholtz_energy);
+    writeInterpolator(out, data.internal_energy);
+    writeInterpolator(out, data.enthalpy);
+    writeInterpolator(out, data.entropy);
+    writeInterpolator(out, data.volume);
+    writeInterpolator(out, data.heat_capacity_cp);
+    writeInterpolator(out, data.heat_capacity_cv);
+}
+
+auto readParams(std::istream& in, SpeciesThermoInterpolatedProperties& data) -> void
+{
+    data.gibbs_energy     = readInterpolator(in);
+    data.helmholtz_energy = readInterpolator(in);
+    data.internal_energy  = readInterpolator(in);
+    data.enthalpy         = readInterpolator(in);
+    data.entropy          = readInterpolator(in);
+    data.volume           = readInterpolator(in);
+    data.heat_capacity_cp = readInterpolator(in);
+    data.heat_capacity_cv = readInterpolator(in);
+}
+
+auto writeParams(std::ostream& out, const ReactionThermoInterpolatedProperties& data) -> void
+{
+    writeEquation(out, data.equation.equation());
+    writeInterpolator(out, data.lnk);
+    writeInterpolator(out, data.gibbs_energy);
+    writeInterpolator(out, data.helmholtz_energy);
+    writeInterpolator(out, data.internal_energy);
+    writeInterpolator(out, data.enthalpy);
+    writeInterpolator(out, data.entropy);
+    writeInterpolator(out, data.volume);
+    writeInterpolator(out, data.heat_capacity_cp);
+    writeInterpolator(out, data.heat_capacity_cv);
+}
+
+auto readParams(std::istream& in, ReactionThermoInterpolatedProperties& data) -> void
+{
+    data.equation         = ReactionEquation(readEquation(in));
+    data.lnk              = readInterpolator(in);
+    data.gibbs_energy     = readInterpolator(in);
+    data.helmholtz_energy = readInterpolator(in);
+    data.internal_energy  = readInterpolator(in);
+    data.enthalpy         = readInterpolator(in);
+    data.entropy          = readInterpolator(in);
+    data.volume           = readInterpolator(in);
+    data.heat_capacity_cp = readInterpolator(in);
+    data.heat_capacity_cv = readInterpolator(in);
+}
+
+auto writeParams(std::ostream& out, const AqueousSpeciesThermoParamsHKF& hkf) -> void
+{
+    for(double value : {hkf.Gf, hkf.Hf, hkf.Sr, hkf.a1, hkf.a2, hkf.a3, hkf.a4, hkf.c1, hkf.c2, hkf.wref})
+        writeBinary(out, value);
+}
+
+auto readParams(std::istream& in, AqueousSpeciesThermoParamsHKF& hkf) -> void
+{
+    for(double* value : {&hkf.Gf, &hkf.Hf, &hkf.Sr, &hkf.a1, &hkf.a2, &hkf.a3, &hkf.a4, &hkf.c1, &hkf.c2, &hkf.wref})
+        readBinary(in, *value);
+}
+
+auto writeParams(std::ostream& out, const GaseousSpeciesThermoParamsHKF& hkf) -> void
+{
+    for(double value : {hkf.Gf, hkf.Hf, hkf.Sr, hkf.a, hkf.b, hkf.c, hkf.Tmax})
+        writeBinary(out, value);
+}
+
+auto readParams(std::istream& in, GaseousSpeciesThermoParamsHKF& hkf) -> void
+{
+    for(double* value : {&hkf.Gf, &hkf.Hf, &hkf.Sr, &hkf.a, &hkf.b, &hkf.c, &hkf.Tmax})
+        readBinary(in, *value);
+}
+
+auto writeParams(std::ostream& out, const MineralSpeciesThermoParamsHKF& hkf) -> void
+{
+    for(double value : {hkf.Gf, hkf.Hf, hkf.Sr, hkf.Vr, hkf.Tmax})
+        writeBinary(out, value);
+    writeBinary(out, static_cast<std::int32_t>(hkf.nptrans));
+    for(const auto* values : {&hkf.a, &hkf.b, &hkf.c, &hkf.Ttr, &hkf.Htr, &hkf.Vtr, &hkf.dPdTtr})
+        writeBinary(out, *values);
+}
+
+auto readParams(std::istream& in, MineralSpeciesThermoParamsHKF& hkf) -> void
+{
+    for(double* value : {&hkf.Gf, &hkf.Hf, &hkf.Sr, &hkf.Vr, &hkf.Tmax})
+        readBinary(in, *value);
+    std::int32_t nptrans = 0;
+    readBinary(in, nptrans);
+    hkf.nptrans = nptrans;
+    for(auto* values : {&hkf.a, &hkf.b, &hkf.c, &hkf.Ttr, &hkf.Htr, &hkf.Vtr, &hkf.dPdTtr})
+        readBinary(in, *values);
+}
+
+auto writeParams(std::ostream& out, const SpeciesThermoParamsPhreeqc& phreeqc) -> void
+{
+    writeEquation(out, phreeqc.reaction.equation.equation());
+    writeBinary(out, phreeqc.reaction.log_k);
+    writeBinary(out, phreeqc.reaction.delta_h);
+    writeBinary(out, phreeqc.reaction.analytic);
+}
+
+auto readParams(std::istream& in, SpeciesThermoParamsPhreeqc& phreeqc) -> void
+{
+    phreeqc.reaction.equation = ReactionEquation(readEquation(in));
+    readBinary(in, phreeqc.reaction.log_k);
+    readBinary(in, phreeqc.reaction.delta_h);
+    readBinary(in, phreeqc.reaction.analytic);
+}
+
+/// Write an optional set of parameters preceded by a flag that indicates if it is present.
+template<typename Params>
+auto writeOptional(std::ostream& out, const Optional<Params>& params) -> void
+{
+    writeBinary(out, static_cast<std::uint8_t>(!params.empty()));
+    if(!params.empty())
+        writeParams(out, params.get());
+}
+
+/// Read an optional set of parameters written with @ref writeOptional.
+template<typename Params>
+auto readOptional(std::istream& in, Optional<Params>& params) -> void
+{
+    std::uint8_t present = 0;
+    readBinary(in, present);
+    if(present)
+    {
+        Params value;
+        readParams(in, value);
+        params.set(value);
+    }
+}
+
+/// Write the thermodynamic data of an aqueous, gaseous or mineral species.
+template<typename ThermoData>
+auto writeThermoData(std::ostream& out, const ThermoData& thermo) -> void
+{
+    writeOptional(out, thermo.properties);
+    writeOptional(out, thermo.reaction);
+    writeOptional(out, thermo.hkf);
+    writeOptional(out, thermo.phreeqc);
+}
+
+/// Read the thermodynamic data of an aqueous, gaseous or mineral species.
+template<typename ThermoData>
+auto readThermoData(std::istream& in) -> ThermoData
+{
+    ThermoData thermo;
+    readOptional(in, thermo.properties);
+    readOptional(in, thermo.reaction);
+    readOptional(in, thermo.hkf);
+    readOptional(in, thermo.phreeqc);
+    return thermo;
+}
+
+/// Write the name, formula and elements of a species.
+auto writeSpecies(std::ostream& out, const Species& species) -> void
+{
+    writeBinary(out, species.name());
+    writeBinary(out, species.formula());
+    writeBinary(out, static_cast<std::uint64_t>(species.elements().size()));
+    for(const auto& pair : species.elements())
+    {
+        writeBinary(out, pair.first.name());
+        writeBinary(out, pair.second);
+    }
+}
+
+auto writeRecord(std::ostream& out, const AqueousSpecies& species) -> void
+{
+    writeSpecies(out, species);
+    writeBinary(out, species.charge());
+    writeEquation(out, species.dissociation());
+    writeThermoData(out, species.thermoData());
+}
+
+auto writeRecord(std::ostream& out, const GaseousSpecies& species) -> void
+{
+    writeSpecies(out, species);
+    writeBinary(out, species.criticalTemperature());
+    writeBinary(out, species.criticalPressure());
+    writeBinary(out, species.acentricFactor());
+    writeThermoData(out, species.thermoData());
+}
+
+auto writeRecord(std::ostream& out, const MineralSpecies& species) -> void
+{
+    writeSpecies(out, species);
+    writeThermoData(out, species.thermoData());
+}
+
+/// Return a copy of a map of elements or species whose entries do not share their data with the given map.
+template<typename Map>
+auto cloneMap(const Map& map) -> Map
+{
+    Map copy;
+    for(const auto& pair : map)
+        copy.emplace(pair.first, pair.second.clone());
+    return copy;
+}
+
+/// Return a number that identifies the contents of a database and is never reused within the process.
+auto newGeneration() -> std::uint64_t
+{
+    static std::atomic<std::uint64_t> counter(0);
+    return ++counter;
+}
+
 } // namespace
 
 struct Database::Impl
@@ -385,33 +710,98 @@ struct Database::Impl
     ElementMap element_map;
 
     /// The set of all aqueous species in the database
-    AqueousSpeciesMap aqueous_species_map;
+    mutable AqueousSpeciesMap aqueous_species_map;
 
     /// The set of all gaseous species in the database
-    GaseousSpeciesMap gaseous_species_map;
+    mutable GaseousSpeciesMap gaseous_species_map;
 
     /// The set of all mineral species in the database
-    MineralSpeciesMap mineral_species_map;
+    mutable MineralSpeciesMap mineral_species_map;
+
+    /// The pre-parsed binary database file from which species are created on demand (if any)
+    std::shared_ptr<MemoryMappedFile> file;
+
+    /// The position of the species records in the pre-parsed binary database file
+    std::uint64_t records = 0;
+
+    /// The aqueous species in the pre-parsed binary database file
+    SpeciesIndex aqueous_species_index;
+
+    /// The gaseous species in the pre-parsed binary database file
+    SpeciesIndex gaseous_species_index;
+
+    /// The mineral species in the pre-parsed binary database file
+    SpeciesIndex mineral_species_index;
+
+    /// The mutex that protects the creation of species from the pre-parsed binary database file
+    mutable std::mutex mutex;
+
+    /// The number that identifies the current contents of the database
+    std::uint64_t generation = newGeneration();
+
+    /// The hash of the built-in database from which the database was parsed (zero if not a built-in database)
+    std::uint64_t source = 0;
 
     Impl()
     {}
 
+    Impl(const Impl& other)
+    {
+        std::lock_guard<std::mutex> lock(other.mutex);
+        element_map = cloneMap(other.element_map);
+        aqueous_species_map = cloneMap(other.aqueous_species_map);
+        gaseous_species_map = cloneMap(other.gaseous_species_map);
+        mineral_species_map = cloneMap(other.mineral_species_map);
+        file = other.file;
+        records = other.records;
+        aqueous_species_index = other.aqueous_species_index;
+        gaseous_species_index = other.gaseous_species_index;
+        mineral_species_index = other.mineral_species_index;
+        source = other.source;
+    }
+
     Impl(std::string filename)
     {
+        // Load the database directly if it is a pre-parsed binary database file
+        if(isBinaryDatabase(filename))
+        {
+            load(filename);
+            return;
+        }
+
         // Create the XML document
         xml_document doc;
 
         // Load the xml database file
         auto result = doc.load_file(filename.c_str());
 
+        // The name of the pre-parsed binary file of a built-in database (if caching is enabled)
+        std::string cachefile;
+
         // Check if result is not ok, and then try a built-in database with same name
         if(!result)
         {
+            // The hash of the built-in database with same name (zero if there is none)
+            source = databaseHash(filename);
+
+            // Use the cached pre-parsed built-in database if it is available and was created from the same built-in database
+            const std::string& directory = global::options.database.cache_directory;
+            if(!directory.empty())
+            {
+                cachefile = directory + "/" + filename + database_cache_extension;
+                if(isCachedDatabaseCurrent(cachefile, source))
+                {
+                    load(cachefile);
+                    return;
+                }
+            }
+
             // Search for a built-in database
             std::string builtin = database(filename);
 
             // If not empty, use the built-in database to create the xml doc
             if(!builtin.empty()) result = doc.load(builtin.c_str());
+            else cachefile.clear();
         }
 
         // Ensure either a database file path was correctly given, or a built-in database
@@ -426,6 +816,20 @@ struct Database::Impl
 
         // Parse the xml document
         parse(doc, filename);
+
+        // Cache the parsed built-in database, which is written to a temporary file first so that
+        // other processes never read a partially written file (failures only disable the cache)
+        if(!cachefile.empty())
+        {
+            const std::string tmpfile = cachefile + ".tmp" + std::to_string(std::random_device{}());
+            try {
+                save(tmpfile);
+                if(std::rename(tmpfile.c_str(), cachefile.c_str()) != 0)
+                    std::remove(tmpfile.c_str());
+            } catch(...) {
+                std::remove(tmpfile.c_str());
+            }
+        }
     }
 
     template<typename Key, typename Value>
@@ -443,19 +847,102 @@ struct Database::Impl
         element_map.insert({element.name(), element});
     }
 
+    /// Add a species, which replaces any species with the same name, including one not yet created from the binary database file.
+    template<typename SpeciesType>
+    auto addSpecies(const SpeciesType& species, std::map<std::string, SpeciesType>& map) -> void
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        map[species.name()] = species;
+    }
+
     auto addAqueousSpecies(const AqueousSpecies& species) -> void
     {
-        aqueous_species_map.insert({species.name(), species});
+        addSpecies(species, aqueous_species_map);
     }
 
     auto addGaseousSpecies(const GaseousSpecies& species) -> void
     {
-        gaseous_species_map.insert({species.name(), species});
+        addSpecies(species, gaseous_species_map);
     }
 
     auto addMineralSpecies(const MineralSpecies& species) -> void
     {
-        mineral_species_map.insert({species.name(), species});
+        addSpecies(species, mineral_species_map);
+    }
+
+    /// Return a species with given name, creating it from the binary database file if needed (the mutex must be locked).
+    template<typename SpeciesType>
+    auto materialize(std::string name, std::map<std::string, SpeciesType>& map, const SpeciesIndex& index) const -> const SpeciesType*
+    {
+        auto iter = map.find(name);
+        if(iter != map.end())
+            return &iter->second;
+        auto entry = index.find(name);
+        if(entry == index.end())
+            return nullptr;
+        const std::uint64_t position = records + entry->second.offset;
+        MemoryInputStream in(file->data() + position, file->size() - position);
+        SpeciesType species;
+        readRecord(in, species);
+        Assert(!in.fail(), "Could not read the species `" + name + "` from the binary database file.",
+            "The file is either corrupted or it was truncated.");
+        return &map.emplace(name, species).first->second;
+    }
+
+    /// Create all species in the binary database file that are not yet created (the mutex must be locked).
+    template<typename SpeciesType>
+    auto materializeAll(std::map<std::string, SpeciesType>& map, const SpeciesIndex& index) const -> void
+    {
+        for(const auto& entry : index)
+            materialize(entry.first, map, index);
+    }
+
+    /// Create the species in the binary database file that are composed only of given elements (the mutex must be locked).
+    template<typename SpeciesType>
+    auto materializeWithElements(const std::vector<std::string>& elements, std::map<std::string, SpeciesType>& map, const SpeciesIndex& index) const -> void
+    {
+        for(const auto& entry : index)
+        {
+            bool candidate = true;
+            for(const auto& element : entry.second.elements)
+                if(element != "Z" && !contained(element, elements))
+                    { candidate = false; break; }
+            if(candidate)
+                materialize(entry.first, map, index);
+        }
+    }
+
+    template<typename SpeciesType>
+    auto allSpecies(std::map<std::string, SpeciesType>& map, const SpeciesIndex& index) -> std::vector<SpeciesType>
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        materializeAll(map, index);
+        return collectValues(map);
+    }
+
+    template<typename SpeciesType>
+    auto findSpecies(std::string type, std::string name, std::map<std::string, SpeciesType>& map, const SpeciesIndex& index) const -> const SpeciesType&
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        const SpeciesType* species = materialize(name, map, index);
+        if(species == nullptr)
+            errorNonExistentSpecies(type, name);
+        return *species;
+    }
+
+    template<typename SpeciesType>
+    auto containsSpecies(std::string name, const std::map<std::string, SpeciesType>& map, const SpeciesIndex& index) const -> bool
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        return map.count(name) != 0 || index.count(name) != 0;
+    }
+
+    template<typename SpeciesType>
+    auto speciesWithElements(const std::vector<std::string>& elements, std::map<std::string, SpeciesType>& map, const SpeciesIndex& index) const -> std::vector<SpeciesType>
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        materializeWithElements(elements, map, index);
+        return Reaktoro::speciesWithElements(elements, map);
     }
 
     auto elements() -> std::vector<Element>
@@ -465,71 +952,228 @@ struct Database::Impl
 
     auto aqueousSpecies() -> std::vector<AqueousSpecies>
     {
-        return collectValues(aqueous_species_map);
+        return allSpecies(aqueous_species_map, aqueous_species_index);
     }
 
     auto aqueousSpecies(std::string name) const -> const AqueousSpecies&
     {
-        if(aqueous_species_map.count(name) == 0)
-            errorNonExistentSpecies("aqueous", name);
-
-        return aqueous_species_map.find(name)->second;
+        return findSpecies("aqueous", name, aqueous_species_map, aqueous_species_index);
     }
 
     auto gaseousSpecies() -> std::vector<GaseousSpecies>
     {
-        return collectValues(gaseous_species_map);
+        return allSpecies(gaseous_species_map, gaseous_species_index);
     }
 
     auto gaseousSpecies(std::string name) const -> const GaseousSpecies&
     {
-        if(gaseous_species_map.count(name) == 0)
-            errorNonExistentSpecies("gaseous", name);
-
-        return gaseous_species_map.find(name)->second;
+        return findSpecies("gaseous", name, gaseous_species_map, gaseous_species_index);
     }
 
     auto mineralSpecies() -> std::vector<MineralSpecies>
     {
-        return collectValues(mineral_species_map);
+        return allSpecies(mineral_species_map, mineral_species_index);
     }
 
     auto mineralSpecies(std::string name) const -> const MineralSpecies&
     {
-        if(mineral_species_map.count(name) == 0)
-            errorNonExistentSpecies("mineral", name);
-
-        return mineral_species_map.find(name)->second;
+        return findSpecies("mineral", name, mineral_species_map, mineral_species_index);
     }
 
     auto containsAqueousSpecies(std::string species) const -> bool
     {
-        return aqueous_species_map.count(species) != 0;
+        return containsSpecies(species, aqueous_species_map, aqueous_species_index);
     }
 
     auto containsGaseousSpecies(std::string species) const -> bool
     {
-        return gaseous_species_map.count(species) != 0;
+        return containsSpecies(species, gaseous_species_map, gaseous_species_index);
     }
 
     auto containsMineralSpecies(std::string species) const -> bool
     {
-        return mineral_species_map.count(species) != 0;
+        return containsSpecies(species, mineral_species_map, mineral_species_index);
     }
 
     auto aqueousSpeciesWithElements(const std::vector<std::string>& elements) const -> std::vector<AqueousSpecies>
     {
-        return speciesWithElements(elements, aqueous_species_map);
+        return speciesWithElements(elements, aqueous_species_map, aqueous_species_index);
     }
 
     auto gaseousSpeciesWithElements(const std::vector<std::string>& elements) const -> std::vector<GaseousSpecies>
     {
-        return speciesWithElements(elements, gaseous_species_map);
+        return speciesWithElements(elements, gaseous_species_map, gaseous_species_index);
     }
 
     auto mineralSpeciesWithElements(const std::vector<std::string>& elements) const -> std::vector<MineralSpecies>
     {
-        return speciesWithElements(elements, mineral_species_map);
+        return speciesWithElements(elements, mineral_species_map, mineral_species_index);
+    }
+
+    /// Write the index entries and the records of all species of a given type.
+    template<typename SpeciesType>
+    auto writeSpeciesIndex(std::ostream& out, std::ostream& records, std::map<std::string, SpeciesType>& map, const SpeciesIndex& index) const -> void
+    {
+        materializeAll(map, index);
+        writeBinary(out, static_cast<std::uint64_t>(map.size()));
+        for(const auto& pair : map)
+        {
+            writeBinary(out, pair.first);
+            writeBinary(out, static_cast<std::uint64_t>(records.tellp()));
+            writeBinary(out, static_cast<std::uint64_t>(pair.second.elements().size()));
+            for(const auto& element : pair.second.elements())
+                writeBinary(out, element.first.name());
+            writeRecord(records, pair.second);
+        }
+    }
+
+    /// Read the index entries of all species of a given type.
+    auto readSpeciesIndex(std::istream& in, SpeciesIndex& index) -> void
+    {
+        std::uint64_t size = 0;
+        readBinary(in, size);
+        for(std::uint64_t i = 0; i < size && in.good(); ++i)
+        {
+            std::string name;
+            SpeciesIndexEntry entry;
+            std::uint64_t numelements = 0;
+            readBinary(in, name);
+            readBinary(in, entry.offset);
+            readBinary(in, numelements);
+            entry.elements.resize(numelements);
+            for(auto& element : entry.elements)
+                readBinary(in, element);
+            index.emplace(name, entry);
+        }
+    }
+
+    auto save(std::string filename) const -> void
+    {
+        std::ofstream out(filename, std::ios::out | std::ios::binary);
+        Assert(out.is_open(), "Could not save the database to `" + filename + "`.",
+            "The file could not be opened for writing.");
+
+        std::lock_guard<std::mutex> lock(mutex);
+
+        writeBinary(out, database_magic);
+        writeBinary(out, database_version);
+        writeBinary(out, static_cast<std::uint8_t>(global::options.database.exclude_species_with_missing_data));
+        writeBinary(out, source);
+
+        writeBinary(out, static_cast<std::uint64_t>(element_map.size()));
+        for(const auto& pair : element_map)
+        {
+            writeBinary(out, pair.second.name());
+            writeBinary(out, pair.second.molarMass());
+        }
+
+        std::ostringstream records(std::ios::out | std::ios::binary);
+        writeSpeciesIndex(out, records, aqueous_species_map, aqueous_species_index);
+        writeSpeciesIndex(out, records, gaseous_species_map, gaseous_species_index);
+        writeSpeciesIndex(out, records, mineral_species_map, mineral_species_index);
+
+        const std::string bytes = records.str();
+        out.write(bytes.data(), bytes.size());
+
+        Assert(out.good(), "Could not save the database to `" + filename + "`.",
+            "An error occurred while writing the file.");
+    }
+
+    auto load(std::string filename) -> void
+    {
+        file = std::make_shared<MemoryMappedFile>(filename);
+        MemoryInputStream in(*file);
+
+        std::uint32_t version = 0;
+        bool excluded = false;
+        Assert(readDatabaseHeader(in, version, excluded, source),
+            "Could not load the database file `" + filename + "`.",
+            "The file is not a pre-parsed binary database file.");
+        Assert(version == database_version,
+            "Could not load the database file `" + filename + "`.",
+            "The file has version " + std::to_string(version) + ", but version " +
+            std::to_string(database_version) + " was expected.");
+
+        std::uint64_t numelements = 0;
+        readBinary(in, numelements);
+        for(std::uint64_t i = 0; i < numelements && in.good(); ++i)
+        {
+            std::string name;
+            double molar_mass = 0.0;
+            readBinary(in, name);
+            readBinary(in, molar_mass);
+            Element element;
+            element.setName(name);
+            element.setMolarMass(molar_mass);
+            element_map[name] = element;
+        }
+
+        readSpeciesIndex(in, aqueous_species_index);
+        readSpeciesIndex(in, gaseous_species_index);
+        readSpeciesIndex(in, mineral_species_index);
+
+        Assert(!in.fail(), "Could not load the database file `" + filename + "`.",
+            "The file is either corrupted or it was truncated.");
+
+        records = static_cast<std::uint64_t>(in.tellg());
+    }
+
+    /// Read the name, formula and elements of a species written with writeSpecies.
+    auto readSpecies(std::istream& in, Species& species) const -> void
+    {
+        std::string name, formula;
+        std::uint64_t size = 0;
+        readBinary(in, name);
+        readBinary(in, formula);
+        readBinary(in, size);
+        std::map<Element, double> elements;
+        for(std::uint64_t i = 0; i < size && in.good(); ++i)
+        {
+            std::string element;
+            double coefficient = 0.0;
+            readBinary(in, element);
+            readBinary(in, coefficient);
+            auto iter = element_map.find(element);
+            Assert(iter != element_map.end(),
+                "Could not read the species `" + name + "` from the binary database file.",
+                "The element `" + element + "` is not in the database.");
+            elements.emplace(iter->second, coefficient);
+        }
+        species.setName(name);
+        species.setFormula(formula);
+        species.setElements(elements);
+    }
+
+    auto readRecord(std::istream& in, AqueousSpecies& species) const -> void
+    {
+        double charge = 0.0;
+        readSpecies(in, species);
+        readBinary(in, charge);
+        species.setCharge(charge);
+        species.setDissociation(readEquation(in));
+        species.setThermoData(readThermoData<AqueousSpeciesThermoData>(in));
+    }
+
+    auto readRecord(std::istream& in, GaseousSpecies& species) const -> void
+    {
+        double critical_temperature = 0.0, critical_pressure = 0.0, acentric_factor = 0.0;
+        readSpecies(in, species);
+        readBinary(in, critical_temperature);
+        readBinary(in, critical_pressure);
+        readBinary(in, acentric_factor);
+        // The critical properties are written as zero when they are not available in the database
+        if(critical_temperature > 0.0)
+            species.setCriticalTemperature(critical_temperature);
+        if(critical_pressure > 0.0)
+            species.setCriticalPressure(critical_pressure);
+        species.setAcentricFactor(acentric_factor);
+        species.setThermoData(readThermoData<GaseousSpeciesThermoData>(in));
+    }
+
+    auto readRecord(std::istream& in, MineralSpecies& species) const -> void
+    {
+        readSpecies(in, species);
+        species.setThermoData(readThermoData<MineralSpeciesThermoData>(in));
     }
 
     auto parse(const xml_document& doc, std::string databasename) -> void
@@ -712,23 +1356,59 @@ Database::Database(std::string filename)
 : pimpl(new Impl(filename))
 {}
 
+auto Database::shared(std::string filename) -> Database
+{
+    static std::mutex mutex;
+    static std::map<std::string, Database> databases;
+
+    // The parsed species depend on the database options, so these are part of the key
+    const std::string key = filename + (global::options.database.exclude_species_with_missing_data ? "|1" : "|0");
+
+    std::lock_guard<std::mutex> lock(mutex);
+    auto iter = databases.find(key);
+    if(iter == databases.end())
+        iter = databases.emplace(key, Database(filename)).first;
+    return iter->second;
+}
+
+auto Database::detach() -> void
+{
+    if(pimpl.use_count() > 1)
+        pimpl = std::make_shared<Impl>(*pimpl);
+    pimpl->generation = newGeneration();
+}
+
+auto Database::identity() const -> std::uint64_t
+{
+    return pimpl->generation;
+}
+
+auto Database::save(std::string filename) const -> void
+{
+    pimpl->save(filename);
+}
+
 auto Database::addElement(const Element& element) -> void
 {
+    detach();
     pimpl->addElement(element);
 }
 
 auto Database::addAqueousSpecies(const AqueousSpecies& species) -> void
 {
+    detach();
     pimpl->addAqueousSpecies(species);
 }
 
 auto Database::addGaseousSpecies(const GaseousSpecies& species) -> void
 {
+    detach();
     pimpl->addGaseousSpecies(species);
 }
 
 auto Database::addMineralSpecies(const MineralSpecies& species) -> void
 {
+    detach();
     pimpl->addMineralSpecies(species);
 }
 
@@ -18,6 +18,7 @@
 #pragma once
 
 // C++ includes
+#include <cstdint>
 #include <memory>
 #include <string>
 #include <vector>
@@ -58,6 +59,10 @@ class MineralSpecies;
 /// std::cout << gaseousSpecies << std::endl;
 /// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
 ///
+/// Copies of a Database instance share the same data, which is only copied when
+/// a copy is modified (e.g., with @ref addAqueousSpecies). Use @ref shared to
+/// obtain the instance of a database that is shared across the whole process.
+///
 /// @see AqueousSpecies, GaseousSpecies, MineralSpecies
 /// @ingroup Core
 class Database
@@ -70,20 +75,37 @@ public:
     /// If `filename` does not point to a valid database file or the
     /// database file is not found, then a default built-in database
     /// with the same name will be tried. If no default built-in database
-    /// exist with given name, an exception will be thrown.
+    /// exist with given name, an exception will be thrown. The file can also be
+    /// a pre-parsed binary database file written with @ref save, in which case
+    /// the species are only created when they are first requested.
     /// @param filename The name of the database file
     explicit Database(std::string filename);
 
+    /// Return the Database instance shared by the whole process for a given database file or built-in database.
+    /// The database is parsed only in the first call with a given name (and database options), and every
+    /// following call returns a copy sharing the same data. This method is thread-safe.
+    /// @param filename The name of the database file or built-in database
+    static auto shared(std::string filename) -> Database;
+
+    /// Save the database in a pre-parsed binary file.
+    /// The binary file can be loaded with the constructor @ref Database(std::string),
+    /// which is considerably faster than parsing the original `xml` database file.
+    /// @param filename The name of the binary database file
+    auto save(std::string filename) const -> void;
+
     /// Add an Element instance in the database.
     auto addElement(const Element& element) -> void;
 
     /// Add an AqueousSpecies instance in the database.
+    /// An aqueous species with the same name in the database is replaced.
     auto addAqueousSpecies(const AqueousSpecies& species) -> void;
 
     /// Add a GaseousSpecies instance in the database.
+    /// A gaseous species with the same name in the database is replaced.
     auto addGaseousSpecies(const GaseousSpecies& species) -> void;
 
     /// Add a MineralSpecies instance in the database.
+    /// A mineral species with the same name in the database is replaced.
     auto addMineralSpecies(const MineralSpecies& species) -> void;
 
     /// Return all elements in the database
@@ -138,6 +160,15 @@ private:
     struct Impl;
 
     std::shared_ptr<Impl> pimpl;
+
+    /// Ensure this instance does not share its data with other instances before it is modified.
+    /// The elements and species of a detached instance are copies that can be modified independently.
+    auto detach() -> void;
+
+    /// Return the number that identifies the contents of the database, which changes whenever it is modified.
+    auto identity() const -> std::uint64_t;
+
+    friend class Thermo;
 };
 
 } // namespace Reaktoro
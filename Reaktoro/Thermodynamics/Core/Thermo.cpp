@@ -18,7 +18,10 @@
 #include "Thermo.hpp"
 
 // C++ includes
+#include <cstdint>
 #include <functional>
+#include <map>
+#include <mutex>
 using namespace std::placeholders;
 
 // Reaktoro includes
@@ -56,6 +59,9 @@ using SpeciesThermoStateFunction =
 using WaterElectroStateFunction =
     std::function<WaterElectroState(double, double)>;
 
+/// The maximum number of results kept in each cache of calculated thermodynamic states
+const std::size_t cache_capacity = 16384;
+
 auto errorNonExistentSpecies(const std::string& name) -> void
 {
     Exception exception;
@@ -95,7 +101,7 @@ struct Thermo::Impl
             return Reaktoro::waterThermoStateHGK(T, P, StateOfMatter::Liquid);
         };
 
-        water_thermo_state_hgk_fn = memoize(water_thermo_state_hgk_fn);
+        water_thermo_state_hgk_fn = memoize(water_thermo_state_hgk_fn, cache_capacity);
 
         // Initialize the Wagner and Pruss (1995) equation of state for water
         water_thermo_state_wagner_pruss_fn = [](Temperature T, Pressure P)
@@ -103,7 +109,7 @@ struct Thermo::Impl
             return Reaktoro::waterThermoStateWagnerPruss(T, P, StateOfMatter::Liquid);
         };
 
-        water_thermo_state_wagner_pruss_fn = memoize(water_thermo_state_wagner_pruss_fn);
+        water_thermo_state_wagner_pruss_fn = memoize(water_thermo_state_wagner_pruss_fn, cache_capacity);
 
         // Initialize the Johnson and Norton equation of state for the electrostatic state of water
         water_eletro_state_fn = [=](double T, double P)
@@ -112,7 +118,7 @@ struct Thermo::Impl
             return waterElectroStateJohnsonNorton(T, P, wts);
         };
 
-        water_eletro_state_fn = memoize(water_eletro_state_fn);
+        water_eletro_state_fn = memoize(water_eletro_state_fn, cache_capacity);
 
         // Initialize the HKF equation of state for the thermodynamic state of aqueous, gaseous and mineral species
         species_thermo_state_hkf_fn = [=](double T, double P, std::string species)
@@ -120,7 +126,7 @@ struct Thermo::Impl
             return speciesThermoStateHKF(T, P, species);
         };
 
-        species_thermo_state_hkf_fn = memoize(species_thermo_state_hkf_fn);
+        species_thermo_state_hkf_fn = memoize(species_thermo_state_hkf_fn, cache_capacity);
     }
 
     auto speciesThermoStateHKF(double T, double P, std::string species) -> SpeciesThermoState
@@ -377,56 +383,56 @@ struct Thermo::Impl
     auto standardGibbsEnergyFromReaction(double T, double P, std::string species, const ReactionThermoInterpolatedProperties& reaction) -> ThermoScalar
     {
         auto eval = [&]() { return reaction.gibbs_energy(T, P); };
-        auto property = std::bind(&Impl::standardPartialMolarGibbsEnergy, *this, _1, _2, _3);
+        auto property = std::bind(&Impl::standardPartialMolarGibbsEnergy, this, _1, _2, _3);
         return standardPropertyFromReaction(T, P, species, reaction, property, eval);
     }
 
     auto standardHelmholtzEnergyFromReaction(double T, double P, std::string species, const ReactionThermoInterpolatedProperties& reaction) -> ThermoScalar
     {
         auto eval = [&]() { return reaction.helmholtz_energy(T, P); };
-        auto property = std::bind(&Impl::standardPartialMolarHelmholtzEnergy, *this, _1, _2, _3);
+        auto property = std::bind(&Impl::standardPartialMolarHelmholtzEnergy, this, _1, _2, _3);
         return standardPropertyFromReaction(T, P, species, reaction, property, eval);
     }
 
     auto standardInternalEnergyFromReaction(double T, double P, std::string species, const ReactionThermoInterpolatedProperties& reaction) -> ThermoScalar
     {
         auto eval = [&]() { return reaction.internal_energy(T, P); };
-        auto property = std::bind(&Impl::standardPartialMolarInternalEnergy, *this, _1, _2, _3);
+        auto property = std::bind(&Impl::standardPartialMolarInternalEnergy, this, _1, _2, _3);
         return standardPropertyFromReaction(T, P, species, reaction, property, eval);
     }
 
     auto standardEnthalpyFromReaction(double T, double P, std::string species, const ReactionThermoInterpolatedProperties& reaction) -> ThermoScalar
     {
         auto eval = [&]() { return reaction.enthalpy(T, P); };
-        auto property = std::bind(&Impl::standardPartialMolarEnthalpy, *this, _1, _2, _3);
+        auto property = std::bind(&Impl::standardPartialMolarEnthalpy, this, _1, _2, _3);
         return standardPropertyFromReaction(T, P, species, reaction, property, eval);
     }
 
     auto standardEntropyFromReaction(double T, double P, std::string species, const ReactionThermoInterpolatedProperties& reaction) -> ThermoScalar
     {
         auto eval = [&]() { return reaction.entropy(T, P); };
-        auto property = std::bind(&Impl::standardPartialMolarEntropy, *this, _1, _2, _3);
+        auto property = std::bind(&Impl::standardPartialMolarEntropy, this, _1, _2, _3);
         return standardPropertyFromReaction(T, P, species, reaction, property, eval);
     }
 
     auto standardVolumeFromReaction(double T, double P, std::string species, const ReactionThermoInterpolatedProperties& reaction) -> ThermoScalar
     {
         auto eval = [&]() { return reaction.volume(T, P); };
-        auto property = std::bind(&Impl::standardPartialMolarVolume, *this, _1, _2, _3);
+        auto property = std::bind(&Impl::standardPartialMolarVolume, this, _1, _2, _3);
         return standardPropertyFromReaction(T, P, species, reaction, property, eval);
     }
 
     auto standardHeatCapacityConstPFromReaction(double T, double P, std::string species, const ReactionThermoInterpolatedProperties& reaction) -> ThermoScalar
     {
         auto eval = [&]() { return reaction.heat_capacity_cp(T, P); };
-        auto property = std::bind(&Impl::standardPartialMolarHeatCapacityConstP, *this, _1, _2, _3);
+        auto property = std::bind(&Impl::standardPartialMolarHeatCapacityConstP, this, _1, _2, _3);
         return standardPropertyFromReaction(T, P, species, reaction, property, eval);
     }
 
     auto standardHeatCapacityConstVFromReaction(double T, double P, std::string species, const ReactionThermoInterpolatedProperties& reaction) -> ThermoScalar
     {
         auto eval = [&]() { return reaction.heat_capacity_cv(T, P); };
-        auto property = std::bind(&Impl::standardPartialMolarHeatCapacityConstV, *this, _1, _2, _3);
+        auto property = std::bind(&Impl::standardPartialMolarHeatCapacityConstV, this, _1, _2, _3);
         return standardPropertyFromReaction(T, P, species, reaction, property, eval);
     }
 
@@ -500,8 +506,25 @@ struct Thermo::Impl
 };
 
 Thermo::Thermo(const Database& database)
-: pimpl(new Impl(database))
-{}
+{
+    // The Impl instances shared by all Thermo instances created with the same database contents
+    static std::mutex mutex;
+    static std::map<std::uint64_t, std::weak_ptr<Impl>> instances;
+
+    std::lock_guard<std::mutex> lock(mutex);
+
+    // Remove the entries of databases no longer used by any Thermo instance
+    for(auto iter = instances.begin(); iter != instances.end();)
+        iter = iter->second.expired() ? instances.erase(iter) : std::next(iter);
+
+    std::weak_ptr<Impl>& instance = instances[database.identity()];
+    pimpl = instance.lock();
+    if(!pimpl)
+    {
+        pimpl = std::make_shared<Impl>(database);
+        instance = pimpl;
+    }
+}
 
 auto Thermo::standardPartialMolarGibbsEnergy(double T, double P, std::string species) const -> ThermoScalar
 {
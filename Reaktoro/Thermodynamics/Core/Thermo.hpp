@@ -35,7 +35,10 @@ struct WaterThermoState;
 class Thermo
 {
 public:
-    /// Construct a Thermo instance with given Database instance
+    /// Construct a Thermo instance with given Database instance.
+    /// All Thermo instances constructed with copies of the same Database instance
+    /// share their caches of calculated thermodynamic states, which are thread-safe and hold
+    /// a bounded number of states. A modified Database instance does not share these caches.
     explicit Thermo(const Database& database);
 
     /// Calculate the apparent standard molar Gibbs free energy of a species (in units of J/mol).
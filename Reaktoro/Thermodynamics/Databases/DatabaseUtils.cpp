@@ -24,6 +24,7 @@
 #include <miniz/zip_file.hpp>
 
 // Reaktoro includes
+#include <Reaktoro/Common/BinaryUtils.hpp>
 #include <Reaktoro/Common/SetUtils.hpp>
 #include "supcrt98.hpp"
 #include "supcrt07.hpp"
@@ -60,14 +61,19 @@ const std::vector<unsigned int> databases_len =
     supcrt07_organics_zip_len,
 };
 
+/// Return the index of a built-in database, either named, e.g., supcrt98.xml or supcrt98
+auto indexDatabase(std::string name) -> Index
+{
+    return std::min(index(name, databases), index(name + ".xml", databases));
+}
+
 } // namespace internal
 
 auto database(std::string name) -> std::string
 {
     // Get the index of the database, either named, e.g., supcrt98.xml or supcrt98
-    const Index i = index(name, internal::databases);
     const Index j = index(name + ".xml", internal::databases);
-    const Index idx = std::min(i, j);
+    const Index idx = internal::indexDatabase(name);
 
     // Return empty string if there is no built-in database if such name
     if(idx >= internal::databases.size())
@@ -96,4 +102,17 @@ auto databases() -> std::vector<std::string>
     return internal::databases;
 }
 
+auto databaseHash(std::string name) -> std::uint64_t
+{
+    // Get the index of the database, either named, e.g., supcrt98.xml or supcrt98
+    const Index idx = internal::indexDatabase(name);
+
+    // Return zero if there is no built-in database with such name
+    if(idx >= internal::databases.size())
+        return 0;
+
+    // Return the hash of the zipped data of the database
+    return hashBytes(internal::databases_data[idx], internal::databases_len[idx]);
+}
+
 } // namespace Reaktoro
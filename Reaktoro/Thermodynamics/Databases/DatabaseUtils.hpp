@@ -18,6 +18,7 @@
 #pragma once
 
 // C++ includes
+#include <cstdint>
 #include <string>
 #include <vector>
 
@@ -34,4 +35,12 @@ auto database(std::string name) -> std::string;
 /// Return the list of names of all built-in databases.
 auto databases() -> std::vector<std::string>;
 
+/// Return a hash of the embedded data of a built-in database.
+/// This hash changes whenever a built-in database is modified, and it
+/// is used to identify the built-in database a cached file was created from.
+/// If the given database `name` is not found, zero is returned.
+/// @param name The name of the database.
+/// @see database
+auto databaseHash(std::string name) -> std::uint64_t;
+
 } // namespace Reaktoro
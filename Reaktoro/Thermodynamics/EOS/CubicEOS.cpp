@@ -152,10 +152,124 @@ auto Psi(CubicEOS::Model type) -> double
     }
 }
 
+/// A matrix of thermodynamic properties and their partial temperature and pressure derivatives.
+struct ThermoMatrix
+{
+    /// The values of the thermodynamic properties.
+    Matrix val;
+
+    /// The partial temperature derivatives of the thermodynamic properties.
+    Matrix ddT;
+
+    /// The partial pressure derivatives of the thermodynamic properties.
+    Matrix ddP;
+
+    /// Construct a ThermoMatrix instance with given dimension.
+    explicit ThermoMatrix(Index n)
+    : val(n, n), ddT(n, n), ddP(n, n) {}
+
+    /// Set the entry (i, j) of the matrix.
+    auto set(Index i, Index j, const ThermoScalar& value) -> void
+    {
+        val(i, j) = value.val;
+        ddT(i, j) = value.ddT;
+        ddP(i, j) = value.ddP;
+    }
+};
+
+/// Calculate the mixing sum \f$ \sum_{ij}x_{i}x_{j}M_{ij} \f$ and, optionally, the partial molar terms
+/// \f$ 2\sum_{j}x_{j}M_{ij}-\sum_{ij}x_{i}x_{j}M_{ij} \f$ as matrix-vector products.
+/// @param M The matrix of binary parameters and their temperature and pressure derivatives
+/// @param x The mole fractions of the species and their partial derivatives
+/// @param[out] mix The mixing sum and its partial derivatives
+/// @param[out] bar The partial molar terms and their partial derivatives (ignored if null)
+/// @param y, yt, z Auxiliary vectors with dimension equal to the number of species
+auto mixingSums(const ThermoMatrix& M, const ChemicalVector& x, ChemicalScalar& mix, ChemicalVector* bar, Vector& y, Vector& yt, Vector& z) -> void
+{
+    y.noalias() = M.val * x.val;
+    yt.noalias() = M.val.transpose() * x.val;
+
+    mix.val = x.val.dot(y);
+    mix.ddn.noalias() = y.transpose() * x.ddn;
+    mix.ddn.noalias() += yt.transpose() * x.ddn;
+
+    z.noalias() = M.ddT * x.val;
+    mix.ddT = x.val.dot(z) + x.ddT.dot(y) + x.ddT.dot(yt);
+
+    if(bar)
+    {
+        bar->ddT.noalias() = 2.0 * z;
+        bar->ddT.noalias() += 2.0 * M.val * x.ddT;
+        bar->ddT.array() -= mix.ddT;
+    }
+
+    z.noalias() = M.ddP * x.val;
+    mix.ddP = x.val.dot(z) + x.ddP.dot(y) + x.ddP.dot(yt);
+
+    if(bar)
+    {
+        bar->ddP.noalias() = 2.0 * z;
+        bar->ddP.noalias() += 2.0 * M.val * x.ddP;
+        bar->ddP.array() -= mix.ddP;
+
+        bar->val = 2.0 * y;
+        bar->val.array() -= mix.val;
+
+        bar->ddn.noalias() = 2.0 * M.val * x.ddn;
+        bar->ddn.rowwise() -= mix.ddn;
+    }
+}
+
 } // namespace internal
 
 struct CubicEOS::Impl
 {
+    /// The workspace used in the evaluation of the cubic equation of state at a given state.
+    /// All its members are allocated once, so that repeated evaluations do not allocate memory.
+    struct Workspace
+    {
+        /// Construct a Workspace instance with given number of species.
+        explicit Workspace(unsigned nspecies)
+        : a(nspecies), aT(nspecies), aTT(nspecies), aij(nspecies), aijT(nspecies), aijTT(nspecies),
+          y(nspecies), yt(nspecies), z(nspecies),
+          amix(nspecies), amixT(nspecies), amixTT(nspecies), bmix(nspecies), abar(nspecies), abarT(nspecies),
+          beta(nspecies), betaT(nspecies), q(nspecies), qT(nspecies), qTT(nspecies),
+          A(nspecies), B(nspecies), C(nspecies), AT(nspecies), BT(nspecies), CT(nspecies),
+          Z(nspecies), ZT(nspecies), I(nspecies), IT(nspecies), dPdT(nspecies), dVdT(nspecies),
+          ai(nspecies), aiT(nspecies), qi(nspecies), qiT(nspecies), Bi(nspecies), Ci(nspecies), Zi(nspecies), Ii(nspecies)
+        {}
+
+        /// The flag that indicates if the mole fractions are positive and the evaluation can proceed.
+        bool valid = false;
+
+        /// The initial guess for the compressibility factor.
+        double Z0 = 0.0;
+
+        /// The parameters `a` of the species and their first and second temperature derivatives.
+        ThermoVector a, aT, aTT;
+
+        /// The binary parameters `aij` and their first and second temperature derivatives.
+        internal::ThermoMatrix aij, aijT, aijTT;
+
+        /// The auxiliary vectors used in the mixing sums.
+        Vector y, yt, z;
+
+        /// The mixing parameters of the phase.
+        ChemicalScalar amix, amixT, amixTT, bmix;
+
+        /// The partial molar parameters `abar` of the species and their temperature derivatives.
+        ChemicalVector abar, abarT;
+
+        /// The auxiliary phase quantities in the cubic equation of state.
+        ChemicalScalar beta, betaT, q, qT, qTT, A, B, C, AT, BT, CT, Z, ZT, I, IT, dPdT, dVdT;
+
+        /// The auxiliary species quantities in the cubic equation of state.
+        ChemicalScalar ai, aiT, qi, qiT, Bi, Ci, Zi, Ii;
+
+        /// The binary interaction parameters kij and their temperature derivatives.
+        InteractionParamsResult kres;
+    };
+
     /// The number of species in the phase.
     unsigned nspecies;
 
@@ -177,12 +291,27 @@ struct CubicEOS::Impl
     /// The function that calculates the interaction parameters kij and its temperature derivatives.
     InteractionParamsFunction calculate_interaction_params;
 
+    /// The alpha function of the cubic equation of state.
+    std::function<internal::AlphaResult(const ThermoScalar&, double)> alpha;
+
+    /// The factors \f$ \Psi R^{2}T_{c}^{2}/P_{c} \f$ of the parameters `a` of the species.
+    Vector afactors;
+
+    /// The parameters `b` of the species.
+    Vector b;
+
+    /// The workspaces of the states evaluated in a batch (the first is also used for a single state).
+    std::vector<Workspace> workspaces;
+
+    /// The coefficients of the cubic equations and the compressibility factors of the states evaluated in a batch.
+    Vector Acoeffs, Bcoeffs, Ccoeffs, Zvalues;
+
     /// The result with thermodynamic properties calculated from the cubic equation of state
     Result result;
 
     /// Construct a CubicEOS::Impl instance.
     Impl(unsigned nspecies)
-    : nspecies(nspecies)
+    : nspecies(nspecies), afactors(Vector::Zero(nspecies)), b(Vector::Zero(nspecies)), workspaces(1, Workspace(nspecies))
     {
         // Initialize the dimension of the chemical vector quantities
         ChemicalVector vec(nspecies);
@@ -190,62 +319,63 @@ struct CubicEOS::Impl
         result.residual_partial_molar_enthalpies = vec;
         result.residual_partial_molar_gibbs_energies = vec;
         result.ln_fugacity_coefficients = vec;
+
+        // Initialize the parameters that depend on the model
+        initialize();
     }
 
-    auto operator()(const ThermoScalar& T, const ThermoScalar& P, const ChemicalVector& x) -> Result
+    /// Update the parameters of the species that do not depend on temperature, pressure, and composition.
+    auto initialize() -> void
     {
-        // Check if the mole fractions are zero or non-initialized
-        if(x.val.size() == 0 || min(x.val) <= 0.0)
-            return Result(nspecies); // result with zero values
+        alpha = internal::alpha(model);
+
+        if(critical_temperatures.size() != nspecies || critical_pressures.size() != nspecies)
+            return;
 
-        // Auxiliary variables
         const double R = universalGasConstant;
         const double Psi = internal::Psi(model);
         const double Omega = internal::Omega(model);
-        const double epsilon = internal::epsilon(model);
-        const double sigma = internal::sigma(model);
-        const auto alpha = internal::alpha(model);
 
-        // Calculate the parameters `a` of the cubic equation of state for each species
-        ThermoVector a(nspecies);
-        ThermoVector aT(nspecies);
-        ThermoVector aTT(nspecies);
         for(unsigned i = 0; i < nspecies; ++i)
         {
             const double Tc = critical_temperatures[i];
             const double Pc = critical_pressures[i];
-            const double omega = acentric_factors[i];
-            const double factor = Psi*R*R*(Tc*Tc)/Pc;
-            const ThermoScalar Tr = T/Tc;
-            ThermoScalar alpha_val, alpha_ddt, alpha_d2dt2;
-            std::tie(alpha_val, alpha_ddt, alpha_d2dt2) = alpha(Tr, omega);
-            a[i] = factor * alpha_val;
-            aT[i] = factor * alpha_ddt;
-            aTT[i] = factor * alpha_d2dt2;
-        };
+            afactors[i] = Psi*R*R*(Tc*Tc)/Pc;
+            b[i] = Omega*R*Tc/Pc;
+        }
+    }
+
+    /// Calculate the coefficients of the cubic equation of state at a given state.
+    auto prepare(Workspace& ws, const ThermoScalar& T, const ThermoScalar& P, const ChemicalVector& x) -> void
+    {
+        // Check if the mole fractions are zero or non-initialized
+        ws.valid = x.val.size() != 0 && min(x.val) > 0.0;
+        if(!ws.valid)
+            return;
 
-        // Calculate the parameters `b` of the cubic equation of state for each species
-        Vector b(nspecies);
+        // Auxiliary variables
+        const double R = universalGasConstant;
+        const double epsilon = internal::epsilon(model);
+        const double sigma = internal::sigma(model);
+
+        // Calculate the parameters `a` of the cubic equation of state for each species
         for(unsigned i = 0; i < nspecies; ++i)
         {
-            const double Tci = critical_temperatures[i];
-            const double Pci = critical_pressures[i];
-            b[i] = Omega*R*Tci/Pci;
+            const ThermoScalar Tr = T/critical_temperatures[i];
+            ThermoScalar alpha_val, alpha_ddt, alpha_d2dt2;
+            std::tie(alpha_val, alpha_ddt, alpha_d2dt2) = alpha(Tr, acentric_factors[i]);
+            ws.a[i] = afactors[i] * alpha_val;
+            ws.aT[i] = afactors[i] * alpha_ddt;
+            ws.aTT[i] = afactors[i] * alpha_d2dt2;
         }
 
         // Calculate the table of binary interaction parameters and its temperature derivatives
-        InteractionParamsResult kres;
-        InteractionParamsArgs kargs{T, a, aT, aTT, b};
-
         if(calculate_interaction_params)
-            kres = calculate_interaction_params(kargs);
+            ws.kres = calculate_interaction_params(InteractionParamsArgs{T, ws.a, ws.aT, ws.aTT, b});
 
-        // Calculate the parameter `amix` of the phase and the partial molar parameters `abar` of each species
-        ChemicalScalar amix(nspecies);
-        ChemicalScalar amixT(nspecies);
-        ChemicalScalar amixTT(nspecies);
-        ChemicalVector abar(nspecies);
-        ChemicalVector abarT(nspecies);
+        const auto& kres = ws.kres;
+
+        // Calculate the binary parameters `aij` and their temperature derivatives
         for(unsigned i = 0; i < nspecies; ++i)
         {
             for(unsigned j = 0; j < nspecies; ++j)
@@ -254,110 +384,109 @@ struct CubicEOS::Impl
                 const ThermoScalar rT = kres.kT.empty() ? ThermoScalar(0.0) : -kres.kT[i][j];
                 const ThermoScalar rTT = kres.kTT.empty() ? ThermoScalar(0.0) : -kres.kTT[i][j];
 
-                const ThermoScalar s = sqrt(a[i]*a[j]);
-                const ThermoScalar sT = 0.5*s/(a[i]*a[j]) * (aT[i]*a[j] + a[i]*aT[j]);
-                const ThermoScalar sTT = 0.5*s/(a[i]*a[j]) * (aTT[i]*a[j] + 2*aT[i]*aT[j] + a[i]*aTT[j]) - sT*sT/s;
+                const ThermoScalar ai = ws.a[i], aj = ws.a[j];
+                const ThermoScalar aTi = ws.aT[i], aTj = ws.aT[j];
+                const ThermoScalar aTTi = ws.aTT[i], aTTj = ws.aTT[j];
 
-                const ThermoScalar aij = r*s;
-                const ThermoScalar aijT = rT*s + r*sT;
-                const ThermoScalar aijTT = rTT*s + 2.0*rT*sT + r*sTT;
+                const ThermoScalar s = sqrt(ai*aj);
+                const ThermoScalar sT = 0.5*s/(ai*aj) * (aTi*aj + ai*aTj);
+                const ThermoScalar sTT = 0.5*s/(ai*aj) * (aTTi*aj + 2*aTi*aTj + ai*aTTj) - sT*sT/s;
 
-                amix += x[i] * x[j] * aij;
-                amixT += x[i] * x[j] * aijT;
-                amixTT += x[i] * x[j] * aijTT;
-
-                abar[i] += 2 * x[j] * aij;
-                abarT[i] += 2 * x[j] * aijT;
+                ws.aij.set(i, j, r*s);
+                ws.aijT.set(i, j, rT*s + r*sT);
+                ws.aijTT.set(i, j, rTT*s + 2.0*rT*sT + r*sTT);
             }
         }
 
-        // Finalize the calculation of `abar` and `abarT`
-        for(unsigned i = 0; i < nspecies; ++i)
-        {
-            abar[i] -= amix;
-            abarT[i] -= amixT;
-        }
+        // Calculate the parameter `amix` of the phase and the partial molar parameters `abar` of each species
+        internal::mixingSums(ws.aij, x, ws.amix, &ws.abar, ws.y, ws.yt, ws.z);
+        internal::mixingSums(ws.aijT, x, ws.amixT, &ws.abarT, ws.y, ws.yt, ws.z);
+        internal::mixingSums(ws.aijTT, x, ws.amixTT, nullptr, ws.y, ws.yt, ws.z);
 
         // Calculate the parameter `bmix` of the cubic equation of state
-        ChemicalScalar bmix(nspecies);
-        Vector bbar(nspecies);
-        for(unsigned i = 0; i < nspecies; ++i)
-        {
-            const double Tci = critical_temperatures[i];
-            const double Pci = critical_pressures[i];
-            bbar[i] = Omega*R*Tci/Pci;
-            bmix += x[i] * bbar[i];
-        }
+        ws.bmix.val = b.dot(x.val);
+        ws.bmix.ddT = b.dot(x.ddT);
+        ws.bmix.ddP = b.dot(x.ddP);
+        ws.bmix.ddn.noalias() = b.transpose() * x.ddn;
 
         // Calculate the temperature derivative of `bmix`
         const double bmixT = 0.0; // no temperature dependence
 
         // Calculate auxiliary quantities `beta` and `q`
-        const ChemicalScalar beta = P*bmix/(R*T);
-        const ChemicalScalar betaT = beta * (bmixT/bmix - 1.0/T);
+        ws.beta = P*ws.bmix/(R*T);
+        ws.betaT = ws.beta * (bmixT/ws.bmix - 1.0/T);
 
-        const ChemicalScalar q = amix/(bmix*R*T);
-        const ChemicalScalar qT = q*(amixT/amix - 1.0/T);
-        const ChemicalScalar qTT = qT*qT/q + q*(1.0/(T*T) + amixTT/amix - amixT*amixT/(amix*amix));
+        ws.q = ws.amix/(ws.bmix*R*T);
+        ws.qT = ws.q*(ws.amixT/ws.amix - 1.0/T);
+        ws.qTT = ws.qT*ws.qT/ws.q + ws.q*(1.0/(T*T) + ws.amixTT/ws.amix - ws.amixT*ws.amixT/(ws.amix*ws.amix));
+
+        const auto& beta = ws.beta;
+        const auto& betaT = ws.betaT;
+        const auto& q = ws.q;
+        const auto& qT = ws.qT;
 
         // Calculate the coefficients A, B, C of the cubic equation of state
-        const ChemicalScalar A = (epsilon + sigma - 1)*beta - 1;
-        const ChemicalScalar B = (epsilon*sigma - epsilon - sigma)*beta*beta - (epsilon + sigma - q)*beta;
-        const ChemicalScalar C = -epsilon*sigma*beta*beta*beta - (epsilon*sigma + q)*beta*beta;
+        ws.A = (epsilon + sigma - 1)*beta - 1;
+        ws.B = (epsilon*sigma - epsilon - sigma)*beta*beta - (epsilon + sigma - q)*beta;
+        ws.C = -epsilon*sigma*beta*beta*beta - (epsilon*sigma + q)*beta*beta;
 
         // Calculate the partial temperature derivative of the coefficients A, B, C
-        const ChemicalScalar AT = (epsilon + sigma - 1)*betaT;
-        const ChemicalScalar BT = 2*(epsilon*sigma - epsilon - sigma)*beta*betaT + qT*beta - (epsilon + sigma - q)*betaT;
-        const ChemicalScalar CT = -3*epsilon*sigma*beta*beta*betaT - qT*beta*beta - 2*(epsilon*sigma + q)*beta*betaT;
-
-        // Define the non-linear function and its derivative for calculation of its root
-        const auto f = [&](double Z) -> std::tuple<double, double>
-        {
-            const double val = Z*Z*Z + A.val*Z*Z + B.val*Z + C.val;
-            const double grad = 3*Z*Z + 2*A.val*Z + B.val;
-            return std::make_tuple(val, grad);
-        };
-
-        // Define the parameters for Newton's method
-        const auto tolerance = 1e-6;
-        const auto maxiter = 100;
+        ws.AT = (epsilon + sigma - 1)*betaT;
+        ws.BT = 2*(epsilon*sigma - epsilon - sigma)*beta*betaT + qT*beta - (epsilon + sigma - q)*betaT;
+        ws.CT = -3*epsilon*sigma*beta*beta*betaT - qT*beta*beta - 2*(epsilon*sigma + q)*beta*betaT;
 
         // Determine the appropriate initial guess for the cubic equation of state
-        const double Z0 = isvapor ? 1.0 : beta.val;
+        ws.Z0 = isvapor ? 1.0 : beta.val;
+    }
 
-        // Calculate the compressibility factor Z using Newton's method
-        ChemicalScalar Z(nspecies);
-        Z.val = newton(f, Z0, tolerance, maxiter);
+    /// Calculate the thermodynamic properties of the phase at a given state with known compressibility factor.
+    auto finish(Workspace& ws, const ThermoScalar& T, const ThermoScalar& P, double Zval, Result& res) -> void
+    {
+        // Auxiliary variables
+        const double R = universalGasConstant;
+        const double epsilon = internal::epsilon(model);
+        const double sigma = internal::sigma(model);
+
+        const auto& beta = ws.beta;
+        const auto& betaT = ws.betaT;
+        const auto& q = ws.q;
+        const auto& qT = ws.qT;
+        const auto& qTT = ws.qTT;
+        const auto& A = ws.A;
+        const auto& B = ws.B;
+        const auto& C = ws.C;
+        const auto& Z = ws.Z;
+        const auto& ZT = ws.ZT;
+        const auto& I = ws.I;
+        const auto& IT = ws.IT;
 
         // Calculate the partial derivatives of Z (dZdT, dZdP, dZdn)
-        const double factor = -1.0/(3*Z.val*Z.val + 2*A.val*Z.val + B.val);
-        Z.ddT = factor * (A.ddT*Z.val*Z.val + B.ddT*Z.val + C.ddT);
-        Z.ddP = factor * (A.ddP*Z.val*Z.val + B.ddP*Z.val + C.ddP);
-        for(unsigned i = 0; i < nspecies; ++i)
-            Z.ddn[i] = factor * (A.ddn[i]*Z.val*Z.val + B.ddn[i]*Z.val + C.ddn[i]);
+        const double factor = -1.0/(3*Zval*Zval + 2*A.val*Zval + B.val);
+        ws.Z.val = Zval;
+        ws.Z.ddT = factor * (A.ddT*Zval*Zval + B.ddT*Zval + C.ddT);
+        ws.Z.ddP = factor * (A.ddP*Zval*Zval + B.ddP*Zval + C.ddP);
+        ws.Z.ddn = factor * (A.ddn*Zval*Zval + B.ddn*Zval + C.ddn);
 
         // Calculate the partial temperature derivative of Z
-        const ChemicalScalar ZT = -(AT*Z*Z + BT*Z + CT)/(3*Z*Z + 2*A*Z + B);
+        ws.ZT = -(ws.AT*Z*Z + ws.BT*Z + ws.CT)/(3*Z*Z + 2*A*Z + B);
 
         // Calculate the integration factor I and its temperature derivative IT
-        ChemicalScalar I;
-        if(epsilon != sigma) I = log((Z + sigma*beta)/(Z + epsilon*beta))/(sigma - epsilon);
-                        else I = beta/(Z + epsilon*beta);
+        if(epsilon != sigma) ws.I = log((Z + sigma*beta)/(Z + epsilon*beta))/(sigma - epsilon);
+                        else ws.I = beta/(Z + epsilon*beta);
 
         // Calculate the temperature derivative IT of the integration factor I
-        ChemicalScalar IT;
-        if(epsilon != sigma) IT = ((ZT + sigma*betaT)/(Z + sigma*beta) - (ZT + epsilon*betaT)/(Z + epsilon*beta))/(sigma - epsilon);
-                        else IT = I*(betaT/beta - (ZT + epsilon*betaT)/(Z + epsilon*beta));
-
-        ChemicalScalar& V = result.molar_volume;
-        ChemicalScalar& G_res = result.residual_molar_gibbs_energy;
-        ChemicalScalar& H_res = result.residual_molar_enthalpy;
-        ChemicalScalar& Cp_res = result.residual_molar_heat_capacity_cp;
-        ChemicalScalar& Cv_res = result.residual_molar_heat_capacity_cv;
-        ChemicalVector& Vi = result.partial_molar_volumes;
-        ChemicalVector& Gi_res = result.residual_partial_molar_gibbs_energies;
-        ChemicalVector& Hi_res = result.residual_partial_molar_enthalpies;
-        ChemicalVector& ln_phi = result.ln_fugacity_coefficients;
+        if(epsilon != sigma) ws.IT = ((ZT + sigma*betaT)/(Z + sigma*beta) - (ZT + epsilon*betaT)/(Z + epsilon*beta))/(sigma - epsilon);
+                        else ws.IT = I*(betaT/beta - (ZT + epsilon*betaT)/(Z + epsilon*beta));
+
+        ChemicalScalar& V = res.molar_volume;
+        ChemicalScalar& G_res = res.residual_molar_gibbs_energy;
+        ChemicalScalar& H_res = res.residual_molar_enthalpy;
+        ChemicalScalar& Cp_res = res.residual_molar_heat_capacity_cp;
+        ChemicalScalar& Cv_res = res.residual_molar_heat_capacity_cv;
+        ChemicalVector& Vi = res.partial_molar_volumes;
+        ChemicalVector& Gi_res = res.residual_partial_molar_gibbs_energies;
+        ChemicalVector& Hi_res = res.residual_partial_molar_enthalpies;
+        ChemicalVector& ln_phi = res.ln_fugacity_coefficients;
 
         // Calculate the partial molar Zi for each species
         V = Z*R*T/P;
@@ -365,35 +494,123 @@ struct CubicEOS::Impl
         H_res = R*T*(Z - 1 + T*qT*I);
         Cp_res = R*T*(ZT + qT*I + T*qTT + T*qT*IT) + H_res/T;
 
-        const ChemicalScalar dPdT = P*(1.0/T + ZT/Z);
-        const ChemicalScalar dVdT = V*(1.0/T + ZT/Z);
+        ws.dPdT = P*(1.0/T + ZT/Z);
+        ws.dVdT = V*(1.0/T + ZT/Z);
 
-        Cv_res = Cp_res - T*dPdT*dVdT + R;
+        Cv_res = Cp_res - T*ws.dPdT*ws.dVdT + R;
+
+        const auto& amix = ws.amix;
+        const auto& amixT = ws.amixT;
+        const auto& bmix = ws.bmix;
+        const auto& ai = ws.ai;
+        const auto& aiT = ws.aiT;
+        const auto& qi = ws.qi;
+        const auto& qiT = ws.qiT;
+        const auto& Bi = ws.Bi;
+        const auto& Ci = ws.Ci;
+        const auto& Zi = ws.Zi;
+        const auto& Ii = ws.Ii;
 
         for(unsigned i = 0; i < nspecies; ++i)
         {
-            const double bi = bbar[i];
+            const double bi = b[i];
             const ThermoScalar betai = P*bi/(R*T);
-            const ChemicalScalar ai = abar[i];
-            const ChemicalScalar aiT = abarT[i];
-            const ChemicalScalar qi = q*(1 + ai/amix - bi/bmix);
-            const ChemicalScalar qiT = qi*qT/q + q*(aiT - ai*amixT/amix)/amix;
+            ws.ai = ws.abar[i];
+            ws.aiT = ws.abarT[i];
+            ws.qi = q*(1 + ai/amix - bi/bmix);
+            ws.qiT = qi*qT/q + q*(aiT - ai*amixT/amix)/amix;
             const ThermoScalar Ai = (epsilon + sigma - 1.0)*betai - 1.0;
-            const ChemicalScalar Bi = (epsilon*sigma - epsilon - sigma)*(2*beta*betai - beta*beta) - (epsilon + sigma - q)*(betai - beta) - (epsilon + sigma - qi)*beta;
-            const ChemicalScalar Ci = -3*sigma*epsilon*beta*beta*betai + 2*epsilon*sigma*beta*beta*beta - (epsilon*sigma + qi)*beta*beta - 2*(epsilon*sigma + q)*(beta*betai - beta*beta);
-            const ChemicalScalar Zi = -(Ai*Z*Z + (Bi + B)*Z + Ci + 2*C)/(3*Z*Z + 2*A*Z + B);
-            ChemicalScalar Ii;
-            if(epsilon != sigma) Ii = I + ((Zi + sigma*betai)/(Z + sigma*beta) - (Zi + epsilon*betai)/(Z + epsilon*beta))/(sigma - epsilon);
-                            else Ii = I * (1 + betai/beta - (Zi + epsilon*betai)/(Z + epsilon*beta));
+            ws.Bi = (epsilon*sigma - epsilon - sigma)*(2*beta*betai - beta*beta) - (epsilon + sigma - q)*(betai - beta) - (epsilon + sigma - qi)*beta;
+            ws.Ci = -3*sigma*epsilon*beta*beta*betai + 2*epsilon*sigma*beta*beta*beta - (epsilon*sigma + qi)*beta*beta - 2*(epsilon*sigma + q)*(beta*betai - beta*beta);
+            ws.Zi = -(Ai*Z*Z + (Bi + B)*Z + Ci + 2*C)/(3*Z*Z + 2*A*Z + B);
+            if(epsilon != sigma) ws.Ii = I + ((Zi + sigma*betai)/(Z + sigma*beta) - (Zi + epsilon*betai)/(Z + epsilon*beta))/(sigma - epsilon);
+                            else ws.Ii = I * (1 + betai/beta - (Zi + epsilon*betai)/(Z + epsilon*beta));
 
             Vi[i] = R*T*Zi/P;
             Gi_res[i] = R*T*(Zi - (Zi - betai)/(Z - beta) - log(Z - beta) - qi*I - q*Ii + q*I);
             Hi_res[i] = R*T*(Zi - 1 + T*(qiT*I + qT*Ii - qT*I));
             ln_phi[i] = Gi_res[i]/(R*T);
         }
+    }
+
+    auto operator()(const ThermoScalar& T, const ThermoScalar& P, const ChemicalVector& x) -> Result
+    {
+        Workspace& ws = workspaces.front();
+
+        // Calculate the coefficients of the cubic equation of state
+        prepare(ws, T, P, x);
+
+        // Check if the mole fractions are zero or non-initialized
+        if(!ws.valid)
+            return Result(nspecies); // result with zero values
+
+        // Define the non-linear function and its derivative for calculation of its root
+        const auto f = [&](double Z) -> std::tuple<double, double>
+        {
+            const double val = Z*Z*Z + ws.A.val*Z*Z + ws.B.val*Z + ws.C.val;
+            const double grad = 3*Z*Z + 2*ws.A.val*Z + ws.B.val;
+            return std::make_tuple(val, grad);
+        };
+
+        // Define the parameters for Newton's method
+        const auto tolerance = 1e-6;
+        const auto maxiter = 100;
+
+        // Calculate the compressibility factor Z using Newton's method
+        const double Z = newton(f, ws.Z0, tolerance, maxiter);
+
+        // Calculate the thermodynamic properties of the phase
+        finish(ws, T, P, Z, result);
 
         return result;
     }
+
+    auto operator()(const std::vector<ThermoScalar>& T, const std::vector<ThermoScalar>& P, const std::vector<ChemicalVector>& x, std::vector<Result>& results) -> void
+    {
+        Assert(T.size() == P.size() && T.size() == x.size(),
+            "Cannot evaluate the cubic equation of state at a batch of states.",
+            "Expecting the same number of temperatures, pressures, and compositions.");
+
+        // The number of states in the batch
+        const Index npoints = T.size();
+
+        // Ensure there are enough workspaces and results for all states
+        while(workspaces.size() < npoints)
+            workspaces.emplace_back(nspecies);
+        results.resize(npoints);
+        for(Result& res : results)
+            if(res.ln_fugacity_coefficients.val.size() != nspecies)
+                res = Result(nspecies);
+
+        Acoeffs.resize(npoints);
+        Bcoeffs.resize(npoints);
+        Ccoeffs.resize(npoints);
+        Zvalues.resize(npoints);
+
+        // Calculate the coefficients of the cubic equations of all states
+        for(Index k = 0; k < npoints; ++k)
+        {
+            Workspace& ws = workspaces[k];
+            prepare(ws, T[k], P[k], x[k]);
+
+            // Use the trivial equation Z^3 + Z = 0 at Z = 0 for the states without valid mole fractions
+            Acoeffs[k] = ws.valid ? ws.A.val : 0.0;
+            Bcoeffs[k] = ws.valid ? ws.B.val : 1.0;
+            Ccoeffs[k] = ws.valid ? ws.C.val : 0.0;
+            Zvalues[k] = ws.valid ? ws.Z0 : 0.0;
+        }
+
+        // Calculate the compressibility factors of all states at once
+        newtonCubic(Acoeffs, Bcoeffs, Ccoeffs, Zvalues, 1e-6, 100);
+
+        // Calculate the thermodynamic properties of the phase at all states
+        for(Index k = 0; k < npoints; ++k)
+        {
+            if(workspaces[k].valid)
+                finish(workspaces[k], T[k], P[k], Zvalues[k], results[k]);
+            else results[k] = Result(nspecies); // result with zero values
+        }
+    }
 };
 
 CubicEOS::Result::Result()
@@ -436,6 +653,7 @@ auto CubicEOS::numSpecies() const -> unsigned
 auto CubicEOS::setModel(Model model) -> void
 {
     pimpl->model = model;
+    pimpl->initialize();
 }
 
 auto CubicEOS::setPhaseAsLiquid() -> void
@@ -460,6 +678,7 @@ auto CubicEOS::setCriticalTemperatures(const std::vector<double>& values) -> voi
         "temperatures of the gases.");
 
     pimpl->critical_temperatures = values;
+    pimpl->initialize();
 }
 
 auto CubicEOS::setCriticalPressures(const std::vector<double>& values) -> void
@@ -474,6 +693,7 @@ auto CubicEOS::setCriticalPressures(const std::vector<double>& values) -> void
         "pressures of the gases.");
 
     pimpl->critical_pressures = values;
+    pimpl->initialize();
 }
 
 auto CubicEOS::setAcentricFactors(const std::vector<double>& values) -> void
@@ -496,4 +716,9 @@ auto CubicEOS::operator()(const ThermoScalar& T, const ThermoScalar& P, const Ch
     return pimpl->operator()(T, P, x);
 }
 
+auto CubicEOS::operator()(const std::vector<ThermoScalar>& T, const std::vector<ThermoScalar>& P, const std::vector<ChemicalVector>& x, std::vector<Result>& results) -> void
+{
+    pimpl->operator()(T, P, x, results);
+}
+
 } // namespace Reaktoro
@@ -151,6 +151,16 @@ public:
     /// @param x The mole fractions of the species in the phase (in units of mol/mol)
     auto operator()(const ThermoScalar& T, const ThermoScalar& P, const ChemicalVector& x) -> Result;
 
+    /// Calculate the thermodynamic properties of the phase at a batch of states.
+    /// This method is equivalent to evaluating every state separately, but the compressibility factors
+    /// of all states are calculated in a single call to a batched cubic root solver. Use it to evaluate,
+    /// for example, the gaseous phase in every cell of a reactive transport mesh.
+    /// @param T The temperatures of the states (in units of K)
+    /// @param P The pressures of the states (in units of Pa)
+    /// @param x The mole fractions of the species at each state (in units of mol/mol)
+    /// @param[out] results The thermodynamic properties of the phase at each state
+    auto operator()(const std::vector<ThermoScalar>& T, const std::vector<ThermoScalar>& P, const std::vector<ChemicalVector>& x, std::vector<Result>& results) -> void;
+
 private:
     struct Impl;
 
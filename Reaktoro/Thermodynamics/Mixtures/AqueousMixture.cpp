@@ -71,6 +71,17 @@ AqueousMixture::AqueousMixture(const std::vector<AqueousSpecies>& species)
 
     // Initialize the dielectric constant function for water
     epsilon = epsilon_default = internal::defaultWaterDielectricConstantFunction();
+
+    // Initialize the squared charges used in the calculation of the ionic strengths
+    squared_charges = chargesSpecies().array().square();
+    dissociation_squared_charges = dissociation_matrix * rows(squared_charges, idx_charged_species);
+
+    // Initialize the ions and their stoichiometries in the dissociation of each neutral species
+    dissociation_ions.resize(dissociation_matrix.rows());
+    for(Index k = 0; k < dissociation_matrix.rows(); ++k)
+        for(Index i = 0; i < dissociation_matrix.cols(); ++i)
+            if(dissociation_matrix(k, i) != 0.0)
+                dissociation_ions[k].emplace_back(i, dissociation_matrix(k, i));
 }
 
 AqueousMixture::~AqueousMixture()
@@ -261,8 +272,7 @@ auto AqueousMixture::effectiveIonicStrength(const ChemicalVector& m) const -> Ch
 
     ChemicalScalar Ie(num_species);
     Ie.val = 0.5 * sum(z % z % m.val);
-    for(unsigned i = 0; i < num_species; ++i)
-        Ie.ddn[i] = 0.5 * sum(z % z % m.ddn.col(i));
+    Ie.ddn.noalias() = 0.5 * tr(z % z) * m.ddn;
 
     return Ie;
 }
@@ -274,8 +284,7 @@ auto AqueousMixture::stoichiometricIonicStrength(const ChemicalVector& ms) const
 
     ChemicalScalar Is(num_species);
     Is.val = 0.5 * sum(zc % zc % ms.val);
-    for(unsigned i = 0; i < num_species; ++i)
-        Is.ddn[i] = 0.5 * sum(zc % zc % ms.ddn.col(i));
+    Is.ddn.noalias() = 0.5 * tr(zc % zc) * ms.ddn;
 
     return Is;
 }
@@ -283,16 +292,100 @@ auto AqueousMixture::stoichiometricIonicStrength(const ChemicalVector& ms) const
 auto AqueousMixture::state(Temperature T, Pressure P, VectorConstRef n) const -> AqueousMixtureState
 {
     AqueousMixtureState res;
+    state(T, P, n, res);
+    return res;
+}
+
+auto AqueousMixture::state(Temperature T, Pressure P, VectorConstRef n, AqueousMixtureState& res) const -> void
+{
+    // Auxiliary variables
+    const Index num_species = numSpecies();
+    const Index num_charged = numChargedSpecies();
+    const Index num_neutral = numNeutralSpecies();
+
+    // Allocate the state only if it was not calculated before for this mixture, so that it is only overwritten.
+    // The molar derivatives of the molalities and stoichiometric molalities are zero except in the entries
+    // written below, which are the same in every evaluation, so that they are zeroed only here.
+    if(res.m.val.size() != num_species || res.ms.val.size() != num_charged)
+    {
+        res.x.resize(num_species);
+        res.m.resize(num_species);
+        res.ms.resize(num_charged, num_species);
+        res.Ie = ChemicalScalar(num_species);
+        res.Is = ChemicalScalar(num_species);
+    }
+
     res.T = T;
     res.P = P;
-    res.x = moleFractions(n);
     res.rho = rho(T, P);
     res.epsilon = epsilon(T, P);
-    res.m  = molalities(n);
-    res.ms = stoichiometricMolalities(res.m);
-    res.Ie = effectiveIonicStrength(res.m);
-    res.Is = stoichiometricIonicStrength(res.ms);
-    return res;
+
+    // The mole fractions of the species, with derivatives (delta_ij - x_i)/nt, which are dense
+    const double nt = n.sum();
+    if(num_species == 1)
+    {
+        res.x.val.fill(1.0);
+        res.x.ddn.fill(0.0);
+    }
+    else if(nt == 0.0)
+    {
+        res.x.val.fill(0.0);
+        res.x.ddn.fill(0.0);
+    }
+    else
+    {
+        res.x.val = n/nt;
+        res.x.ddn.colwise() = -res.x.val/nt;
+        res.x.ddn.diagonal().array() += 1.0/nt;
+    }
+
+    // The molar amount of water
+    const double nw = n[idx_water];
+
+    // The reciprocals of the amount and mass of water, zero if there is no water, so that the
+    // molalities and ionic strengths below, as well as their molar derivatives, are all zero
+    const double nw_inv = nw == 0.0 ? 0.0 : 1.0/nw;
+    const double kgH2O_inv = nw_inv/waterMolarMass;
+
+    // The molalities of the species, whose derivatives are a diagonal matrix plus a rank-one update in the column of water
+    res.m.val = n * kgH2O_inv;
+    res.m.ddn.diagonal().fill(kgH2O_inv);
+    res.m.ddn.col(idx_water) = -res.m.val * nw_inv;
+    res.m.ddn(idx_water, idx_water) += kgH2O_inv;
+
+    // The stoichiometric molalities of the ions, whose derivatives have the same structure
+    // in the columns of the charged species, the dissociated neutral species and water
+    for(Index i = 0; i < num_charged; ++i)
+    {
+        res.ms.val[i] = res.m.val[idx_charged_species[i]];
+        res.ms.ddn(i, idx_charged_species[i]) = kgH2O_inv;
+    }
+    for(Index k = 0; k < num_neutral; ++k)
+    {
+        for(const auto& pair : dissociation_ions[k])
+        {
+            res.ms.val[pair.first] += pair.second * res.m.val[idx_neutral_species[k]];
+            res.ms.ddn(pair.first, idx_neutral_species[k]) = pair.second * kgH2O_inv;
+        }
+    }
+    res.ms.ddn.col(idx_water) = -res.ms.val * nw_inv;
+
+    // The effective ionic strength and its derivatives, calculated in O(N) using the structure of the molality derivatives
+    res.Ie.val = 0.5 * squared_charges.dot(res.m.val);
+    res.Ie.ddn = 0.5 * kgH2O_inv * tr(squared_charges);
+    res.Ie.ddn[idx_water] = -res.Ie.val * nw_inv;
+
+    // The stoichiometric ionic strength and its derivatives, calculated likewise
+    res.Is.val = 0.0;
+    res.Is.ddn.fill(0.0);
+    for(Index i = 0; i < num_charged; ++i)
+    {
+        res.Is.val += 0.5 * squared_charges[idx_charged_species[i]] * res.ms.val[i];
+        res.Is.ddn[idx_charged_species[i]] = 0.5 * kgH2O_inv * squared_charges[idx_charged_species[i]];
+    }
+    for(Index k = 0; k < num_neutral; ++k)
+        res.Is.ddn[idx_neutral_species[k]] = 0.5 * kgH2O_inv * dissociation_squared_charges[k];
+    res.Is.ddn[idx_water] = -res.Is.val * nw_inv;
 }
 
 auto AqueousMixture::initializeIndices(const std::vector<AqueousSpecies>& species) -> void
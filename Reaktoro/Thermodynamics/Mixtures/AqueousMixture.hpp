@@ -188,6 +188,16 @@ public:
     /// @param n The molar amounts of the species in the mixture (in units of mol)
     auto state(Temperature T, Pressure P, VectorConstRef n) const -> AqueousMixtureState;
 
+    /// Calculate the state of the aqueous mixture in an existing instance.
+    /// The memory of `res` is reused if it was calculated before for this mixture, which avoids the
+    /// allocation of its molality derivatives in repeated evaluations. Only the non-zero entries of these
+    /// derivatives are then overwritten, so that `res` must not be modified between evaluations.
+    /// @param T The temperature (in units of K)
+    /// @param P The pressure (in units of Pa)
+    /// @param n The molar amounts of the species in the mixture (in units of mol)
+    /// @param[out] res The calculated state of the aqueous mixture
+    auto state(Temperature T, Pressure P, VectorConstRef n, AqueousMixtureState& res) const -> void;
+
 private:
     /// The index of the water species
     Index idx_water;
@@ -213,6 +223,15 @@ private:
     /// The dielectric constant function for water
     ThermoScalarFunction epsilon, epsilon_default;
 
+    /// The squared charges of all species in the mixture
+    Vector squared_charges;
+
+    /// The sum of the squared charges of the ions produced by the dissociation of each neutral species
+    Vector dissociation_squared_charges;
+
+    /// The indices (among the charged species) and stoichiometries of the ions produced by the dissociation of each neutral species
+    std::vector<std::vector<std::pair<Index, double>>> dissociation_ions;
+
     /// Initialize the index related data of the species.
     void initializeIndices(const std::vector<AqueousSpecies>& species);
 
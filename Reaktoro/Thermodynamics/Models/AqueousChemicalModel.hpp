@@ -0,0 +1,37 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright (C) 2014-2018 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+// C++ includes
+#include <functional>
+
+// Reaktoro includes
+#include <Reaktoro/Thermodynamics/Models/PhaseChemicalModel.hpp>
+
+namespace Reaktoro {
+
+// Forward declarations
+struct AqueousMixtureState;
+
+/// The signature of a function that calculates the chemical properties of an aqueous phase.
+/// The state of the aqueous mixture is calculated by the aqueous phase before calling this function,
+/// so that it is calculated only once per evaluation and also used by the activity models of selected species.
+/// @see AqueousMixtureState, PhaseChemicalModelResult, AqueousActivityModel
+using AqueousChemicalModel = std::function<void(PhaseChemicalModelResult&, const AqueousMixtureState&)>;
+
+} // namespace Reaktoro
@@ -27,13 +27,14 @@
 #include <Reaktoro/Common/Index.hpp>
 #include <Reaktoro/Common/NamingUtils.hpp>
 #include <Reaktoro/Math/BilinearInterpolator.hpp>
+#include <Reaktoro/Math/Matrix.hpp>
 #include <Reaktoro/Thermodynamics/Mixtures/AqueousMixture.hpp>
 #include <Reaktoro/Thermodynamics/Species/AqueousSpecies.hpp>
 #include <Reaktoro/Thermodynamics/Water/WaterConstants.hpp>
 
 namespace Reaktoro {
 
-auto aqueousChemicalModelDebyeHuckel(const AqueousMixture& mixture, const DebyeHuckelParams& params) -> PhaseChemicalModel
+auto aqueousChemicalModelDebyeHuckel(const AqueousMixture& mixture, const DebyeHuckelParams& params) -> AqueousChemicalModel
 {
     // The natural log of 10
     const double ln10 = std::log(10);
@@ -82,20 +83,14 @@ auto aqueousChemicalModelDebyeHuckel(const AqueousMixture& mixture, const DebyeH
         bneutral.push_back(params.bneutral(species.name()));
     }
 
-    // The state of the aqueous mixture
-    AqueousMixtureState state;
-
     // Auxiliary variables
     ChemicalScalar xw, ln_xw, I2, sqrtI, mSigma, sigma(num_species), sigmacoeff, Lambda;
     ChemicalVector ln_m;
     ThermoScalar A, B, sqrt_rho, T_epsilon, sqrt_T_epsilon;
 
     // Define the intermediate chemical model function of the aqueous mixture
-    PhaseChemicalModel model = [=](PhaseChemicalModelResult& res, Temperature T, Pressure P, VectorConstRef n) mutable
+    AqueousChemicalModel model = [=](PhaseChemicalModelResult& res, const AqueousMixtureState& state) mutable
     {
-        // Evaluate the state of the aqueous mixture
-        state = mixture.state(T, P, n);
-
         // Auxiliary constant references
         const auto& I = state.Ie;            // ionic strength
         const auto& x = state.x;             // mole fractions of the species
@@ -115,7 +110,7 @@ auto aqueousChemicalModelDebyeHuckel(const AqueousMixture& mixture, const DebyeH
 		I2 = I*I;
 		sqrtI = sqrt(I);
 		sqrt_rho = sqrt(rho);
-		T_epsilon = T * epsilon;
+		T_epsilon = state.T * epsilon;
 		sqrt_T_epsilon = sqrt(T_epsilon);
 		A = 1.824829238e+6 * sqrt_rho/(T_epsilon*sqrt_T_epsilon);
 		B = 50.29158649 * sqrt_rho/sqrt_T_epsilon;
@@ -176,6 +171,169 @@ auto aqueousChemicalModelDebyeHuckel(const AqueousMixture& mixture, const DebyeH
     return model;
 }
 
+auto aqueousChemicalModelDebyeHuckelVectorized(const AqueousMixture& mixture, const DebyeHuckelParams& params) -> AqueousChemicalModel
+{
+    // The natural log of 10
+    const double ln10 = std::log(10);
+
+    // The molar mass of water
+    const double Mw = waterMolarMass;
+
+    // The number of moles of water per kg
+    const double nwo = 1/Mw;
+
+    // The number of charged and neutral species in the mixture
+    const Index num_charged_species = mixture.numChargedSpecies();
+    const Index num_neutral_species = mixture.numNeutralSpecies();
+
+    // The indices of the charged and neutral species
+    const Indices icharged_species = mixture.indicesChargedSpecies();
+    const Indices ineutral_species = mixture.indicesNeutralSpecies();
+
+    // The index of the water species
+    const Index iwater = mixture.indexWater();
+
+    // The squared electrical charges of the charged species only
+    const Vector z2 = mixture.chargesChargedSpecies().array().square();
+
+    // The Debye-Huckel parameters a and b of the charged species
+    Vector aions(num_charged_species), bions(num_charged_species);
+
+    // The Debye-Huckel parameter b of the neutral species
+    Vector bneutral(num_neutral_species);
+
+    // Collect the Debye-Huckel parameters a and b of the charged species
+    for(Index i = 0; i < num_charged_species; ++i)
+    {
+        const AqueousSpecies& species = mixture.species(icharged_species[i]);
+        aions[i] = params.aion(species.name());
+        bions[i] = params.bion(species.name());
+    }
+
+    // Collect the Debye-Huckel parameter b of the neutral species
+    for(Index i = 0; i < num_neutral_species; ++i)
+    {
+        const AqueousSpecies& species = mixture.species(ineutral_species[i]);
+        bneutral[i] = params.bneutral(species.name());
+    }
+
+    // The sum of the terms b/z^2 of the charged species, which does not depend on the state
+    const double sum_bz2 = (bions.array()/z2.array()).sum();
+
+    // The ln activity coefficients of the charged species and their partial derivatives
+    // with respect to ionic strength I and the Debye-Huckel parameters A and B
+    Vector g, gI, gA, gB;
+
+    // The Lambda and sigma parameters of the charged species and the derivative of sigma with respect to (Lambda - 1)
+    Vector Lambda, sigma, dsigma;
+
+    // Auxiliary variables
+    ThermoScalar A, B, sqrt_rho, T_epsilon, sqrt_T_epsilon;
+
+    // Define the intermediate chemical model function of the aqueous mixture
+    AqueousChemicalModel model = [=](PhaseChemicalModelResult& res, const AqueousMixtureState& state) mutable
+    {
+        // Auxiliary constant references
+        const auto& I = state.Ie;            // ionic strength
+        const auto& x = state.x;             // mole fractions of the species
+        const auto& m = state.m;             // molalities of the species
+        const auto& rho = state.rho/1000;    // density in units of g/cm3
+        const auto& epsilon = state.epsilon; // dielectric constant
+
+        // Auxiliary references
+        auto& ln_g = res.ln_activity_coefficients;
+        auto& ln_a = res.ln_activities;
+
+        // Update the Debye-Huckel parameters A and B
+        sqrt_rho = sqrt(rho);
+        T_epsilon = state.T * epsilon;
+        sqrt_T_epsilon = sqrt(T_epsilon);
+        A = 1.824829238e+6 * sqrt_rho/(T_epsilon*sqrt_T_epsilon);
+        B = 50.29158649 * sqrt_rho/sqrt_T_epsilon;
+
+        // The square root of the ionic strength and its derivative with respect to ionic strength
+        const double sqrtI = std::sqrt(I.val);
+        const double sqrtI_I = 0.5/sqrtI;
+
+        // The mole fraction of water
+        const double xw = x.val[iwater];
+
+        // Calculate the Lambda parameters of all charged species at once
+        Lambda = 1.0 + aions.array()*(B.val*sqrtI);
+
+        // Calculate the ln activity coefficients of the charged species and their derivatives
+        g  = ln10*(-A.val*sqrtI*z2.array()/Lambda.array() + bions.array()*I.val);
+        gI = ln10*(-A.val*sqrtI_I*z2.array()/Lambda.array().square() + bions.array());
+        gA = -ln10*sqrtI*z2.array()/Lambda.array();
+        gB = ln10*A.val*I.val*(z2.array()*aions.array()/Lambda.array().square());
+
+        // Calculate the sigma parameters of the charged species and their derivatives with respect to Lambda - 1
+        const auto u = Lambda.array() - 1.0;
+        sigma  = (aions.array() != 0.0).select(3.0*(u*(u - 2.0) + 2.0*Lambda.array().log())/u.cube(), 2.0);
+        dsigma = (aions.array() != 0.0).select(3.0*(2.0*u - 2.0 + 2.0/Lambda.array())/u.cube() - 3.0*sigma.array()/u, 0.0);
+
+        // The molalities of the charged species
+        const auto mc = rows(m.val, icharged_species);
+
+        // The sigma coefficient and its derivatives with respect to ionic strength and A
+        const double sigmacoeff = (2.0/3.0)*A.val*I.val*sqrtI;
+        const double sigmacoeffI = A.val*sqrtI;
+        const double sigmacoeffA = (2.0/3.0)*I.val*sqrtI;
+
+        // The sum of the sigma parameters and of their derivatives with respect to ionic strength and B
+        const double sum_sigma = sigma.sum();
+        const double sum_sigmaI = B.val*sqrtI_I*aions.dot(dsigma);
+        const double sum_sigmaB = sqrtI*aions.dot(dsigma);
+
+        // The term mSigma and its derivative with respect to the mole fraction of water
+        const double mSigma = nwo * (1 - xw)/xw;
+        const double mSigma_xw = -nwo/(xw*xw);
+
+        // The sum in the activity of water and its partial derivatives with respect to I, A, B
+        const double W  = mSigma + mc.dot(g) + ln10*sigmacoeff*sum_sigma - ln10*I.val*I.val*sum_bz2;
+        const double WI = mc.dot(gI) + ln10*(sigmacoeffI*sum_sigma + sigmacoeff*sum_sigmaI) - 2*ln10*I.val*sum_bz2;
+        const double WA = mc.dot(gA) + ln10*sigmacoeffA*sum_sigma;
+        const double WB = mc.dot(gB) + ln10*sigmacoeff*sum_sigmaB;
+
+        // Set the ln activity coefficients of the charged species, with molar derivatives as a rank-one update through dI/dn
+        rows(ln_g.val, icharged_species) = g;
+        rows(ln_g.ddT, icharged_species) = gI*I.ddT + gA*A.ddT + gB*B.ddT;
+        rows(ln_g.ddP, icharged_species) = gI*I.ddP + gA*A.ddP + gB*B.ddP;
+        for(Index i = 0; i < num_charged_species; ++i)
+            ln_g.ddn.row(icharged_species[i]).noalias() = gI[i] * I.ddn;
+
+        // Set the ln activity coefficients of the neutral species, also as a rank-one update through dI/dn
+        rows(ln_g.val, ineutral_species) = ln10*I.val*bneutral;
+        rows(ln_g.ddT, ineutral_species) = ln10*I.ddT*bneutral;
+        rows(ln_g.ddP, ineutral_species) = ln10*I.ddP*bneutral;
+        for(Index i = 0; i < num_neutral_species; ++i)
+            ln_g.ddn.row(ineutral_species[i]).noalias() = (ln10*bneutral[i]) * I.ddn;
+
+        // Set the ln activities of the solutes (molality scale), with water overwritten below
+        ln_a.val = ln_g.val.array() + m.val.array().log();
+        ln_a.ddT = ln_g.ddT.array() + m.ddT.array()/m.val.array();
+        ln_a.ddP = ln_g.ddP.array() + m.ddP.array()/m.val.array();
+        ln_a.ddn.noalias() = m.val.cwiseInverse().asDiagonal() * m.ddn;
+        ln_a.ddn += ln_g.ddn;
+
+        // Set the ln activity of water (in mole fraction scale)
+        ln_a.val[iwater] = -W/nwo;
+        ln_a.ddT[iwater] = -(mSigma_xw*x.ddT[iwater] + g.dot(rows(m.ddT, icharged_species)) + WI*I.ddT + WA*A.ddT + WB*B.ddT)/nwo;
+        ln_a.ddP[iwater] = -(mSigma_xw*x.ddP[iwater] + g.dot(rows(m.ddP, icharged_species)) + WI*I.ddP + WA*A.ddP + WB*B.ddP)/nwo;
+        ln_a.ddn.row(iwater).noalias() = -(mSigma_xw/nwo)*x.ddn.row(iwater);
+        ln_a.ddn.row(iwater).noalias() -= (g.transpose() * rows(m.ddn, icharged_species))/nwo;
+        ln_a.ddn.row(iwater) -= (WI/nwo) * I.ddn;
+
+        // Set the activity coefficient of water (mole fraction scale)
+        ln_g.val[iwater] = ln_a.val[iwater] - std::log(xw);
+        ln_g.ddT[iwater] = ln_a.ddT[iwater] - x.ddT[iwater]/xw;
+        ln_g.ddP[iwater] = ln_a.ddP[iwater] - x.ddP[iwater]/xw;
+        ln_g.ddn.row(iwater) = ln_a.ddn.row(iwater) - x.ddn.row(iwater)/xw;
+    };
+
+    return model;
+}
+
 struct DebyeHuckelParams::Impl
 {
     /// The default value of the `a` parameter for ionic species.
@@ -22,7 +22,7 @@
 #include <memory>
 
 // Reaktoro includes
-#include <Reaktoro/Thermodynamics/Models/PhaseChemicalModel.hpp>
+#include <Reaktoro/Thermodynamics/Models/AqueousChemicalModel.hpp>
 
 namespace Reaktoro {
 
@@ -34,8 +34,19 @@ class DebyeHuckelParams;
 /// @param mixture The aqueous mixture instance
 /// @param params The parameters for the Debye--Hückel activity model.
 /// @return The activity model function for the aqueous phase
-/// @see AqueousMixture, DebyeHuckelParams, PhaseChemicalModel
-auto aqueousChemicalModelDebyeHuckel(const AqueousMixture& mixture, const DebyeHuckelParams& params) -> PhaseChemicalModel;
+/// @see AqueousMixture, DebyeHuckelParams, AqueousChemicalModel
+auto aqueousChemicalModelDebyeHuckel(const AqueousMixture& mixture, const DebyeHuckelParams& params) -> AqueousChemicalModel;
+
+/// Return an equation of state for an aqueous phase based on the Debye--Hückel activity model (vectorized).
+/// This model produces the same results as @ref aqueousChemicalModelDebyeHuckel, but evaluates the
+/// activity coefficients of all charged species at once over contiguous arrays, with their molar
+/// derivatives assembled as a single rank-one update through the molar derivatives of ionic strength.
+/// It is preferable for aqueous phases with many charged species.
+/// @param mixture The aqueous mixture instance
+/// @param params The parameters for the Debye--Hückel activity model.
+/// @return The activity model function for the aqueous phase
+/// @see AqueousMixture, DebyeHuckelParams, AqueousChemicalModel
+auto aqueousChemicalModelDebyeHuckelVectorized(const AqueousMixture& mixture, const DebyeHuckelParams& params) -> AqueousChemicalModel;
 
 /**
 A class used to define the parameters in the Debye--Hückel activity model for aqueous mixtures.
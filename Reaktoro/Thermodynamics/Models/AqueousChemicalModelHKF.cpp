@@ -27,6 +27,7 @@
 #include <Reaktoro/Common/Index.hpp>
 #include <Reaktoro/Common/NamingUtils.hpp>
 #include <Reaktoro/Math/BilinearInterpolator.hpp>
+#include <Reaktoro/Math/Matrix.hpp>
 #include <Reaktoro/Thermodynamics/Mixtures/AqueousMixture.hpp>
 #include <Reaktoro/Thermodynamics/Species/AqueousSpecies.hpp>
 #include <Reaktoro/Thermodynamics/Water/WaterConstants.hpp>
@@ -286,7 +287,7 @@ auto effectiveIonicRadius(const AqueousSpecies& species) -> double
 
 } // namespace
 
-auto aqueousChemicalModelHKF(const AqueousMixture& mixture) -> PhaseChemicalModel
+auto aqueousChemicalModelHKF(const AqueousMixture& mixture) -> AqueousChemicalModel
 {
     // The number of species in the mixture
     const unsigned num_species = mixture.numSpecies();
@@ -315,9 +316,6 @@ auto aqueousChemicalModelHKF(const AqueousMixture& mixture) -> PhaseChemicalMode
     // The molar mass of water
     const double Mw = waterMolarMass;
 
-    // The state of the aqueous mixture
-    AqueousMixtureState state;
-
     // Collect the effective radii of the ions
     for(Index idx_ion : icharged_species)
     {
@@ -327,11 +325,8 @@ auto aqueousChemicalModelHKF(const AqueousMixture& mixture) -> PhaseChemicalMode
     }
 
     // Define the chemical model function of the aqueous phase
-    PhaseChemicalModel model = [=](PhaseChemicalModelResult& res, Temperature T, Pressure P, VectorConstRef n) mutable
+    AqueousChemicalModel model = [=](PhaseChemicalModelResult& res, const AqueousMixtureState& state) mutable
     {
-        // Evaluate the state of the aqueous mixture
-        state = mixture.state(T, P, n);
-
         // Auxiliary references to state variables
         const auto& I = state.Ie;
         const auto& x = state.x;
@@ -351,10 +346,10 @@ auto aqueousChemicalModelHKF(const AqueousMixture& mixture) -> PhaseChemicalMode
         const ChemicalScalar alpha = xw/(1.0 - xw) * log10_xw;
 
         // The parameters for the HKF model
-        const double A = debyeHuckelParamA(T.val, P.val);
-        const double B = debyeHuckelParamB(T.val, P.val);
-        const double bNaCl = solventParamNaCl(T.val, P.val);
-        const double bNapClm = shortRangeInteractionParamNaCl(T.val, P.val);
+        const double A = debyeHuckelParamA(state.T.val, state.P.val);
+        const double B = debyeHuckelParamB(state.T.val, state.P.val);
+        const double bNaCl = solventParamNaCl(state.T.val, state.P.val);
+        const double bNapClm = shortRangeInteractionParamNaCl(state.T.val, state.P.val);
 
         // The osmotic coefficient of the aqueous phase
         ChemicalScalar phi(num_species);
@@ -433,4 +428,165 @@ auto aqueousChemicalModelHKF(const AqueousMixture& mixture) -> PhaseChemicalMode
     return model;
 }
 
+auto aqueousChemicalModelHKFVectorized(const AqueousMixture& mixture) -> AqueousChemicalModel
+{
+    // The number of charged species in the mixture
+    const unsigned num_charged_species = mixture.numChargedSpecies();
+
+    // The indices of the charged species
+    const Indices icharged_species = mixture.indicesChargedSpecies();
+
+    // The index of the water species
+    const Index iwater = mixture.indexWater();
+
+    // The Born coefficient of the ion H+
+    const double omegaH = 0.5387e+05;
+
+    // The natural log of 10
+    const double ln10 = std::log(10);
+
+    // The molar mass of water
+    const double Mw = waterMolarMass;
+
+    // The squared electrical charges of the charged species
+    Vector z2(num_charged_species);
+
+    // The Debye-Huckel ion size parameters of the charged species as computed by Reed (1982)
+    Vector a(num_charged_species);
+
+    // The Born coefficients and absolute Born coefficients of the charged species
+    Vector omega(num_charged_species), omega_abs(num_charged_species);
+
+    // The charge correction terms 0.19*(|z| - 1) of the charged species
+    Vector zcorr(num_charged_species);
+
+    // Collect the per-ion constants of the HKF model
+    for(unsigned i = 0; i < num_charged_species; ++i)
+    {
+        const AqueousSpecies& species = mixture.species(icharged_species[i]);
+        const double z = species.charge();
+        const double eff_radius = effectiveIonicRadius(species);
+        z2[i] = z*z;
+        omega[i] = eta*z*z/eff_radius - z*omegaH;
+        omega_abs[i] = eta*z*z/eff_radius;
+        zcorr[i] = 0.19*(std::abs(z) - 1.0);
+        a[i] = (z < 0) ?
+            2.0*(eff_radius + 1.91*std::abs(z))/(std::abs(z) + 1.0) :
+            2.0*(eff_radius + 1.81*std::abs(z))/(std::abs(z) + 1.0);
+    }
+
+    // The log10 activity coefficients of the charged species (without the water mole fraction
+    // contribution) and their derivatives with respect to ionic strength
+    Vector g, gI;
+
+    // The lambda, sigma, and psi parameters of the charged species and the derivatives of psi with respect to ionic strength
+    Vector lambda, sigma, psi, psiI;
+
+    // The flags (one or zero) indicating which charged species have non-zero molality
+    Vector active;
+
+    // Define the chemical model function of the aqueous phase
+    AqueousChemicalModel model = [=](PhaseChemicalModelResult& res, const AqueousMixtureState& state) mutable
+    {
+        // Auxiliary references to state variables
+        const auto& I = state.Ie;
+        const auto& x = state.x;
+        const auto& m = state.m;
+
+        // Auxiliary references
+        auto& ln_g = res.ln_activity_coefficients;
+        auto& ln_a = res.ln_activities;
+
+        // The square root of the ionic strength and its derivative with respect to ionic strength
+        const double sqrtI = std::sqrt(I.val);
+        const double sqrtI_I = 0.5/sqrtI;
+
+        // The mole fraction of the water species and its ln and log10
+        const double xw = x.val[iwater];
+        const double ln_xw = std::log(xw);
+        const double log10_xw = ln_xw/ln10;
+
+        // The alpha parameter and its derivative with respect to the mole fraction of water
+        const double alpha = xw/(1.0 - xw) * log10_xw;
+        const double alpha_xw = log10_xw/((1.0 - xw)*(1.0 - xw)) + 1.0/((1.0 - xw)*ln10);
+
+        // The parameters for the HKF model
+        const double A = debyeHuckelParamA(state.T.val, state.P.val);
+        const double B = debyeHuckelParamB(state.T.val, state.P.val);
+        const double bNaCl = solventParamNaCl(state.T.val, state.P.val);
+        const double bNapClm = shortRangeInteractionParamNaCl(state.T.val, state.P.val);
+
+        // The molalities of the charged species
+        const auto mc = rows(m.val, icharged_species);
+
+        // The charged species with zero molality are skipped, as in the per-ion model
+        active = (mc.array() != 0.0).cast<double>();
+
+        // Calculate the lambda parameters of all charged species at once
+        lambda = 1.0 + a.array()*(B*sqrtI);
+
+        // Calculate the log10 activity coefficients of the charged species (equation (298) in Helgeson et al. (1981), page 230)
+        g  = (active.array() != 0.0).select(-A*sqrtI*z2.array()/lambda.array() + (omega_abs.array()*bNaCl + bNapClm - zcorr.array())*I.val, 0.0);
+        gI = (active.array() != 0.0).select(-A*sqrtI_I*z2.array()/lambda.array().square() + omega_abs.array()*bNaCl + bNapClm - zcorr.array(), 0.0);
+
+        // Set the ln activity coefficients of the charged species, with molar derivatives as a rank-one update through dI/dn
+        ln_g.val.fill(0.0);
+        ln_g.ddT.fill(0.0);
+        ln_g.ddP.fill(0.0);
+        ln_g.ddn.fill(0.0);
+        rows(ln_g.val, icharged_species) = ln10*g + ln_xw*active;
+        rows(ln_g.ddT, icharged_species) = ln10*I.ddT*gI + (x.ddT[iwater]/xw)*active;
+        rows(ln_g.ddP, icharged_species) = ln10*I.ddP*gI + (x.ddP[iwater]/xw)*active;
+        for(unsigned i = 0; i < num_charged_species; ++i)
+            if(active[i] != 0.0)
+                ln_g.ddn.row(icharged_species[i]).noalias() = (ln10*gI[i]) * I.ddn + x.ddn.row(iwater)/xw;
+
+        // Set the activities of the solutes (molality scale), with water overwritten below
+        ln_a.val = ln_g.val.array() + m.val.array().log();
+        ln_a.ddT = ln_g.ddT.array() + m.ddT.array()/m.val.array();
+        ln_a.ddP = ln_g.ddP.array() + m.ddP.array()/m.val.array();
+        ln_a.ddn.noalias() = m.val.cwiseInverse().asDiagonal() * m.ddn;
+        ln_a.ddn += ln_g.ddn;
+
+        // Set the activity of water (in mole fraction scale)
+        if(xw != 1.0)
+        {
+            // Calculate the sigma and psi parameters of the charged species and the derivatives of psi with respect to ionic strength
+            const auto u = lambda.array() - 1.0;
+            const auto dsigma = 3.0*(1.0 - 1.0/lambda.array()).square()/u.cube();
+            const auto d = omega.array()*bNaCl + bNapClm - zcorr.array();
+            sigma = (active.array() != 0.0).select(3.0/u.cube() * (lambda.array() - 1.0/lambda.array() - 2.0*lambda.array().log()), 0.0);
+            psi   = (active.array() != 0.0).select(A*sqrtI*z2.array()*sigma.array()/3.0 + alpha - 0.5*d*I.val, 0.0);
+            psiI  = (active.array() != 0.0).select(A*z2.array()*(sqrtI_I*sigma.array() + sqrtI*(dsigma - 3.0*sigma.array()/u)*a.array()*B*sqrtI_I)/3.0 - 0.5*d, 0.0);
+
+            // The osmotic coefficient and its partial derivatives with respect to ionic strength and alpha
+            const double phi = mc.dot(psi);
+            const double phiI = mc.dot(psiI);
+            const double phialpha = mc.dot(active);
+
+            ln_a.val[iwater] = ln10 * Mw * phi;
+            ln_a.ddT[iwater] = ln10 * Mw * (psi.dot(rows(m.ddT, icharged_species)) + phiI*I.ddT + phialpha*alpha_xw*x.ddT[iwater]);
+            ln_a.ddP[iwater] = ln10 * Mw * (psi.dot(rows(m.ddP, icharged_species)) + phiI*I.ddP + phialpha*alpha_xw*x.ddP[iwater]);
+            ln_a.ddn.row(iwater).noalias() = (ln10 * Mw) * (psi.transpose() * rows(m.ddn, icharged_species));
+            ln_a.ddn.row(iwater) += (ln10 * Mw * phiI) * I.ddn;
+            ln_a.ddn.row(iwater) += (ln10 * Mw * phialpha * alpha_xw) * x.ddn.row(iwater);
+        }
+        else
+        {
+            ln_a.val[iwater] = ln_xw;
+            ln_a.ddT[iwater] = x.ddT[iwater]/xw;
+            ln_a.ddP[iwater] = x.ddP[iwater]/xw;
+            ln_a.ddn.row(iwater) = x.ddn.row(iwater)/xw;
+        }
+
+        // Set the activity coefficient of water (mole fraction scale)
+        ln_g.val[iwater] = ln_a.val[iwater] - ln_xw;
+        ln_g.ddT[iwater] = ln_a.ddT[iwater] - x.ddT[iwater]/xw;
+        ln_g.ddP[iwater] = ln_a.ddP[iwater] - x.ddP[iwater]/xw;
+        ln_g.ddn.row(iwater) = ln_a.ddn.row(iwater) - x.ddn.row(iwater)/xw;
+    };
+
+    return model;
+}
+
 } // namespace Reaktoro
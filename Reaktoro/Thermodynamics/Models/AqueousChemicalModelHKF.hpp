@@ -18,7 +18,7 @@
 #pragma once
 
 // Reaktoro includes
-#include <Reaktoro/Thermodynamics/Models/PhaseChemicalModel.hpp>
+#include <Reaktoro/Thermodynamics/Models/AqueousChemicalModel.hpp>
 
 namespace Reaktoro {
 
@@ -33,7 +33,17 @@ class AqueousMixture;
 ///     American Journal of Science, 281(10), 1249–1516.
 /// @param mixture The aqueous mixture
 /// @return The equation of state function for the aqueous phase
-/// @see AqueousMixture, PhaseChemicalModel
-auto aqueousChemicalModelHKF(const AqueousMixture& mixture) -> PhaseChemicalModel;
+/// @see AqueousMixture, AqueousChemicalModel
+auto aqueousChemicalModelHKF(const AqueousMixture& mixture) -> AqueousChemicalModel;
+
+/// Return an equation of state for an aqueous phase based on HKF model (vectorized).
+/// This model produces the same results as @ref aqueousChemicalModelHKF, but evaluates the
+/// activity coefficients and osmotic contributions of all charged species at once over contiguous
+/// arrays, with their molar derivatives assembled as a rank-one update through the molar derivatives
+/// of ionic strength. It is preferable for aqueous phases with many charged species.
+/// @param mixture The aqueous mixture
+/// @return The equation of state function for the aqueous phase
+/// @see AqueousMixture, AqueousChemicalModel
+auto aqueousChemicalModelHKFVectorized(const AqueousMixture& mixture) -> AqueousChemicalModel;
 
 } // namespace Reaktoro
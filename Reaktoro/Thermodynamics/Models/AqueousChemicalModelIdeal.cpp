@@ -22,18 +22,12 @@
 
 namespace Reaktoro {
 
-auto aqueousChemicalModelIdeal(const AqueousMixture& mixture) -> PhaseChemicalModel
+auto aqueousChemicalModelIdeal(const AqueousMixture& mixture) -> AqueousChemicalModel
 {
     const Index iH2O = mixture.indexWater();
 
-    // The state of the aqueous mixture
-    AqueousMixtureState state;
-
-    PhaseChemicalModel f = [=](PhaseChemicalModelResult& res, Temperature T, Pressure P, VectorConstRef n) mutable
+    AqueousChemicalModel f = [=](PhaseChemicalModelResult& res, const AqueousMixtureState& state)
     {
-        // Evaluate the state of the aqueous mixture
-        state = mixture.state(T, P, n);
-
         // The ln of water mole fraction
         ChemicalScalar ln_xw = log(state.x[iH2O]);
 
@@ -997,7 +997,7 @@ auto computeF(const AqueousMixtureState& state, const PitzerParams& pitzer) -> d
     const double sqrtI = std::sqrt(I);
 
     // The Debye-Huckel coefficient Aphi
-    const double Aphi = pitzer.Aphi(T.val, P.val);
+    const double Aphi = pitzer.Aphi(state.T.val, state.P.val);
 
     // The b parameter of the Harvie-Moller-Weare Pitzer's model
     const double b = 1.2;
@@ -1380,7 +1380,7 @@ auto lnActivityCoefficientNeutral(const AqueousMixtureState& state, const Pitzer
 
 } // namespace Pitzer
 
-auto aqueousChemicalModelPitzerHMW(const AqueousMixture& mixture) -> PhaseChemicalModel
+auto aqueousChemicalModelPitzerHMW(const AqueousMixture& mixture) -> AqueousChemicalModel
 {
     // Inject the Pitzer namespace here
     using namespace Pitzer;
@@ -1391,14 +1391,8 @@ auto aqueousChemicalModelPitzerHMW(const AqueousMixture& mixture) -> PhaseChemic
     // Initialize the Pitzer params
     PitzerParams pitzer(mixture);
 
-    // The state of the aqueous mixture
-    AqueousMixtureState state;
-
-    PhaseChemicalModel model = [=](PhaseChemicalModelResult& res, Temperature T, Pressure P, VectorConstRef n) mutable
+    AqueousChemicalModel model = [=](PhaseChemicalModelResult& res, const AqueousMixtureState& state)
     {
-        // Evaluate the state of the aqueous mixture
-        state = mixture.state(T, P, n);
-
         // Calculate the activity coefficients of the cations
         for(unsigned M = 0; M < pitzer.idx_cations.size(); ++M)
         {
@@ -336,12 +336,13 @@ auto speciesThermoStateHKF(Temperature T, Pressure P, const MineralSpecies& spec
     const auto& dPdT = hkf.dPdTtr;
 
     // Collect the temperature points used for the integrals along the pressure line P = Pr
-    std::vector<Temperature> Ti;
+    // (only the last point T depends on temperature, the others are constant)
+    std::vector<ThermoScalar> Ti;
 
-    Ti.push_back(Tr);
+    Ti.push_back(ThermoScalar(Tr));
 
     for(int i = 0; i < nt; ++i)
-        if(T > Tt[i]) Ti.push_back(Tt[i]);
+        if(T > Tt[i]) Ti.push_back(ThermoScalar(Tt[i]));
 
     Ti.push_back(T);
 
@@ -353,11 +354,10 @@ auto speciesThermoStateHKF(Temperature T, Pressure P, const MineralSpecies& spec
             Pt.push_back(Pr + dPdT[i]*(T - Tt[i]));
     }
 
-    // Calculate the heat capacity of the mineral at T
-    ThermoScalar Cp;
-    for(unsigned i = 0; i+1 < Ti.size(); ++i)
-        if(Ti[i] <= T && T <= Ti[i+1])
-            Cp = a[i] + b[i]*T + c[i]/(T*T);
+    // Calculate the heat capacity of the mineral at T using the coefficients of the last interval, which contains T
+    // (note that below Tr the interval is [T, Tr], whose coefficients are those of the first interval)
+    const unsigned k = Ti.size() - 2;
+    ThermoScalar Cp = a[k] + b[k]*T + c[k]/(T*T);
 
     // Calculate the integrals of the heat capacity function of the mineral from Tr to T at constant pressure Pr
     ThermoScalar CpdT;
@@ -39,7 +39,7 @@ struct AqueousPhase::Impl
     AqueousMixture mixture;
 
     /// The base chemical model of the phase (yet to be combined with the custom activity coefficient models below)
-    PhaseChemicalModel base_model;
+    AqueousChemicalModel base_model;
 
     /// The functions that calculate the ln activity coefficients of selected species
     std::map<Index, AqueousActivityModel> ln_activity_coeff_functions;
@@ -65,20 +65,21 @@ struct AqueousPhase::Impl
         // Create a copy of the data member `ln_activity_coeff_functions` to be used in the following lambda function
         auto ln_activity_coeff_functions = this->ln_activity_coeff_functions;
 
-        // The state of the aqueous mixture
+        // The state of the aqueous mixture, owned by this function only and
+        // shared by the base chemical model and the activity models
         AqueousMixtureState state;
 
         // Define the function that calculates the chemical properties of the phase
         PhaseChemicalModel model = [=](PhaseChemicalModelResult& res, Temperature T, Pressure P, VectorConstRef n) mutable
         {
-            // Evaluate the state of the aqueous mixture
-            state = mixture.state(T, P, n);
+            // Evaluate the state of the aqueous mixture once for all models below
+            mixture.state(T, P, n, state);
 
             // Evaluate the aqueous chemical model
-			base_model(res, T, P, n);
-            
+            base_model(res, state);
+
             // Update the activity coefficients and activities of selected species
-            for(auto pair : ln_activity_coeff_functions)
+            for(const auto& pair : ln_activity_coeff_functions)
             {
                 const Index& i = pair.first; // the index of the selected species
                 const AqueousActivityModel& func = pair.second; // the ln activity coefficient function of the selected species
@@ -148,6 +149,27 @@ auto AqueousPhase::setChemicalModelHKF() -> AqueousPhase&
     return *this;
 }
 
+auto AqueousPhase::setChemicalModelDebyeHuckelVectorized() -> AqueousPhase&
+{
+    return setChemicalModelDebyeHuckelVectorized({});
+}
+
+auto AqueousPhase::setChemicalModelDebyeHuckelVectorized(const DebyeHuckelParams& params) -> AqueousPhase&
+{
+    pimpl->ln_activity_coeff_functions.clear();
+    pimpl->base_model = aqueousChemicalModelDebyeHuckelVectorized(mixture(), params);
+    setChemicalModel(pimpl->combinedChemicalModel());
+    return *this;
+}
+
+auto AqueousPhase::setChemicalModelHKFVectorized() -> AqueousPhase&
+{
+    pimpl->ln_activity_coeff_functions.clear();
+    pimpl->base_model = aqueousChemicalModelHKFVectorized(mixture());
+    setChemicalModel(pimpl->combinedChemicalModel());
+    return *this;
+}
+
 auto AqueousPhase::setChemicalModelPitzerHMW() -> AqueousPhase&
 {
     pimpl->ln_activity_coeff_functions.clear();
@@ -62,6 +62,19 @@ public:
     /// Set the chemical model of the phase with the HKF equation of state.
     auto setChemicalModelHKF() -> AqueousPhase&;
 
+    /// Set the chemical model of the phase with the vectorized Debye-Huckel equation of state.
+    /// This produces the same results as @ref setChemicalModelDebyeHuckel, but the charged
+    /// species are evaluated at once over contiguous arrays, which is faster for phases with many ions.
+    /// {
+    auto setChemicalModelDebyeHuckelVectorized() -> AqueousPhase&;
+    auto setChemicalModelDebyeHuckelVectorized(const DebyeHuckelParams& params) -> AqueousPhase&;
+    /// }
+
+    /// Set the chemical model of the phase with the vectorized HKF equation of state.
+    /// This produces the same results as @ref setChemicalModelHKF, but the charged
+    /// species are evaluated at once over contiguous arrays, which is faster for phases with many ions.
+    auto setChemicalModelHKFVectorized() -> AqueousPhase&;
+
     /// Set the chemical model of the phase with the Pitzer equation of state.
     /// Uses the Pitzer equation of state described in:
     /// *Harvie, C.E., Møller, N., Weare, J.H. (1984). The prediction of mineral
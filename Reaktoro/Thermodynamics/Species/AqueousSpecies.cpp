@@ -69,6 +69,13 @@ auto AqueousSpecies::thermoData() const -> const AqueousSpeciesThermoData&
     return pimpl->thermo;
 }
 
+auto AqueousSpecies::clone() const -> AqueousSpecies
+{
+    AqueousSpecies copy(Species::clone());
+    *copy.pimpl = *pimpl;
+    return copy;
+}
+
 } // namespace Reaktoro
 
 
@@ -57,6 +57,9 @@ public:
     /// Return the thermodynamic data of the aqueous species.
     auto thermoData() const -> const AqueousSpeciesThermoData&;
 
+    /// Return a copy of the aqueous species that does not share its data with this one.
+    auto clone() const -> AqueousSpecies;
+
 private:
     struct Impl;
 
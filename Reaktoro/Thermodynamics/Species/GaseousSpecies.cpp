@@ -89,4 +89,11 @@ auto GaseousSpecies::thermoData() const -> const GaseousSpeciesThermoData&
     return pimpl->thermo;
 }
 
+auto GaseousSpecies::clone() const -> GaseousSpecies
+{
+    GaseousSpecies copy(Species::clone());
+    *copy.pimpl = *pimpl;
+    return copy;
+}
+
 } // namespace Reaktoro
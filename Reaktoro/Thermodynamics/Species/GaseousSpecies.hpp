@@ -60,6 +60,9 @@ public:
     /// Return the thermodynamic data of the gaseous species.
     auto thermoData() const -> const GaseousSpeciesThermoData&;
 
+    /// Return a copy of the gaseous species that does not share its data with this one.
+    auto clone() const -> GaseousSpecies;
+
 private:
     struct Impl;
 
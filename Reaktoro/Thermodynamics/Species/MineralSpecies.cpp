@@ -43,4 +43,11 @@ auto MineralSpecies::thermoData() const -> const MineralSpeciesThermoData&
     return pimpl->thermo;
 }
 
+auto MineralSpecies::clone() const -> MineralSpecies
+{
+    MineralSpecies copy(Species::clone());
+    *copy.pimpl = *pimpl;
+    return copy;
+}
+
 } // namespace Reaktoro
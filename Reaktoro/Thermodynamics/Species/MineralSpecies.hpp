@@ -39,6 +39,9 @@ public:
     /// Return the thermodynamic data of the mineral species.
     auto thermoData() const -> const MineralSpeciesThermoData&;
 
+    /// Return a copy of the mineral species that does not share its data with this one.
+    auto clone() const -> MineralSpecies;
+
 private:
     struct Impl;
 
@@ -0,0 +1,328 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright (C) 2014-2018 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+#include "FiniteVolumeTransportSolver.hpp"
+
+// C++ includes
+#include <algorithm>
+
+// Reaktoro includes
+#include <Reaktoro/Common/Exception.hpp>
+#include <Reaktoro/Common/ParallelUtils.hpp>
+#include <Reaktoro/Common/Profiling.hpp>
+
+namespace Reaktoro {
+
+FiniteVolumeMesh::FiniteVolumeMesh()
+{
+    setCells(Vector(), Matrix(0, 3));
+}
+
+FiniteVolumeMesh::FiniteVolumeMesh(Index nx, Index ny, double Lx, double Ly)
+: FiniteVolumeMesh(nx, ny, 1, Lx, Ly, 1.0)
+{
+    // Remove the boundary faces at z = 0 and z = Lz, since the 2D domain has unit thickness
+    Index k = 0;
+    for(Index i = 0; i < numBoundaryFaces(); ++i)
+    {
+        if(m_boundary_tags[i] >= 4) continue;
+        m_boundary_cells[k] = m_boundary_cells[i];
+        m_boundary_areas[k] = m_boundary_areas[i];
+        m_boundary_normals.row(k) = m_boundary_normals.row(i);
+        m_boundary_distances[k] = m_boundary_distances[i];
+        m_boundary_tags[k] = m_boundary_tags[i];
+        ++k;
+    }
+    m_boundary_cells.resize(k);
+    m_boundary_tags.resize(k);
+    m_boundary_areas.conservativeResize(k);
+    m_boundary_normals.conservativeResize(k, 3);
+    m_boundary_distances.conservativeResize(k);
+}
+
+FiniteVolumeMesh::FiniteVolumeMesh(Index nx, Index ny, Index nz, double Lx, double Ly, double Lz)
+{
+    Assert(nx > 0 && ny > 0 && nz > 0,
+        "Could not create the structured finite-volume mesh.",
+        "The number of cells along every axis must be positive.");
+
+    const double dx = Lx/nx;
+    const double dy = Ly/ny;
+    const double dz = Lz/nz;
+    const Index num_cells = nx * ny * nz;
+
+    auto index = [=](Index i, Index j, Index k) { return i + nx*(j + ny*k); };
+
+    Vector volumes = constants(num_cells, dx*dy*dz);
+    Matrix centroids(num_cells, 3);
+    for(Index k = 0; k < nz; ++k)
+        for(Index j = 0; j < ny; ++j)
+            for(Index i = 0; i < nx; ++i)
+                centroids.row(index(i, j, k)) << (i + 0.5)*dx, (j + 0.5)*dy, (k + 0.5)*dz;
+
+    setCells(volumes, centroids);
+
+    const Vector ex = unit(3, 0);
+    const Vector ey = unit(3, 1);
+    const Vector ez = unit(3, 2);
+
+    for(Index k = 0; k < nz; ++k)
+        for(Index j = 0; j < ny; ++j)
+            for(Index i = 0; i < nx; ++i)
+            {
+                const Index icell = index(i, j, k);
+                if(i + 1 < nx) addFace(icell, index(i + 1, j, k), dy*dz, ex);
+                if(j + 1 < ny) addFace(icell, index(i, j + 1, k), dx*dz, ey);
+                if(k + 1 < nz) addFace(icell, index(i, j, k + 1), dx*dy, ez);
+                if(i == 0)      addBoundaryFace(icell, dy*dz, -ex, 0.5*dx, 0);
+                if(i == nx - 1) addBoundaryFace(icell, dy*dz,  ex, 0.5*dx, 1);
+                if(j == 0)      addBoundaryFace(icell, dx*dz, -ey, 0.5*dy, 2);
+                if(j == ny - 1) addBoundaryFace(icell, dx*dz,  ey, 0.5*dy, 3);
+                if(k == 0)      addBoundaryFace(icell, dx*dy, -ez, 0.5*dz, 4);
+                if(k == nz - 1) addBoundaryFace(icell, dx*dy,  ez, 0.5*dz, 5);
+            }
+}
+
+auto FiniteVolumeMesh::setCells(VectorConstRef volumes, MatrixConstRef centroids) -> void
+{
+    Assert(centroids.rows() == volumes.rows() && centroids.cols() == 3,
+        "Could not set the cells of the finite-volume mesh.",
+        "The centroids must be given as a matrix with one row per cell and three columns.");
+
+    m_volumes = volumes;
+    m_centroids = centroids;
+    m_owners.clear();
+    m_neighbours.clear();
+    m_face_areas.resize(0);
+    m_face_normals.resize(0, 3);
+    m_face_distances.resize(0);
+    m_boundary_cells.clear();
+    m_boundary_areas.resize(0);
+    m_boundary_normals.resize(0, 3);
+    m_boundary_distances.resize(0);
+    m_boundary_tags.clear();
+}
+
+auto FiniteVolumeMesh::addFace(Index owner, Index neighbour, double area, VectorConstRef normal) -> void
+{
+    Assert(owner < numCells() && neighbour < numCells() && owner != neighbour,
+        "Could not add the face to the finite-volume mesh.",
+        "The owner and neighbour cells must be distinct cells of the mesh.");
+
+    const Index k = numFaces();
+    m_owners.push_back(owner);
+    m_neighbours.push_back(neighbour);
+    m_face_areas.conservativeResize(k + 1);
+    m_face_normals.conservativeResize(k + 1, 3);
+    m_face_distances.conservativeResize(k + 1);
+    m_face_areas[k] = area;
+    m_face_normals.row(k) = tr(normal);
+    m_face_distances[k] = (m_centroids.row(neighbour) - m_centroids.row(owner)).norm();
+}
+
+auto FiniteVolumeMesh::addBoundaryFace(Index cell, double area, VectorConstRef normal, double distance, Index tag) -> void
+{
+    Assert(cell < numCells(),
+        "Could not add the boundary face to the finite-volume mesh.",
+        "The index of the cell is out of range.");
+
+    const Index k = numBoundaryFaces();
+    m_boundary_cells.push_back(cell);
+    m_boundary_tags.push_back(tag);
+    m_boundary_areas.conservativeResize(k + 1);
+    m_boundary_normals.conservativeResize(k + 1, 3);
+    m_boundary_distances.conservativeResize(k + 1);
+    m_boundary_areas[k] = area;
+    m_boundary_normals.row(k) = tr(normal);
+    m_boundary_distances[k] = distance;
+}
+
+FiniteVolumeTransportSolver::FiniteVolumeTransportSolver()
+{
+    velocity = zeros(3);
+}
+
+auto FiniteVolumeTransportSolver::setMesh(const FiniteVolumeMesh& mesh) -> void
+{
+    mesh_ = mesh;
+    fluxes.resize(0);
+    boundary_fluxes.resize(0);
+}
+
+auto FiniteVolumeTransportSolver::setVelocity(VectorConstRef velocity) -> void
+{
+    Assert(velocity.rows() == 3,
+        "Could not set the velocity of the finite-volume transport solver.",
+        "The velocity vector must have three components.");
+
+    this->velocity = velocity;
+    fluxes.resize(0);
+    boundary_fluxes.resize(0);
+}
+
+auto FiniteVolumeTransportSolver::setFluxes(VectorConstRef fluxes, VectorConstRef boundary_fluxes) -> void
+{
+    Assert(fluxes.rows() == mesh_.numFaces() && boundary_fluxes.rows() == mesh_.numBoundaryFaces(),
+        "Could not set the fluxes of the finite-volume transport solver.",
+        "The number of fluxes does not match the number of faces in the mesh.");
+
+    this->fluxes = fluxes;
+    this->boundary_fluxes = boundary_fluxes;
+}
+
+auto FiniteVolumeTransportSolver::courant() const -> double
+{
+    const Index num_cells = mesh_.numCells();
+    const auto& owners = mesh_.owners();
+    const auto& neighbours = mesh_.neighbours();
+    const auto& bcells = mesh_.boundaryCells();
+
+    // The sum of the outflow rates of every cell
+    Vector outflow = zeros(num_cells);
+    for(Index k = 0; k < fluxes.size(); ++k)
+        outflow[fluxes[k] > 0.0 ? owners[k] : neighbours[k]] += std::abs(fluxes[k]);
+    for(Index k = 0; k < boundary_fluxes.size(); ++k)
+        outflow[bcells[k]] += std::max(boundary_fluxes[k], 0.0);
+
+    return num_cells ? (outflow.array() * dt / mesh_.volumes().array()).maxCoeff() : 0.0;
+}
+
+auto FiniteVolumeTransportSolver::initialize() -> void
+{
+    const Index num_cells = mesh_.numCells();
+    const Index num_faces = mesh_.numFaces();
+    const Index num_boundary_faces = mesh_.numBoundaryFaces();
+    const auto& owners = mesh_.owners();
+    const auto& neighbours = mesh_.neighbours();
+    const auto& areas = mesh_.faceAreas();
+    const auto& distances = mesh_.faceDistances();
+    const auto& bcells = mesh_.boundaryCells();
+
+    // Compute the fluxes across the faces from the uniform velocity if these were not given
+    if(fluxes.rows() != num_faces || boundary_fluxes.rows() != num_boundary_faces)
+    {
+        fluxes = areas.cwiseProduct(mesh_.faceNormals() * velocity);
+        boundary_fluxes = mesh_.boundaryAreas().cwiseProduct(mesh_.boundaryNormals() * velocity);
+    }
+
+    // Assemble the triplets of the advection and diffusion operator, four for every face
+    using Triplet = Eigen::Triplet<double>;
+    std::vector<Triplet> triplets(4 * num_faces);
+
+    parallelFor(num_faces, [&](Index begin, Index end)
+    {
+        for(Index k = begin; k < end; ++k)
+        {
+            const Index o = owners[k];
+            const Index n = neighbours[k];
+            const double F = fluxes[k];
+            const double Fp = std::max(F, 0.0); // the flow rate leaving the owner cell
+            const double Fm = std::min(F, 0.0); // the flow rate entering the owner cell
+            const double D = diffusion * areas[k] / distances[k];
+            triplets[4*k + 0] = Triplet(o, o,  Fp + D);
+            triplets[4*k + 1] = Triplet(o, n,  Fm - D);
+            triplets[4*k + 2] = Triplet(n, o, -Fp - D);
+            triplets[4*k + 3] = Triplet(n, n, -Fm + D);
+        }
+    }, num_threads);
+
+    // Add the outflow rates across the boundary faces to the diagonal and collect the inflow rates
+    inflow = zeros(num_cells);
+    for(Index k = 0; k < num_boundary_faces; ++k)
+    {
+        const double F = boundary_fluxes[k];
+        if(F > 0.0) triplets.emplace_back(bcells[k], bcells[k], F);
+        else inflow[bcells[k]] -= F;
+    }
+
+    // Ensure every diagonal entry exists so that the accumulation term can be added later
+    for(Index i = 0; i < num_cells; ++i)
+        triplets.emplace_back(i, i, 0.0);
+
+    K.resize(num_cells, num_cells);
+    K.setFromTriplets(triplets.begin(), triplets.end());
+    K.makeCompressed();
+
+    factorize();
+}
+
+auto FiniteVolumeTransportSolver::factorize() -> void
+{
+    Assert(dt > 0.0,
+        "Could not initialize the finite-volume transport solver.",
+        "The time step must be positive.");
+
+    // Add the accumulation term V/dt to the diagonal of the flux operator
+    const auto& volumes = mesh_.volumes();
+    M = K;
+    for(Index i = 0; i < M.rows(); ++i)
+        M.coeffRef(i, i) += volumes[i]/dt;
+
+    auto factorization = std::make_shared<Eigen::SparseLU<SparseMatrix>>();
+    factorization->compute(M);
+
+    Assert(factorization->info() == Eigen::Success,
+        "Could not initialize the finite-volume transport solver.",
+        "The LU factorization of the transport operator failed.");
+
+    lu = factorization;
+    dt_factorized = dt;
+}
+
+auto FiniteVolumeTransportSolver::step(VectorRef u, VectorConstRef q) -> void
+{
+    ProfilerScope("FiniteVolumeTransportSolver::step");
+
+    // Update the LU factorization if the time step has changed since the last one
+    if(dt != dt_factorized)
+        factorize();
+
+    const auto& volumes = mesh_.volumes();
+
+    Vector rhs = volumes.cwiseProduct(u + dt*q)/dt + inflow*ubc;
+    u = lu->solve(rhs);
+}
+
+auto FiniteVolumeTransportSolver::step(VectorRef u) -> void
+{
+    step(u, zeros(u.size()));
+}
+
+auto FiniteVolumeTransportSolver::step(MatrixRef U, VectorConstRef ubc) -> void
+{
+    ProfilerScope("FiniteVolumeTransportSolver::step");
+
+    Assert(U.cols() == ubc.rows(),
+        "Could not step the finite-volume transport solver.",
+        "The number of boundary values does not match the number of variables.");
+
+    // Update the LU factorization if the time step has changed since the last one
+    if(dt != dt_factorized)
+        factorize();
+
+    const Vector w = mesh_.volumes()/dt;
+
+    // Solve for the variables in parallel, each thread taking a block of columns
+    parallelFor(U.cols(), [&](Index begin, Index end)
+    {
+        Matrix rhs = w.asDiagonal() * U.middleCols(begin, end - begin);
+        rhs.noalias() += inflow * tr(ubc.segment(begin, end - begin));
+        U.middleCols(begin, end - begin) = lu->solve(rhs);
+    }, num_threads);
+}
+
+} // namespace Reaktoro
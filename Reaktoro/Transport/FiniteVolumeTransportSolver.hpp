@@ -0,0 +1,277 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright (C) 2014-2018 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+// C++ includes
+#include <memory>
+#include <vector>
+
+// Reaktoro includes
+#include <Reaktoro/Common/Index.hpp>
+#include <Reaktoro/Math/Matrix.hpp>
+#include <Reaktoro/Math/SparseMatrix.hpp>
+
+// Eigen includes
+#include <Reaktoro/Math/Eigen/SparseLU>
+
+namespace Reaktoro {
+
+/// A class to represent a finite-volume mesh of polyhedral cells in 1D, 2D or 3D.
+/// The mesh is described by the volumes and centroids of its cells and by its faces.
+/// An interior face connects an *owner* cell to a *neighbour* cell, and its unit normal
+/// points from the owner to the neighbour. A boundary face belongs to a single cell, its
+/// unit normal points outwards, and it carries a tag identifying the boundary it lies on.
+class FiniteVolumeMesh
+{
+public:
+    /// Construct a default FiniteVolumeMesh instance with no cells.
+    FiniteVolumeMesh();
+
+    /// Construct a structured 2D mesh of `nx` by `ny` rectangular cells of unit thickness.
+    /// The boundary tags are 0, 1, 2, 3 for the boundaries at `x = 0`, `x = Lx`, `y = 0`, `y = Ly`.
+    /// @param nx The number of cells along the x-axis
+    /// @param ny The number of cells along the y-axis
+    /// @param Lx The length of the domain along the x-axis (in m)
+    /// @param Ly The length of the domain along the y-axis (in m)
+    FiniteVolumeMesh(Index nx, Index ny, double Lx, double Ly);
+
+    /// Construct a structured 3D mesh of `nx` by `ny` by `nz` hexahedral cells.
+    /// The boundary tags are 0, 1, 2, 3, 4, 5 for the boundaries at
+    /// `x = 0`, `x = Lx`, `y = 0`, `y = Ly`, `z = 0`, `z = Lz`.
+    /// The index of the cell `(i, j, k)` is `i + nx*(j + ny*k)`.
+    /// @param nx The number of cells along the x-axis
+    /// @param ny The number of cells along the y-axis
+    /// @param nz The number of cells along the z-axis
+    /// @param Lx The length of the domain along the x-axis (in m)
+    /// @param Ly The length of the domain along the y-axis (in m)
+    /// @param Lz The length of the domain along the z-axis (in m)
+    FiniteVolumeMesh(Index nx, Index ny, Index nz, double Lx, double Ly, double Lz);
+
+    /// Set the cells of a general polyhedral mesh, removing all existing faces.
+    /// @param volumes The volumes of the cells (in m3)
+    /// @param centroids The centroids of the cells as rows of a matrix with three columns (in m)
+    auto setCells(VectorConstRef volumes, MatrixConstRef centroids) -> void;
+
+    /// Add an interior face between two cells.
+    /// @param owner The index of the owner cell
+    /// @param neighbour The index of the neighbour cell
+    /// @param area The area of the face (in m2)
+    /// @param normal The unit normal of the face pointing from the owner to the neighbour cell
+    auto addFace(Index owner, Index neighbour, double area, VectorConstRef normal) -> void;
+
+    /// Add a boundary face to a cell.
+    /// @param cell The index of the cell
+    /// @param area The area of the face (in m2)
+    /// @param normal The outward unit normal of the face
+    /// @param distance The distance between the cell centroid and the face (in m)
+    /// @param tag The tag of the boundary containing the face
+    auto addBoundaryFace(Index cell, double area, VectorConstRef normal, double distance, Index tag = 0) -> void;
+
+    /// Return the number of cells in the mesh.
+    auto numCells() const -> Index { return m_volumes.size(); }
+
+    /// Return the number of interior faces in the mesh.
+    auto numFaces() const -> Index { return m_owners.size(); }
+
+    /// Return the number of boundary faces in the mesh.
+    auto numBoundaryFaces() const -> Index { return m_boundary_cells.size(); }
+
+    /// Return the volumes of the cells (in m3).
+    auto volumes() const -> VectorConstRef { return m_volumes; }
+
+    /// Return the centroids of the cells as rows of a matrix (in m).
+    auto centroids() const -> MatrixConstRef { return m_centroids; }
+
+    /// Return the owner cells of the interior faces.
+    auto owners() const -> const Indices& { return m_owners; }
+
+    /// Return the neighbour cells of the interior faces.
+    auto neighbours() const -> const Indices& { return m_neighbours; }
+
+    /// Return the areas of the interior faces (in m2).
+    auto faceAreas() const -> VectorConstRef { return m_face_areas; }
+
+    /// Return the unit normals of the interior faces as rows of a matrix.
+    auto faceNormals() const -> MatrixConstRef { return m_face_normals; }
+
+    /// Return the distances between the centroids of the owner and neighbour cells of the interior faces (in m).
+    auto faceDistances() const -> VectorConstRef { return m_face_distances; }
+
+    /// Return the cells of the boundary faces.
+    auto boundaryCells() const -> const Indices& { return m_boundary_cells; }
+
+    /// Return the areas of the boundary faces (in m2).
+    auto boundaryAreas() const -> VectorConstRef { return m_boundary_areas; }
+
+    /// Return the outward unit normals of the boundary faces as rows of a matrix.
+    auto boundaryNormals() const -> MatrixConstRef { return m_boundary_normals; }
+
+    /// Return the distances between the cell centroids and the boundary faces (in m).
+    auto boundaryDistances() const -> VectorConstRef { return m_boundary_distances; }
+
+    /// Return the tags of the boundary faces.
+    auto boundaryTags() const -> const Indices& { return m_boundary_tags; }
+
+private:
+    /// The volumes of the cells (in m3).
+    Vector m_volumes;
+
+    /// The centroids of the cells (in m).
+    Matrix m_centroids;
+
+    /// The owner cells of the interior faces.
+    Indices m_owners;
+
+    /// The neighbour cells of the interior faces.
+    Indices m_neighbours;
+
+    /// The areas of the interior faces (in m2).
+    Vector m_face_areas;
+
+    /// The unit normals of the interior faces.
+    Matrix m_face_normals;
+
+    /// The distances between the owner and neighbour centroids of the interior faces (in m).
+    Vector m_face_distances;
+
+    /// The cells of the boundary faces.
+    Indices m_boundary_cells;
+
+    /// The areas of the boundary faces (in m2).
+    Vector m_boundary_areas;
+
+    /// The outward unit normals of the boundary faces.
+    Matrix m_boundary_normals;
+
+    /// The distances between the cell centroids and the boundary faces (in m).
+    Vector m_boundary_distances;
+
+    /// The tags of the boundary faces.
+    Indices m_boundary_tags;
+};
+
+/// Use this class for solving transport problems on finite-volume meshes.
+/// The advection and diffusion terms are discretized implicitly in time, with
+/// upwind advective fluxes and two-point diffusive fluxes across the faces.
+/// The resulting sparse operator is assembled once in @ref initialize and its
+/// LU factorization is reused in every step, being recomputed only if the time
+/// step changes. Copies of a solver share the factorization. Several variables (e.g., the amounts of all elements) can be
+/// transported together, with their columns solved in parallel.
+/// On inflow boundary faces the variables are set to their boundary values,
+/// and boundary faces have no diffusive flux.
+class FiniteVolumeTransportSolver
+{
+public:
+    /// Construct a default FiniteVolumeTransportSolver instance.
+    FiniteVolumeTransportSolver();
+
+    /// Set the mesh for the numerical solution of the transport problem.
+    auto setMesh(const FiniteVolumeMesh& mesh) -> void;
+
+    /// Set a uniform velocity for the transport problem.
+    /// @param velocity The velocity vector with three components (in m/s)
+    auto setVelocity(VectorConstRef velocity) -> void;
+
+    /// Set the volumetric flow rates across the faces of the mesh.
+    /// This is the entry point for coupling velocity fields computed by flow simulators.
+    /// @param fluxes The flow rates across the interior faces, positive from owner to neighbour (in m3/s)
+    /// @param boundary_fluxes The flow rates across the boundary faces, positive outwards (in m3/s)
+    auto setFluxes(VectorConstRef fluxes, VectorConstRef boundary_fluxes) -> void;
+
+    /// Set the diffusion coefficient for the transport problem.
+    /// @param val The diffusion coefficient (in m^2/s)
+    auto setDiffusionCoeff(double val) -> void { diffusion = val; }
+
+    /// Set the value of the variable on the inflow boundary faces.
+    auto setBoundaryValue(double val) -> void { ubc = val; }
+
+    /// Set the time step for the numerical solution of the transport problem (in s).
+    auto setTimeStep(double val) -> void { dt = val; }
+
+    /// Set the number of threads used in the assembly and solution steps (zero for all available).
+    auto setNumThreads(unsigned val) -> void { num_threads = val; }
+
+    /// Return the mesh.
+    auto mesh() const -> const FiniteVolumeMesh& { return mesh_; }
+
+    /// Return the largest Courant number `max(outflow*dt/volume)` among the cells for the current time step.
+    auto courant() const -> double;
+
+    /// Initialize the transport solver before method @ref step is executed.
+    auto initialize() -> void;
+
+    /// Step the transport solver.
+    /// @param[in,out] u The solution vector
+    /// @param q The source rates vector
+    auto step(VectorRef u, VectorConstRef q) -> void;
+
+    /// Step the transport solver.
+    /// @param[in,out] u The solution vector
+    auto step(VectorRef u) -> void;
+
+    /// Step the transport solver for several variables at once.
+    /// @param[in,out] U The solution matrix with one column per variable
+    /// @param ubc The values of the variables on the inflow boundary faces
+    auto step(MatrixRef U, VectorConstRef ubc) -> void;
+
+private:
+    /// Compute the LU factorization of the operator for the current time step.
+    auto factorize() -> void;
+
+    /// The mesh describing the discretization of the domain.
+    FiniteVolumeMesh mesh_;
+
+    /// The time step used to solve the transport problem (in s).
+    double dt = 0.0;
+
+    /// The time step used in the current LU factorization (in s).
+    double dt_factorized = 0.0;
+
+    /// The diffusion coefficient in the transport problem (in m^2/s).
+    double diffusion = 0.0;
+
+    /// The value of the variable on the inflow boundary faces.
+    double ubc = 0.0;
+
+    /// The number of threads used in the assembly and solution steps.
+    unsigned num_threads = 0;
+
+    /// The volumetric flow rates across the interior faces (in m3/s).
+    Vector fluxes;
+
+    /// The volumetric flow rates across the boundary faces (in m3/s).
+    Vector boundary_fluxes;
+
+    /// The uniform velocity used to compute the fluxes if these were not given (in m/s).
+    Vector velocity;
+
+    /// The operator of the advective and diffusive fluxes, without the accumulation term.
+    SparseMatrix K;
+
+    /// The operator of the discretized transport equation.
+    SparseMatrix M;
+
+    /// The LU factorization of the operator of the discretized transport equation.
+    /// It is never modified after computed, so that copies of this solver can share it.
+    std::shared_ptr<const Eigen::SparseLU<SparseMatrix>> lu;
+
+    /// The inflow rates of the cells from the boundary, multiplying the boundary values (in m3/s).
+    Vector inflow;
+};
+
+} // namespace Reaktoro
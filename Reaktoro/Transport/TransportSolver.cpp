@@ -18,10 +18,16 @@
 #include "TransportSolver.hpp"
 
 // C++ includes
+#include <cmath>
+#include <fstream>
 #include <iomanip>
+#include <limits>
 
 // Reaktoro includes
+#include <Reaktoro/Common/BinaryUtils.hpp>
 #include <Reaktoro/Common/Exception.hpp>
+#include <Reaktoro/Common/MemoryMappedFile.hpp>
+#include <Reaktoro/Common/Profiling.hpp>
 #include <Reaktoro/Equilibrium/EquilibriumResult.hpp>
 
 namespace Reaktoro {
@@ -37,21 +43,86 @@ auto row(TridiagonalMatrixType&& mat, Index index) -> ReturnType
         data.segment(length - 4, 2) : data.segment(3 * index, 3);
 }
 
+/// The identifier written at the beginning of the chemical field section of checkpoint files
+const std::string chemical_field_magic = "REAKTORO-CHEMICAL-FIELD";
+
+/// The identifier written at the beginning of reactive transport checkpoint files
+const std::string reactive_transport_magic = "REAKTORO-REACTIVE-TRANSPORT";
+
+/// The version of the binary format of checkpoint files
+const std::uint32_t checkpoint_version = 1;
+
+/// The size of the buffer used to stream checkpoint files to disk (in bytes)
+const std::size_t checkpoint_buffer_size = 1 << 22;
+
 } // namespace internal
 
 ChemicalField::ChemicalField(Index size, const ChemicalSystem& system)
 : m_size(size),
   m_system(system),
-  m_states(size, ChemicalState(system)),
   m_properties(size, ChemicalProperties(system))
-{}
+{
+    initializeStates(ChemicalState(system));
+}
 
 ChemicalField::ChemicalField(Index size, const ChemicalState& state)
 : m_size(size),
   m_system(state.system()),
-  m_states(size, state),
   m_properties(size, state.properties())
-{}
+{
+    initializeStates(state);
+}
+
+ChemicalField::ChemicalField(const ChemicalField& other)
+: m_size(other.m_size),
+  m_temperatures(other.m_temperatures),
+  m_pressures(other.m_pressures),
+  m_species_amounts(other.m_species_amounts),
+  m_element_dual_potentials(other.m_element_dual_potentials),
+  m_species_dual_potentials(other.m_species_dual_potentials),
+  m_system(other.m_system),
+  m_properties(other.m_properties)
+{
+    initializeViews();
+}
+
+auto ChemicalField::operator=(ChemicalField other) -> ChemicalField&
+{
+    // Swapping the arrays exchanges their memory buffers, so the views remain valid
+    std::swap(m_size, other.m_size);
+    m_temperatures.swap(other.m_temperatures);
+    m_pressures.swap(other.m_pressures);
+    m_species_amounts.swap(other.m_species_amounts);
+    m_element_dual_potentials.swap(other.m_element_dual_potentials);
+    m_species_dual_potentials.swap(other.m_species_dual_potentials);
+    std::swap(m_system, other.m_system);
+    std::swap(m_states, other.m_states);
+    std::swap(m_properties, other.m_properties);
+    return *this;
+}
+
+auto ChemicalField::initializeStates(const ChemicalState& state) -> void
+{
+    m_temperatures.setConstant(m_size, state.temperature());
+    m_pressures.setConstant(m_size, state.pressure());
+    m_species_amounts = state.speciesAmounts().replicate(1, m_size);
+    m_element_dual_potentials = state.elementDualPotentials().replicate(1, m_size);
+    m_species_dual_potentials = state.speciesDualPotentials().replicate(1, m_size);
+    initializeViews();
+}
+
+auto ChemicalField::initializeViews() -> void
+{
+    m_states.clear();
+    m_states.reserve(m_size);
+    for(Index i = 0; i < m_size; ++i)
+        m_states.emplace_back(m_system,
+            m_temperatures.data() + i,
+            m_pressures.data() + i,
+            m_species_amounts.col(i).data(),
+            m_element_dual_potentials.col(i).data(),
+            m_species_dual_potentials.col(i).data());
+}
 
 auto ChemicalField::set(const ChemicalState& state) -> void
 {
@@ -61,25 +132,19 @@ auto ChemicalField::set(const ChemicalState& state) -> void
 
 auto ChemicalField::temperature(VectorRef values) -> void
 {
-    const Index len = size();
-    for(Index i = 0; i < len; ++i)
-        values[i] = m_states[i].temperature();
+    values = m_temperatures;
 }
 
 auto ChemicalField::pressure(VectorRef values) -> void
 {
-    const Index len = size();
-    for(Index i = 0; i < len; ++i)
-        values[i] = m_states[i].pressure();
+    values = m_pressures;
 }
 
 auto ChemicalField::elementAmounts(VectorRef values) -> void
 {
-    const Index len = size();
     const Index num_elements = m_system.numElements();
-    Index offset = 0;
-    for(Index i = 0; i < len; ++i, offset += num_elements)
-        values.segment(offset, num_elements) = m_states[i].elementAmounts();
+    MatrixMap b(values.data(), num_elements, size());
+    b.noalias() = m_system.formulaMatrixSparse() * m_species_amounts;
 }
 
 auto ChemicalField::output(std::string filename, StringList quantities) -> void
@@ -91,6 +156,106 @@ auto ChemicalField::output(std::string filename, StringList quantities) -> void
 
 }
 
+auto ChemicalField::evaluate(ChemicalQuantityPlan& plan, MatrixRef values) const -> void
+{
+    Assert(values.rows() == static_cast<long>(plan.size()) && values.cols() == static_cast<long>(m_size),
+        "Cannot evaluate the chemical quantities in the field.",
+        "The matrix of values must have one row per quantity and one column per state in the field.");
+
+    for(Index i = 0; i < m_size; ++i)
+        plan.evaluate(m_states[i], i, values.col(i));
+}
+
+auto ChemicalField::save(std::ostream& out) const -> void
+{
+    writeBinary(out, internal::chemical_field_magic);
+    writeBinary(out, internal::checkpoint_version);
+    writeBinary(out, fingerprint(m_system));
+    writeBinary(out, static_cast<std::uint64_t>(m_size));
+    writeBinary(out, m_temperatures);
+    writeBinary(out, m_pressures);
+    writeBinary(out, m_species_amounts);
+    writeBinary(out, m_element_dual_potentials);
+    writeBinary(out, m_species_dual_potentials);
+}
+
+auto ChemicalField::load(std::istream& in) -> void
+{
+    std::string magic;
+    std::uint32_t version = 0;
+    std::uint64_t hash = 0;
+    std::uint64_t size = 0;
+
+    readBinary(in, magic);
+
+    Assert(in.good() && magic == internal::chemical_field_magic,
+        "Could not load the chemical field.", "The data is not a chemical field checkpoint.");
+
+    readBinary(in, version);
+
+    Assert(version == internal::checkpoint_version, "Could not load the chemical field.",
+        "The data has format version " << version << ", but version " << internal::checkpoint_version << " was expected.");
+
+    readBinary(in, hash);
+
+    Assert(hash == fingerprint(m_system), "Could not load the chemical field.",
+        "The data was created for a different chemical system.");
+
+    readBinary(in, size);
+
+    Vector T, P;
+    Matrix n, y, z;
+
+    readBinary(in, T);
+    readBinary(in, P);
+    readBinary(in, n);
+    readBinary(in, y);
+    readBinary(in, z);
+
+    const Index num_species = m_system.numSpecies();
+    const Index num_elements = m_system.numElements();
+
+    Assert(in.good() &&
+        Index(T.rows()) == size && Index(P.rows()) == size &&
+        Index(n.rows()) == num_species && Index(n.cols()) == size &&
+        Index(y.rows()) == num_elements && Index(y.cols()) == size &&
+        Index(z.rows()) == num_species && Index(z.cols()) == size,
+        "Could not load the chemical field.", "The data is truncated or corrupted.");
+
+    m_size = size;
+    m_temperatures.swap(T);
+    m_pressures.swap(P);
+    m_species_amounts.swap(n);
+    m_element_dual_potentials.swap(y);
+    m_species_dual_potentials.swap(z);
+    m_properties.resize(m_size, ChemicalProperties(m_system));
+    initializeViews();
+}
+
+auto ChemicalField::save(std::string filename) const -> void
+{
+    std::vector<char> buffer(internal::checkpoint_buffer_size);
+    std::ofstream out;
+    out.rdbuf()->pubsetbuf(buffer.data(), buffer.size());
+    out.open(filename, std::ios::out | std::ios::binary | std::ios::trunc);
+
+    Assert(out.is_open(), "Could not save the chemical field to file `" << filename << "`.",
+        "The file could not be opened for writing.");
+
+    save(out);
+    out.flush();
+
+    Assert(out.good(), "Could not save the chemical field to file `" << filename << "`.",
+        "An error occurred while writing to the file.");
+}
+
+auto ChemicalField::load(std::string filename) -> void
+{
+    MemoryMappedFile file(filename);
+    MemoryInputStream in(file);
+    load(in);
+}
+
 auto TridiagonalMatrix::resize(Index size) -> void
 {
     m_size = size;
@@ -159,6 +324,50 @@ auto TridiagonalMatrix::solve(VectorRef x) const -> void
     solve(x, x);
 }
 
+auto TridiagonalMatrix::solveMultiple(MatrixRowMajorRef X) const -> void
+{
+    const Index n = size();
+    const Index m = X.cols();
+
+    auto curr = row(1).data(); // iterator to current row
+
+    //-------------------------------------------------------------------------
+    // Perform the forward solve with the L factor of the LU factorization
+    //-------------------------------------------------------------------------
+    for(Index i = 1; i < n; ++i, curr += 3)
+    {
+        const double a = curr[0]; // `a` value on the current row
+
+        const double* xprev = X.row(i - 1).data();
+        double* xi = X.row(i).data();
+        for(Index j = 0; j < m; ++j)
+            xi[j] -= a * xprev[j];
+    }
+
+    curr -= 3; // step back so that curr points to the last row
+    const double bn = curr[1]; // `b` value on the last row
+    curr -= 3; // step back so that curr points to the second to last row
+
+    //-------------------------------------------------------------------------
+    // Perform the backward solve with the U factor of the LU factorization
+    //-------------------------------------------------------------------------
+    double* xlast = X.row(n - 1).data();
+    for(Index j = 0; j < m; ++j)
+        xlast[j] /= bn;
+
+    for(Index i = 2; i <= n; ++i, curr -= 3)
+    {
+        const Index k = n - i; // the index of the current row
+        const double b = curr[1]; // `b` value on the current row
+        const double c = curr[2]; // `c` value on the current row
+
+        const double* xnext = X.row(k + 1).data();
+        double* xk = X.row(k).data();
+        for(Index j = 0; j < m; ++j)
+            xk[j] = (xk[j] - c * xnext[j])/b;
+    }
+}
+
 TridiagonalMatrix::operator Matrix() const
 {
     const Index n = size();
@@ -272,10 +481,14 @@ auto TransportSolver::initialize() -> void
 
     // Factorize A into LU factors for future uses in method step
     A.factorize();
+
+    dt_initialized = dt;
 }
 
 auto TransportSolver::step(VectorRef u, VectorConstRef q) -> void
 {
+    ProfilerScope("TransportSolver::step");
+
     // TODO: Implement Kurganov-Tadmor method as detailed in their 2000 paper (not as in Wikipedia)
     const auto dx = mesh_.dx();
     const auto num_cells = mesh_.numCells();
@@ -283,6 +496,10 @@ auto TransportSolver::step(VectorRef u, VectorConstRef q) -> void
     const auto icell0 = 0;
     const auto icelln = num_cells - 1;
 
+    // Assemble the coefficient matrix again if the time step has changed
+    if(dt != dt_initialized)
+        initialize();
+
     u0 = u;
 
     phi[0] = 2.0; //  this is very important to ensure correct flux limiting behavior for boundary cell.
@@ -327,6 +544,63 @@ auto TransportSolver::step(VectorRef u) -> void
     step(u, zeros(u.size()));
 }
 
+auto TransportSolver::stepMultiple(MatrixRowMajorRef U, VectorConstRef ubc) -> void
+{
+    ProfilerScope("TransportSolver::stepMultiple");
+
+    const auto dx = mesh_.dx();
+    const auto num_cells = mesh_.numCells();
+    const auto num_vars = U.cols();
+    const auto alpha = velocity*dt/dx;
+    const auto icell0 = 0;
+    const auto icelln = num_cells - 1;
+
+    Assert(ubc.rows() == num_vars,
+        "Could not step the transport solver.",
+        "The number of boundary values does not match the number of variables.");
+
+    // Assemble the coefficient matrix again if the time step has changed
+    if(dt != dt_initialized)
+        initialize();
+
+    U0 = U;
+
+    phiW.setConstant(num_vars, 2.0); // the limiter of the boundary cell (see the single variable step method)
+    phiP.resize(num_vars);
+
+    // Calculate the flux limiters and the advection contributions of the interior cells in a single pass
+    for(Index icell = 1; icell < icelln; ++icell)
+    {
+        const double* uW = U0.row(icell - 1).data();
+        const double* uP = U0.row(icell).data();
+        const double* uE = U0.row(icell + 1).data();
+        double* pW = phiW.data();
+        double* pP = phiP.data();
+        double* u = U.row(icell).data();
+
+        for(Index j = 0; j < num_vars; ++j)
+        {
+            // Calculate the variation index `r = (uP - uW)/(uE - uP)` and the superbee limiter
+            const double r = (uP[j] - uW[j])/(uE[j] - uP[j]);
+            pP[j] = std::max(0.0, std::max(std::min(2 * r, 1.0), std::min(r, 2.0)));
+
+            const double aux = 1.0 + 0.5 * (pP[j] - pW[j]);
+            u[j] += aux*alpha * (uW[j] - uP[j]);
+        }
+
+        phiW.swap(phiP);
+    }
+
+    // Handle the left boundary cell
+    const double aux = 1 + 0.5 * 2.0;
+    U.row(icell0) += aux * alpha * (tr(ubc) - U0.row(icell0));
+
+    // Handle the right boundary cell
+    U.row(icelln) += alpha * (U0.row(icelln - 1) - U0.row(icelln));
+
+    A.solveMultiple(U);
+}
+
 ReactiveTransportSolver::ReactiveTransportSolver(const ChemicalSystem& system)
 : system_(system), equilibriumsolver(system)
 {
@@ -336,6 +610,13 @@ ReactiveTransportSolver::ReactiveTransportSolver(const ChemicalSystem& system)
 auto ReactiveTransportSolver::setMesh(const Mesh& mesh) -> void
 {
     transportsolver.setMesh(mesh);
+    finite_volume = false;
+}
+
+auto ReactiveTransportSolver::setMesh(const FiniteVolumeMesh& mesh) -> void
+{
+    fvtransportsolver.setMesh(mesh);
+    finite_volume = true;
 }
 
 auto ReactiveTransportSolver::setVelocity(double val) -> void
@@ -343,9 +624,25 @@ auto ReactiveTransportSolver::setVelocity(double val) -> void
     transportsolver.setVelocity(val);
 }
 
+auto ReactiveTransportSolver::setVelocity(VectorConstRef velocity) -> void
+{
+    fvtransportsolver.setVelocity(velocity);
+}
+
+auto ReactiveTransportSolver::setFluxes(VectorConstRef fluxes, VectorConstRef boundary_fluxes) -> void
+{
+    fvtransportsolver.setFluxes(fluxes, boundary_fluxes);
+}
+
 auto ReactiveTransportSolver::setDiffusionCoeff(double val) -> void
 {
     transportsolver.setDiffusionCoeff(val);
+    fvtransportsolver.setDiffusionCoeff(val);
+}
+
+auto ReactiveTransportSolver::setNumThreads(unsigned val) -> void
+{
+    fvtransportsolver.setNumThreads(val);
 }
 
 auto ReactiveTransportSolver::setBoundaryState(const ChemicalState& state) -> void
@@ -355,7 +652,18 @@ auto ReactiveTransportSolver::setBoundaryState(const ChemicalState& state) -> vo
 
 auto ReactiveTransportSolver::setTimeStep(double val) -> void
 {
+    dt = val;
     transportsolver.setTimeStep(val);
+    fvtransportsolver.setTimeStep(val);
+}
+
+auto ReactiveTransportSolver::setOptions(const ReactiveTransportOptions& options) -> void
+{
+    Assert(!options.adaptive_time_step || options.min_time_step > 0.0,
+        "Could not set the options of the reactive transport solver.",
+        "The minimum time step must be positive when the time step is adapted, "
+        "otherwise it decays towards zero while a reaction front moves through the cells.");
+    this->options = options;
 }
 
 auto ReactiveTransportSolver::output() -> ChemicalOutput
@@ -364,39 +672,101 @@ auto ReactiveTransportSolver::output() -> ChemicalOutput
     return outputs.back();
 }
 
+auto ReactiveTransportSolver::numCells() const -> Index
+{
+    return finite_volume ? fvtransportsolver.mesh().numCells() : transportsolver.mesh().numCells();
+}
+
 auto ReactiveTransportSolver::initialize(const ChemicalField& field) -> void
 {
-    const Mesh& mesh = transportsolver.mesh();
     const Index num_elements = system_.numElements();
-    const Index num_cells = mesh.numCells();
+    const Index num_cells = numCells();
 
     bf.resize(num_cells, num_elements);
     bs.resize(num_cells, num_elements);
     b.resize(num_cells, num_elements);
 
-    transportsolver.initialize();
+    // Initialize the formula matrices whose columns are non-zero only for fluid or solid species
+    const Matrix A = system_.formulaMatrix();
+    Matrix Afluid = zeros(num_elements, A.cols());
+    Matrix Asolid = zeros(num_elements, A.cols());
+    for(Index i : system_.indicesFluidSpecies())
+        Afluid.col(i) = A.col(i);
+    for(Index i : system_.indicesSolidSpecies())
+        Asolid.col(i) = A.col(i);
+    Af = sparse(Afluid);
+    As = sparse(Asolid);
+
+    // Initialize the conditions of the last equilibrium calculations so that no cell is skipped in the first step
+    const double nan = std::numeric_limits<double>::quiet_NaN();
+    b0.setConstant(num_cells, num_elements, nan);
+    T0.setConstant(num_cells, nan);
+    P0.setConstant(num_cells, nan);
+    n0.resize(system_.numSpecies(), num_cells);
+    sensitivities.clear();
+
+    if(finite_volume)
+        fvtransportsolver.initialize();
+    else
+        transportsolver.initialize();
 }
 
-auto ReactiveTransportSolver::step(ChemicalField& field) -> void
+auto ReactiveTransportSolver::quiescent(Index icell, double T, double P) const -> bool
 {
-    const auto& mesh = transportsolver.mesh();
-    const auto& num_elements = system_.numElements();
-    const auto& num_cells = mesh.numCells();
-    const auto& ifs = system_.indicesFluidSpecies();
-    const auto& iss = system_.indicesSolidSpecies();
+    if(options.skip_sensitivity_update && sensitivities[icell].dndb.size() == 0)
+        return false;
+    if(!(std::abs(T - T0[icell]) <= options.skip_temperature_tolerance))
+        return false;
+    if(!(std::abs(P - P0[icell]) <= options.skip_pressure_tolerance))
+        return false;
+    const auto bnew = b.row(icell);
+    const auto bold = b0.row(icell);
+    const auto tol = options.skip_relative_tolerance * bold.cwiseAbs().array() + options.skip_absolute_tolerance;
+    return ((bnew - bold).cwiseAbs().array() <= tol).all();
+}
 
-    // Collect the amounts of elements in the solid and fluid species
-    for(Index icell = 0; icell < num_cells; ++icell)
+auto ReactiveTransportSolver::step(ChemicalField& field) -> ReactiveTransportResult
+{
+    ProfilerScope("ReactiveTransportSolver::step");
+
+    ReactiveTransportResult result;
+
+    const auto num_cells = numCells();
+
+    const auto num_phases = system_.numPhases();
+
+    if(options.skip_sensitivity_update)
+        sensitivities.resize(num_cells);
+
+    // The flags that indicate which phases are present in a cell before its equilibrium calculation
+    std::vector<bool> present(num_phases);
+
+    // Collect the amounts of elements in the solid and fluid species of all cells
+    bf.noalias() = tr(Af * field.speciesAmounts());
+    bs.noalias() = tr(As * field.speciesAmounts());
+
+    result.time_step = dt;
+
+    // Transport the elements in the fluid species, with the explicit advection of the 1D solver sub-cycled to respect the maximum Courant number
+    if(finite_volume)
     {
-        bf.row(icell) = field[icell].elementAmountsInSpecies(ifs);
-        bs.row(icell) = field[icell].elementAmountsInSpecies(iss);
+        fvtransportsolver.setTimeStep(dt);
+        bfcols = bf;
+        fvtransportsolver.step(bfcols, bbc);
+        bf = bfcols;
     }
-
-    // Transport the elements in the fluid species
-    for(Index ielement = 0; ielement < num_elements; ++ielement)
+    else
     {
-        transportsolver.setBoundaryValue(bbc[ielement]);
-        transportsolver.step(bf.col(ielement));
+        transportsolver.setTimeStep(dt);
+        const double courant = transportsolver.courant();
+        Assert(options.max_courant > 0.0 && std::isfinite(courant/options.max_courant),
+            "Cannot transport the elements in the time step.",
+            "The maximum Courant number must be positive and the Courant number " << courant << " must be finite.");
+        const Index substeps = courant > options.max_courant ? std::ceil(courant/options.max_courant) : 1;
+        transportsolver.setTimeStep(dt/substeps);
+        for(Index k = 0; k < substeps; ++k)
+            transportsolver.stepMultiple(bf, bbc);
+        result.num_transport_substeps = substeps;
     }
 
     // Sum the amounts of elements distributed among fluid and solid species
@@ -410,18 +780,259 @@ auto ReactiveTransportSolver::step(ChemicalField& field) -> void
 
     for(Index icell = 0; icell < num_cells; ++icell)
     {
-        const double T = field[icell].temperature();
-        const double P = field[icell].pressure();
-        equilibriumsolver.solve(field[icell], T, P, b.row(icell));
+        ChemicalState& state = field[icell];
+        const double T = state.temperature();
+        const double P = state.pressure();
+
+        if(options.skip_quiescent_cells && quiescent(icell, T, P))
+        {
+            // Correct the species amounts of the last calculation with its sensitivity or keep them unchanged
+            if(options.skip_sensitivity_update)
+            {
+                const auto& sensitivity = sensitivities[icell];
+                Vector n = n0.col(icell);
+                n += sensitivity.dndb * tr(b.row(icell) - b0.row(icell));
+                n += sensitivity.dndT * (T - T0[icell]);
+                n += sensitivity.dndP * (P - P0[icell]);
+                state.setSpeciesAmounts(n.cwiseMax(0.0));
+            }
+
+            ++result.num_cells_skipped;
+        }
+        else
+        {
+            // Record the phases present in the cell before the calculation to detect changes in its phase assemblage
+            if(options.adaptive_time_step)
+                for(Index iphase = 0; iphase < num_phases; ++iphase)
+                    present[iphase] = state.phaseAmount(iphase) > options.phase_amount_threshold;
+
+            const EquilibriumResult res = equilibriumsolver.solve(state, T, P, b.row(icell));
+
+            result.max_equilibrium_iterations = std::max(result.max_equilibrium_iterations, res.optimum.iterations);
+
+            if(options.adaptive_time_step)
+            {
+                for(Index iphase = 0; iphase < num_phases; ++iphase)
+                {
+                    if(present[iphase] != (state.phaseAmount(iphase) > options.phase_amount_threshold))
+                    {
+                        ++result.num_cells_assemblage_changed;
+                        break;
+                    }
+                }
+            }
+
+            // Store the conditions of this equilibrium calculation to detect changes in the next steps
+            if(options.skip_quiescent_cells)
+            {
+                b0.row(icell) = b.row(icell);
+                T0[icell] = T;
+                P0[icell] = P;
+                n0.col(icell) = state.speciesAmounts();
+                if(options.skip_sensitivity_update)
+                    sensitivities[icell] = equilibriumsolver.sensitivity();
+            }
+
+            ++result.num_cells_solved;
+        }
 
         for(auto output : outputs)
-            output.update(field[icell], icell);
+            output.update(state, icell);
     }
 
     for(auto output : outputs)
         output.close();
 
     ++steps;
+
+    if(options.adaptive_time_step)
+        adaptTimeStep(result);
+
+    return result;
+}
+
+auto ReactiveTransportSolver::save(std::string filename, const ChemicalField& field, bool caches) const -> void
+{
+    std::vector<char> buffer(internal::checkpoint_buffer_size);
+    std::ofstream out;
+    out.rdbuf()->pubsetbuf(buffer.data(), buffer.size());
+    out.open(filename, std::ios::out | std::ios::binary | std::ios::trunc);
+
+    Assert(out.is_open(), "Could not save the reactive transport checkpoint to file `" << filename << "`.",
+        "The file could not be opened for writing.");
+
+    writeBinary(out, internal::reactive_transport_magic);
+    writeBinary(out, internal::checkpoint_version);
+    writeBinary(out, fingerprint(system_));
+    writeBinary(out, static_cast<std::uint64_t>(numCells()));
+    writeBinary(out, static_cast<std::uint64_t>(steps));
+    writeBinary(out, dt);
+    writeBinary(out, bf);
+    writeBinary(out, bs);
+    writeBinary(out, b);
+    writeBinary(out, static_cast<std::uint8_t>(caches));
+
+    if(caches)
+    {
+        writeBinary(out, b0);
+        writeBinary(out, T0);
+        writeBinary(out, P0);
+        writeBinary(out, n0);
+        writeBinary(out, static_cast<std::uint64_t>(sensitivities.size()));
+        for(const auto& sensitivity : sensitivities)
+        {
+            writeBinary(out, sensitivity.dndT);
+            writeBinary(out, sensitivity.dndP);
+            writeBinary(out, sensitivity.dndb);
+        }
+    }
+
+    field.save(out);
+    out.flush();
+
+    Assert(out.good(), "Could not save the reactive transport checkpoint to file `" << filename << "`.",
+        "An error occurred while writing to the file.");
+}
+
+auto ReactiveTransportSolver::load(std::string filename, ChemicalField& field) -> void
+{
+    MemoryMappedFile file(filename);
+    MemoryInputStream in(file);
+
+    std::string magic;
+    std::uint32_t version = 0;
+    std::uint64_t hash = 0;
+    std::uint64_t num_cells = 0;
+    std::uint64_t num_steps = 0;
+    std::uint8_t caches = 0;
+
+    readBinary(in, magic);
+
+    Assert(in.good() && magic == internal::reactive_transport_magic,
+        "Could not load the reactive transport checkpoint from file `" << filename << "`.",
+        "The file is not a reactive transport checkpoint.");
+
+    readBinary(in, version);
+
+    Assert(version == internal::checkpoint_version,
+        "Could not load the reactive transport checkpoint from file `" << filename << "`.",
+        "The file has format version " << version << ", but version " << internal::checkpoint_version << " was expected.");
+
+    readBinary(in, hash);
+
+    Assert(hash == fingerprint(system_),
+        "Could not load the reactive transport checkpoint from file `" << filename << "`.",
+        "The file was created for a different chemical system.");
+
+    readBinary(in, num_cells);
+
+    Assert(num_cells == numCells(),
+        "Could not load the reactive transport checkpoint from file `" << filename << "`.",
+        "The file was created for a mesh with " << num_cells << " cells, but the current mesh has " << numCells() << " cells.");
+
+    const Index num_elements = system_.numElements();
+    const Index num_species = system_.numSpecies();
+
+    // Read the data into temporaries, so that this solver and the field are unchanged if the file is invalid
+    double dt_loaded = 0.0;
+    Matrix bf_loaded, bs_loaded, b_loaded;
+
+    readBinary(in, num_steps);
+    readBinary(in, dt_loaded);
+    readBinary(in, bf_loaded);
+    readBinary(in, bs_loaded);
+    readBinary(in, b_loaded);
+    readBinary(in, caches);
+
+    auto hasSize = [](const Matrix& mat, Index rows, Index cols)
+    {
+        return Index(mat.rows()) == rows && Index(mat.cols()) == cols;
+    };
+
+    Assert(in.good() && dt_loaded > 0.0 &&
+        hasSize(bf_loaded, num_cells, num_elements) &&
+        hasSize(bs_loaded, num_cells, num_elements) &&
+        hasSize(b_loaded, num_cells, num_elements),
+        "Could not load the reactive transport checkpoint from file `" << filename << "`.",
+        "The file is truncated or corrupted.");
+
+    // The conditions of the last equilibrium calculations, which are reset so that no cell is skipped if not in the file
+    const double nan = std::numeric_limits<double>::quiet_NaN();
+    Matrix b0_loaded = Matrix::Constant(num_cells, num_elements, nan);
+    Vector T0_loaded = Vector::Constant(num_cells, nan);
+    Vector P0_loaded = Vector::Constant(num_cells, nan);
+    Matrix n0_loaded = zeros(num_species, num_cells);
+    std::vector<EquilibriumSensitivity> sensitivities_loaded;
+
+    if(caches)
+    {
+        std::uint64_t num_sensitivities = 0;
+        readBinary(in, b0_loaded);
+        readBinary(in, T0_loaded);
+        readBinary(in, P0_loaded);
+        readBinary(in, n0_loaded);
+        readBinary(in, num_sensitivities);
+
+        Assert(in.good() &&
+            hasSize(b0_loaded, num_cells, num_elements) &&
+            Index(T0_loaded.rows()) == num_cells &&
+            Index(P0_loaded.rows()) == num_cells &&
+            hasSize(n0_loaded, num_species, num_cells) &&
+            (num_sensitivities == 0 || num_sensitivities == num_cells),
+            "Could not load the reactive transport checkpoint from file `" << filename << "`.",
+            "The file is truncated or corrupted.");
+
+        sensitivities_loaded.resize(num_sensitivities);
+        for(auto& sensitivity : sensitivities_loaded)
+        {
+            readBinary(in, sensitivity.dndT);
+            readBinary(in, sensitivity.dndP);
+            readBinary(in, sensitivity.dndb);
+
+            // The sensitivities of a cell not yet calculated are empty
+            const bool empty = sensitivity.dndT.size() == 0 && sensitivity.dndP.size() == 0 && sensitivity.dndb.size() == 0;
+
+            Assert(in.good() && (empty || (
+                Index(sensitivity.dndT.rows()) == num_species &&
+                Index(sensitivity.dndP.rows()) == num_species &&
+                hasSize(sensitivity.dndb, num_species, num_elements))),
+                "Could not load the reactive transport checkpoint from file `" << filename << "`.",
+                "The file is truncated or corrupted.");
+        }
+    }
+
+    ChemicalField field_loaded(0, system_);
+    field_loaded.load(in);
+
+    Assert(field_loaded.size() == num_cells,
+        "Could not load the reactive transport checkpoint from file `" << filename << "`.",
+        "The chemical field in the file has " << field_loaded.size() << " states, but the current mesh has " << num_cells << " cells.");
+
+    // Commit the loaded data only after all of it was read and validated
+    bf = bf_loaded;
+    bs.swap(bs_loaded);
+    b.swap(b_loaded);
+    b0.swap(b0_loaded);
+    T0.swap(T0_loaded);
+    P0.swap(P0_loaded);
+    n0.swap(n0_loaded);
+    sensitivities.swap(sensitivities_loaded);
+    steps = num_steps;
+    setTimeStep(dt_loaded);
+    field = std::move(field_loaded);
+}
+
+auto ReactiveTransportSolver::adaptTimeStep(const ReactiveTransportResult& result) -> void
+{
+    double val = dt;
+
+    // Decrease the time step at reaction fronts and increase it in quiet periods
+    if(result.num_cells_assemblage_changed > 0 || result.max_equilibrium_iterations > options.time_step_decrease_iterations)
+        val *= options.time_step_decrease_factor;
+    else if(result.max_equilibrium_iterations <= options.time_step_increase_iterations)
+        val *= options.time_step_increase_factor;
+
+    setTimeStep(std::min(std::max(val, options.min_time_step), options.max_time_step));
 }
 
 } // namespace Reaktoro
@@ -18,6 +18,9 @@
 #pragma once
 
 // C++ includes
+#include <cmath>
+#include <iostream>
+#include <limits>
 #include <memory>
 #include <vector>
 
@@ -26,10 +29,14 @@
 #include <Reaktoro/Common/StringList.hpp>
 #include <Reaktoro/Core/ChemicalOutput.hpp>
 #include <Reaktoro/Core/ChemicalProperties.hpp>
+#include <Reaktoro/Core/ChemicalQuantity.hpp>
 #include <Reaktoro/Core/ChemicalState.hpp>
 #include <Reaktoro/Core/ChemicalSystem.hpp>
+#include <Reaktoro/Equilibrium/EquilibriumSensitivity.hpp>
 #include <Reaktoro/Equilibrium/EquilibriumSolver.hpp>
 #include <Reaktoro/Math/Matrix.hpp>
+#include <Reaktoro/Math/SparseMatrix.hpp>
+#include <Reaktoro/Transport/FiniteVolumeTransportSolver.hpp>
 
 namespace Reaktoro {
 
@@ -55,6 +62,11 @@ namespace Reaktoro {
 //};
 
 
+/// A class to represent the chemical states on every degree of freedom of a field (e.g., the cells of a mesh).
+/// The temperatures, pressures, molar amounts and dual potentials of all states are stored in contiguous
+/// arrays, one column per degree of freedom, and each state in the field is a ChemicalState view of its
+/// column. This permits quantities such as the amounts of elements to be computed for the whole field
+/// with a single matrix product.
 class ChemicalField
 {
 public:
@@ -66,6 +78,12 @@ public:
 
     ChemicalField(Index size, const ChemicalState& state);
 
+    ChemicalField(const ChemicalField& other);
+
+    ChemicalField(ChemicalField&& other) = default;
+
+    auto operator=(ChemicalField other) -> ChemicalField&;
+
     auto size() const -> Index { return m_size; }
 
     auto begin() const -> ConstIterator { return m_states.cbegin(); }
@@ -88,23 +106,73 @@ public:
 
     auto elementAmounts(VectorRef values) -> void;
 
+    /// Return the temperatures of the states in the field (in units of K).
+    auto temperatures() const -> VectorConstRef { return m_temperatures; }
+
+    /// Return the pressures of the states in the field (in units of Pa).
+    auto pressures() const -> VectorConstRef { return m_pressures; }
+
+    /// Return the molar amounts of the species, one column per state in the field (in units of mol).
+    auto speciesAmounts() const -> MatrixConstRef { return m_species_amounts; }
+
+    /// Return the dual potentials of the elements, one column per state in the field (in units of J/mol).
+    auto elementDualPotentials() const -> MatrixConstRef { return m_element_dual_potentials; }
+
+    /// Return the dual potentials of the species, one column per state in the field (in units of J/mol).
+    auto speciesDualPotentials() const -> MatrixConstRef { return m_species_dual_potentials; }
+
     auto output(std::string filename, StringList quantities) -> void;
 
+    /// Evaluate chemical quantities at every state in the field.
+    /// The index of each state in the field is used as its tag variable.
+    /// @param plan The plan with the quantities to be evaluated
+    /// @param values The values of the quantities, one column per state in the field
+    auto evaluate(ChemicalQuantityPlan& plan, MatrixRef values) const -> void;
+
+    /// Write the temperatures, pressures, species amounts and dual potentials of the field to a binary stream.
+    auto save(std::ostream& out) const -> void;
+
+    /// Read the temperatures, pressures, species amounts and dual potentials of the field from a binary stream.
+    /// The size of the field changes to the number of states in the stream. An exception is thrown if the
+    /// stream was written for a different chemical system.
+    auto load(std::istream& in) -> void;
+
+    /// Save the states of the field to a binary checkpoint file.
+    auto save(std::string filename) const -> void;
+
+    /// Load the states of the field from a binary checkpoint file created with @ref save.
+    /// The file is mapped into memory, so that large fields are read without intermediate buffering.
+    auto load(std::string filename) -> void;
+
 private:
+    /// Fill the contiguous arrays with copies of a chemical state and create the views of their columns.
+    auto initializeStates(const ChemicalState& state) -> void;
+
+    /// Create the chemical states in the field as views of the columns of the contiguous arrays.
+    auto initializeViews() -> void;
+
     /// The number of degrees of freedom in the chemical field.
     Index m_size;
 
-//    Vector temperatures;
-//
-//    Vector pressures;
-//
-//    /// The matrix of amounts for every element (
-//    Matrix element_amounts;
+    /// The temperatures of the states in the field (in units of K).
+    Vector m_temperatures;
+
+    /// The pressures of the states in the field (in units of Pa).
+    Vector m_pressures;
+
+    /// The molar amounts of the species, one column per state in the field (in units of mol).
+    Matrix m_species_amounts;
+
+    /// The dual potentials of the elements, one column per state in the field (in units of J/mol).
+    Matrix m_element_dual_potentials;
+
+    /// The dual potentials of the species, one column per state in the field (in units of J/mol).
+    Matrix m_species_dual_potentials;
 
     /// The chemical system common to all degrees of freedom in the chemical field.
     ChemicalSystem m_system;
 
-    /// The chemical states in the chemical field
+    /// The chemical states in the chemical field as views of the contiguous arrays
     std::vector<ChemicalState> m_states;
 
     /// The chemical states in the chemical field
@@ -148,6 +216,12 @@ public:
 
     auto solve(VectorRef x) const -> void;
 
+    /// Solve the factorized tridiagonal system for several right-hand sides at once.
+    /// The right-hand sides are the columns of `X`, which is stored with one row per
+    /// unknown so that every step of the sweeps runs over contiguous memory.
+    /// @param[in,out] X The right-hand sides on input and the solutions on output
+    auto solveMultiple(MatrixRowMajorRef X) const -> void;
+
     operator Matrix() const;
 
 private:
@@ -222,7 +296,11 @@ public:
     /// Return the mesh.
     auto mesh() const -> const Mesh& { return mesh_; }
 
+    /// Return the Courant number `|velocity|*dt/dx` of the current time step.
+    auto courant() const -> double { return std::abs(velocity)*dt/mesh_.dx(); }
+
     /// Initialize the transport solver before method @ref step is executed.
+    /// This is done again automatically in method @ref step if the time step has changed.
     auto initialize() -> void;
 
     /// Step the transport solver.
@@ -234,6 +312,14 @@ public:
     /// @param[in,out] u The solution vector
     auto step(VectorRef u) -> void;
 
+    /// Step the transport solver for several variables at once.
+    /// The variables are stored with one row per cell, so that the flux limiters,
+    /// the advection update and the tridiagonal sweeps run over all variables of
+    /// a cell in contiguous memory in a single pass over the cells.
+    /// @param[in,out] U The solution matrix with one row per cell and one column per variable
+    /// @param ubc The values of the variables on the left boundary
+    auto stepMultiple(MatrixRowMajorRef U, VectorConstRef ubc) -> void;
+
 private:
     /// The mesh describing the discretization of the domain.
     Mesh mesh_;
@@ -241,6 +327,9 @@ private:
     /// The time step used to solve the transport problem (in s).
     double dt = 0.0;
 
+    /// The time step used in the last initialization of the coefficient matrix (in s).
+    double dt_initialized = 0.0;
+
     /// The velocity in the transport problem (in m/s).
     double velocity = 0.0;
 
@@ -258,6 +347,95 @@ private:
 
     /// The previous state of the variables.
     Vector u0;
+
+    /// The previous state of the variables when several are transported at once.
+    MatrixRowMajor U0;
+
+    /// The flux limiters of the previous and current cells when several variables are transported at once.
+    RowVector phiW, phiP;
+};
+
+/// The options for the solution of reactive transport problems.
+struct ReactiveTransportOptions
+{
+    /// The flag that indicates if the equilibrium calculation of a cell is skipped when its amounts of
+    /// elements, temperature and pressure have not changed significantly since its last calculation.
+    bool skip_quiescent_cells = false;
+
+    /// The relative tolerance for the change in the amounts of elements of a cell.
+    /// A cell is quiescent if `|b - b0| <= skip_relative_tolerance * |b0| + skip_absolute_tolerance`
+    /// for every element, where `b0` are the amounts of elements in its last equilibrium calculation.
+    double skip_relative_tolerance = 1.0e-10;
+
+    /// The absolute tolerance for the change in the amounts of elements of a cell (in units of mol).
+    double skip_absolute_tolerance = 1.0e-16;
+
+    /// The tolerance for the change in the temperature of a cell (in units of K).
+    double skip_temperature_tolerance = 1.0e-8;
+
+    /// The tolerance for the change in the pressure of a cell (in units of Pa).
+    double skip_pressure_tolerance = 1.0e-3;
+
+    /// The flag that indicates if the species amounts of a skipped cell are corrected with the
+    /// sensitivity of its last equilibrium calculation instead of being kept unchanged.
+    bool skip_sensitivity_update = false;
+
+    /// The maximum Courant number of the explicit advection in the 1D transport solver.
+    /// The transport in a time step is divided into as many equal sub-steps as needed to respect it.
+    /// The flux-limited advection scheme of the 1D transport solver is stable for Courant numbers up to 0.5.
+    /// The default is infinity, so that the transport is done in a single step of the given time step.
+    double max_courant = std::numeric_limits<double>::infinity();
+
+    /// The flag that indicates if the time step is adapted after every step from the convergence of the chemical calculations.
+    /// The time step is decreased if the phase assemblage changed in any cell or if the equilibrium calculations
+    /// needed many iterations, and it is increased if all of them needed few iterations.
+    /// Only the time step of the next step is changed, since a completed step is never rejected or retried.
+    bool adaptive_time_step = false;
+
+    /// The minimum time step when the time step is adapted (in s).
+    /// It must be positive when the time step is adapted, since the time step is decreased at every
+    /// step in which a reaction front changes the phase assemblage of a cell.
+    double min_time_step = 0.0;
+
+    /// The maximum time step when the time step is adapted (in s).
+    double max_time_step = std::numeric_limits<double>::infinity();
+
+    /// The factor that multiplies the time step when it is increased.
+    double time_step_increase_factor = 1.2;
+
+    /// The factor that multiplies the time step when it is decreased.
+    double time_step_decrease_factor = 0.5;
+
+    /// The number of equilibrium iterations in a cell at or below which the time step can be increased.
+    unsigned time_step_increase_iterations = 10;
+
+    /// The number of equilibrium iterations in a cell above which the time step is decreased.
+    unsigned time_step_decrease_iterations = 30;
+
+    /// The amount of a phase above which it is considered present in the phase assemblage of a cell (in units of mol).
+    double phase_amount_threshold = 1.0e-10;
+};
+
+/// The result of a time step of a reactive transport calculation.
+struct ReactiveTransportResult
+{
+    /// The number of cells whose equilibrium state was calculated in the time step.
+    Index num_cells_solved = 0;
+
+    /// The number of cells whose equilibrium calculation was skipped in the time step.
+    Index num_cells_skipped = 0;
+
+    /// The length of the time step (in s).
+    double time_step = 0.0;
+
+    /// The number of transport sub-steps used in the time step.
+    Index num_transport_substeps = 1;
+
+    /// The largest number of equilibrium iterations among the cells in the time step.
+    unsigned max_equilibrium_iterations = 0;
+
+    /// The number of cells whose phase assemblage changed in the time step (computed only if the time step is adaptive).
+    Index num_cells_assemblage_changed = 0;
 };
 
 /// Use this class for solving reactive transport problems.
@@ -269,29 +447,85 @@ public:
 
     auto setMesh(const Mesh& mesh) -> void;
 
+    /// Set a finite-volume mesh, so that the finite-volume transport solver is used instead of the 1D one.
+    auto setMesh(const FiniteVolumeMesh& mesh) -> void;
+
     auto setVelocity(double val) -> void;
 
+    /// Set a uniform velocity vector for the finite-volume transport solver (in m/s).
+    auto setVelocity(VectorConstRef velocity) -> void;
+
+    /// Set the volumetric flow rates across the faces of the finite-volume mesh (in m3/s).
+    /// @see FiniteVolumeTransportSolver::setFluxes
+    auto setFluxes(VectorConstRef fluxes, VectorConstRef boundary_fluxes) -> void;
+
     auto setDiffusionCoeff(double val) -> void;
 
+    /// Set the number of threads used by the finite-volume transport solver (zero for all available).
+    auto setNumThreads(unsigned val) -> void;
+
     auto setBoundaryState(const ChemicalState& state) -> void;
 
     auto setTimeStep(double val) -> void;
 
+    /// Set the options for the reactive transport calculations.
+    auto setOptions(const ReactiveTransportOptions& options) -> void;
+
+    /// Return the time step of the next step (in s), which changes after every step if the time step is adaptive.
+    auto timeStep() const -> double { return dt; }
+
     auto system() const -> const ChemicalSystem& { return system_; }
 
     auto output() -> ChemicalOutput;
 
     auto initialize(const ChemicalField& field) -> void;
 
-    auto step(ChemicalField& field) -> void;
+    auto step(ChemicalField& field) -> ReactiveTransportResult;
+
+    /// Save a checkpoint of the reactive transport calculation to a binary file.
+    /// The checkpoint contains the number of steps, the time step, the amounts of elements on every
+    /// cell and the states of the chemical field, so that a calculation can be restarted with @ref load.
+    /// @param filename The name of the checkpoint file
+    /// @param field The chemical field of the calculation
+    /// @param caches The flag that indicates if the conditions and sensitivities of the last equilibrium
+    /// calculations on every cell are saved, so that quiescent cells are still skipped after a restart
+    auto save(std::string filename, const ChemicalField& field, bool caches = true) const -> void;
+
+    /// Load a checkpoint of the reactive transport calculation from a binary file created with @ref save.
+    /// This method must be called after @ref initialize with a mesh with the same number of cells.
+    /// An exception is thrown if the file is invalid, in which case this solver and the field are unchanged.
+    /// @param filename The name of the checkpoint file
+    /// @param field The chemical field of the calculation to be restored
+    auto load(std::string filename, ChemicalField& field) -> void;
 
 private:
+    /// Return the number of cells in the mesh of the active transport solver.
+    auto numCells() const -> Index;
+
+    /// Return true if the equilibrium calculation of a cell can be skipped.
+    auto quiescent(Index icell, double T, double P) const -> bool;
+
+    /// Update the time step for the next step from the convergence of the chemical calculations.
+    auto adaptTimeStep(const ReactiveTransportResult& result) -> void;
+
+    /// The options for the reactive transport calculations.
+    ReactiveTransportOptions options;
+
+    /// The time step of the reactive transport calculations (in s).
+    double dt = 0.0;
+
     /// The chemical system common to all degrees of freedom in the chemical field.
     ChemicalSystem system_;
 
     /// The solver for solving the transport equations
     TransportSolver transportsolver;
 
+    /// The solver for solving the transport equations on finite-volume meshes
+    FiniteVolumeTransportSolver fvtransportsolver;
+
+    /// The flag that indicates if the finite-volume transport solver is used
+    bool finite_volume = false;
+
     /// The solver for solving the equilibrium equations
     EquilibriumSolver equilibriumsolver;
 
@@ -301,8 +535,11 @@ private:
     /// The amounts of fluid elements on the boundary.
     Vector bbc;
 
-    /// The amounts of a fluid element on each cell of the mesh.
-    Matrix bf;
+    /// The amounts of a fluid element on each cell of the mesh, stored with the elements of a cell contiguous.
+    MatrixRowMajor bf;
+
+    /// The amounts of a fluid element on each cell of the mesh with column-major storage.
+    Matrix bfcols;
 
     /// The amounts of a solid element on each cell of the mesh.
     Matrix bs;
@@ -310,6 +547,27 @@ private:
     /// The amounts of an element on each cell of the mesh.
     Matrix b;
 
+    /// The formula matrix with non-zero columns only for the fluid species.
+    SparseMatrix Af;
+
+    /// The formula matrix with non-zero columns only for the solid species.
+    SparseMatrix As;
+
+    /// The amounts of elements on each cell at their last equilibrium calculation.
+    Matrix b0;
+
+    /// The temperatures on each cell at their last equilibrium calculation.
+    Vector T0;
+
+    /// The pressures on each cell at their last equilibrium calculation.
+    Vector P0;
+
+    /// The amounts of species on each cell at their last equilibrium calculation.
+    Matrix n0;
+
+    /// The sensitivities of the equilibrium states on each cell at their last equilibrium calculation.
+    std::vector<EquilibriumSensitivity> sensitivities;
+
     /// The current number of steps in the solution of the reactive transport equations.
     Index steps = 0;
 };
@@ -0,0 +1,94 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright (C) 2014-2018 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+// C++ includes
+#include <chrono>
+#include <iomanip>
+
+#include <Reaktoro/Reaktoro.hpp>
+#include <Reaktoro/Math/Eigen/LU>
+using namespace Reaktoro;
+
+// Return the average wall time of a function over a number of repetitions (in units of ns).
+template<typename Function>
+auto timeit(Index repetitions, Function f) -> double
+{
+    const auto begin = std::chrono::steady_clock::now();
+    for(Index i = 0; i < repetitions; ++i)
+        f();
+    const auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::nano>(end - begin).count()/repetitions;
+}
+
+int main()
+{
+    // Compare the fixed-size LU kernels with the dynamic-size ones and with Eigen::PartialPivLU for
+    // every dimension, so that the default threshold of the fixed-size kernels can be checked on this machine.
+    std::cout << "Dimension   Fixed (ns)   Dynamic (ns)   Eigen (ns)   Speedup" << std::endl;
+    for(Index n = 1; n <= FixedSizeLU::max_fixed_size + 4; ++n)
+    {
+        const Matrix A = Matrix::Random(n, n) + 2.0*n*Matrix::Identity(n, n);
+        const Vector b = Vector::Random(n);
+
+        FixedSizeLU fixed, dynamic;
+        fixed.threshold = FixedSizeLU::max_fixed_size;
+        dynamic.threshold = 0;
+        Eigen::PartialPivLU<Matrix> eigen(n);
+        Vector x(n);
+
+        const Index repetitions = 100000;
+        const double tfixed = timeit(repetitions, [&]() { fixed.compute(A); fixed.solve(b); });
+        const double tdynamic = timeit(repetitions, [&]() { dynamic.compute(A); dynamic.solve(b); });
+        const double teigen = timeit(repetitions, [&]() { eigen.compute(A); x = eigen.solve(b); });
+
+        std::cout << std::setw(9) << n << std::setw(13) << tfixed << std::setw(15) << tdynamic
+                  << std::setw(13) << teigen << std::setw(10) << teigen/tfixed << std::endl;
+    }
+
+    // Compare the equilibrium calculations of a small carbonate system with and without the fixed-size kernels
+    ChemicalEditor editor;
+    editor.addAqueousPhase("H2O CO2 CaCO3").setChemicalModelDebyeHuckel();
+    editor.addMineralPhase("Calcite");
+
+    ChemicalSystem system(editor);
+
+    EquilibriumProblem problem(system);
+    problem.add("H2O", 1, "kg");
+    problem.add("CO2", 0.1, "mol");
+    problem.add("CaCO3", 1, "mol");
+
+    const double T = problem.temperature();
+    const double P = problem.pressure();
+    const Vector b = problem.elementAmounts();
+
+    std::cout << std::endl << "Species: " << system.numSpecies() << ", elements: " << system.numElements() << std::endl;
+    for(Index threshold : {Index(0), KktOptions().fixed_size_threshold})
+    {
+        EquilibriumOptions options;
+        options.optimum.kkt.fixed_size_threshold = threshold;
+
+        EquilibriumSolver solver(system);
+        solver.setOptions(options);
+
+        ChemicalState state(system);
+
+        const Index repetitions = 1000;
+        const double time = timeit(repetitions, [&]() { state.setSpeciesAmounts(0.0); solver.solve(state, T, P, b); });
+
+        std::cout << "Threshold " << std::setw(2) << threshold << ": " << time/1000.0 << " us per equilibrium calculation" << std::endl;
+    }
+}
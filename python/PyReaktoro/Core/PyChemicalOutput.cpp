@@ -17,6 +17,7 @@
 
 // pybind11 includes
 #include <pybind11/pybind11.h>
+#include <pybind11/eigen.h>
 #include <pybind11/stl.h>
 namespace py = pybind11;
 
@@ -44,6 +45,15 @@ void exportChemicalOutput(py::module& m)
     auto attach2 = static_cast<void(ChemicalOutput::*)(double)>(&ChemicalOutput::attach);
     auto attach3 = static_cast<void(ChemicalOutput::*)(std::string)>(&ChemicalOutput::attach);
 
+    auto format1 = static_cast<void(ChemicalOutput::*)(ChemicalOutputFormat)>(&ChemicalOutput::format);
+    auto format2 = static_cast<ChemicalOutputFormat(ChemicalOutput::*)() const>(&ChemicalOutput::format);
+
+    py::enum_<ChemicalOutputFormat>(m, "ChemicalOutputFormat")
+        .value("Text", ChemicalOutputFormat::Text)
+        .value("Binary64", ChemicalOutputFormat::Binary64)
+        .value("Binary32", ChemicalOutputFormat::Binary32)
+        ;
+
     py::class_<ChemicalOutput>(m, "ChemicalOutput")
         .def(py::init<>())
         .def(py::init<const ChemicalSystem&>())
@@ -62,12 +72,25 @@ void exportChemicalOutput(py::module& m)
         .def("attach", attach3)
         .def("scientific", &ChemicalOutput::scientific)
         .def("terminal", &ChemicalOutput::terminal)
+        .def("format", format1)
+        .def("format", format2)
+        .def("blockSize", &ChemicalOutput::blockSize)
         .def("quantities", &ChemicalOutput::quantities)
         .def("headings", &ChemicalOutput::headings)
         .def("open", &ChemicalOutput::open)
         .def("update", &ChemicalOutput::update)
         .def("close", &ChemicalOutput::close)
         ;
+
+    py::class_<ChemicalOutputReader>(m, "ChemicalOutputReader")
+        .def(py::init<>())
+        .def(py::init<std::string>())
+        .def("read", &ChemicalOutputReader::read)
+        .def("headings", &ChemicalOutputReader::headings)
+        .def("values", &ChemicalOutputReader::values)
+        .def("column", &ChemicalOutputReader::column)
+        .def("csv", &ChemicalOutputReader::csv, py::arg("filename"), py::arg("precision") = 17)
+        ;
 }
 
 } // namespace Reaktoro
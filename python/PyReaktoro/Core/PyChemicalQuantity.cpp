@@ -17,6 +17,8 @@
 
 // pybind11 includes
 #include <pybind11/pybind11.h>
+#include <pybind11/eigen.h>
+#include <pybind11/stl.h>
 namespace py = pybind11;
 
 // Reaktoro includes
@@ -29,6 +31,13 @@ namespace py = pybind11;
 
 namespace Reaktoro {
 
+auto ChemicalQuantityPlan_evaluate(ChemicalQuantityPlan& self, const ChemicalState& state, double t) -> Vector
+{
+    Vector values(self.size());
+    self.evaluate(state, t, values);
+    return values;
+}
+
 void exportChemicalQuantity(py::module& m)
 {
     auto update1 = static_cast<ChemicalQuantity&(ChemicalQuantity::*)(const ChemicalState&)>(&ChemicalQuantity::update);
@@ -50,6 +59,15 @@ void exportChemicalQuantity(py::module& m)
         .def("value", &ChemicalQuantity::value)
         .def("__call__", &ChemicalQuantity::value)
         ;
+
+    py::class_<ChemicalQuantityPlan>(m, "ChemicalQuantityPlan")
+        .def(py::init<>())
+        .def(py::init<const ChemicalSystem&, const std::vector<std::string>&>())
+        .def(py::init<const ChemicalQuantity&, const std::vector<std::string>&>())
+        .def("size", &ChemicalQuantityPlan::size)
+        .def("quantities", &ChemicalQuantityPlan::quantities)
+        .def("evaluate", ChemicalQuantityPlan_evaluate, py::arg("state"), py::arg("t") = 0.0)
+        ;
 }
 
 } // namespace Reaktoro
@@ -18,6 +18,7 @@
 // pybind11 includes
 #include <pybind11/pybind11.h>
 #include <pybind11/eigen.h>
+#include <pybind11/numpy.h>
 #include <pybind11/operators.h>
 namespace py = pybind11;
 
@@ -42,6 +43,28 @@ auto cloneChemicalState(ChemicalState& state) -> ChemicalState
     return state;
 }
 
+// Return a writable numpy array over the memory of a vector stored in a chemical state.
+// The array does not copy the data and keeps the Python chemical state object alive.
+auto arrayView(VectorConstRef vec, py::object self) -> py::array_t<double>
+{
+    return py::array_t<double>(vec.size(), vec.data(), self);
+}
+
+auto speciesAmountsView(py::object self) -> py::array_t<double>
+{
+    return arrayView(self.cast<const ChemicalState&>().speciesAmounts(), self);
+}
+
+auto speciesDualPotentialsView(py::object self) -> py::array_t<double>
+{
+    return arrayView(self.cast<const ChemicalState&>().speciesDualPotentials(), self);
+}
+
+auto elementDualPotentialsView(py::object self) -> py::array_t<double>
+{
+    return arrayView(self.cast<const ChemicalState&>().elementDualPotentials(), self);
+}
+
 }  // namespace
 
 void exportChemicalState(py::module& m)
@@ -145,11 +168,13 @@ void exportChemicalState(py::module& m)
         .def("pressure", &ChemicalState::pressure)
         .def("speciesAmounts", speciesAmounts1, py::return_value_policy::reference_internal)
         .def("speciesAmounts", speciesAmounts2)
+        .def("speciesAmountsView", speciesAmountsView)
         .def("speciesAmount", speciesAmount1)
         .def("speciesAmount", speciesAmount2)
         .def("speciesAmount", speciesAmount3)
         .def("speciesAmount", speciesAmount4)
         .def("speciesDualPotentials", &ChemicalState::speciesDualPotentials, py::return_value_policy::reference_internal)
+        .def("speciesDualPotentialsView", speciesDualPotentialsView)
         .def("elementAmounts", &ChemicalState::elementAmounts)
         .def("elementAmountsInPhase", &ChemicalState::elementAmountsInPhase)
         .def("elementAmountsInSpecies", &ChemicalState::elementAmountsInSpecies)
@@ -164,6 +189,7 @@ void exportChemicalState(py::module& m)
         .def("elementAmountInSpecies", elementAmountInSpecies1)
         .def("elementAmountInSpecies", elementAmountInSpecies2)
         .def("elementDualPotentials", &ChemicalState::elementDualPotentials, py::return_value_policy::reference_internal)
+        .def("elementDualPotentialsView", elementDualPotentialsView)
         .def("phaseAmount", phaseAmount1)
         .def("phaseAmount", phaseAmount2)
         .def("phaseAmount", phaseAmount3)
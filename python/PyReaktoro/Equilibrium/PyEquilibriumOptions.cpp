@@ -38,6 +38,12 @@ void exportEquilibriumOptions(py::module& m)
         .def_readwrite("abstol", &SmartEquilibriumOptions::abstol)
         ;
 
+    py::class_<EquilibriumReductionOptions>(m, "EquilibriumReductionOptions")
+        .def_readwrite("active", &EquilibriumReductionOptions::active)
+        .def_readwrite("factor", &EquilibriumReductionOptions::factor)
+        .def_readwrite("max_checks", &EquilibriumReductionOptions::max_checks)
+        ;
+
     py::class_<EquilibriumOptions>(m, "EquilibriumOptions")
         .def(py::init<>())
         .def_readwrite("epsilon", &EquilibriumOptions::epsilon)
@@ -47,6 +53,7 @@ void exportEquilibriumOptions(py::module& m)
         .def_readwrite("optimum", &EquilibriumOptions::optimum)
         .def_readwrite("nonlinear", &EquilibriumOptions::nonlinear)
         .def_readwrite("smart", &EquilibriumOptions::smart)
+        .def_readwrite("reduction", &EquilibriumOptions::reduction)
         ;
 }
 
@@ -34,6 +34,7 @@ void exportEquilibriumResult(py::module& m)
         .def(py::init<>())
         .def_readwrite("optimum", &EquilibriumResult::optimum)
         .def_readwrite("smart", &EquilibriumResult::smart)
+        .def_readwrite("pinned", &EquilibriumResult::pinned)
         ;
 }
 
@@ -18,9 +18,16 @@
 // pybind11 includes
 #include <pybind11/pybind11.h>
 #include <pybind11/eigen.h>
+#include <pybind11/stl.h>
 namespace py = pybind11;
 
+// C++ includes
+#include <algorithm>
+#include <set>
+
 // Reaktoro includes
+#include <Reaktoro/Common/Exception.hpp>
+#include <Reaktoro/Common/ParallelUtils.hpp>
 #include <Reaktoro/Core/ChemicalProperties.hpp>
 #include <Reaktoro/Core/ChemicalState.hpp>
 #include <Reaktoro/Core/ChemicalSystem.hpp>
@@ -32,6 +39,81 @@ namespace py = pybind11;
 #include <Reaktoro/Equilibrium/EquilibriumSolver.hpp>
 
 namespace Reaktoro {
+namespace {
+
+using RowMajorMatrixConstRef = Eigen::Ref<const Eigen::Matrix<double, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor>>;
+
+// Equilibrate the chemical states with given temperatures, pressures and amounts of elements (one row per state).
+// The states are split in contiguous chunks, one per solver, and the chunks are solved in parallel by the
+// persistent thread pool of parallelFor. An error in any chunk is rethrown after all chunks have finished.
+// The calculation runs without the GIL. The chemical models of a ChemicalSystem keep evaluation state and
+// are shared by its copies, so states solved in different chunks must belong to ChemicalSystem instances
+// created independently (e.g., with separate ChemicalEditor::createChemicalSystem calls), and each solver
+// must be created with the chemical system of its states, which are checked before solving. A PHREEQC system must be created from a PhreeqcPool.
+auto solveMany(const std::vector<EquilibriumSolver*>& solvers, const std::vector<ChemicalState*>& states,
+    VectorConstRef T, VectorConstRef P, RowMajorMatrixConstRef b) -> std::vector<EquilibriumResult>
+{
+    const Index num_states = states.size();
+    const Index num_solvers = std::min<Index>(solvers.size(), num_states);
+
+    Assert(T.size() == num_states && P.size() == num_states && b.rows() == num_states,
+        "Cannot equilibrate the chemical states.",
+        "The number of temperatures, pressures and rows of element amounts must match the number of states.");
+
+    Assert(num_states == 0 || num_solvers > 0,
+        "Cannot equilibrate the chemical states.",
+        "At least one equilibrium solver must be given.");
+
+    Assert(std::set<EquilibriumSolver*>(solvers.begin(), solvers.end()).size() == solvers.size() &&
+        std::find(solvers.begin(), solvers.end(), nullptr) == solvers.end(),
+        "Cannot equilibrate the chemical states in parallel.",
+        "The equilibrium solvers must be distinct, since each one is used by a single thread.");
+
+    // The ChemicalSystem instance of each solver, identified by its shared chemical model
+    std::set<const ChemicalModel*> models;
+    for(Index k = 0; k < num_solvers; ++k)
+    {
+        const ChemicalModel* model = &solvers[k]->system().chemicalModel();
+
+        Assert(models.insert(model).second,
+            "Cannot equilibrate the chemical states in parallel.",
+            "The solvers must be created with independently created ChemicalSystem instances, "
+            "and not with copies of the same one.");
+
+        for(Index i = k * num_states / num_solvers; i < (k + 1) * num_states / num_solvers; ++i)
+            Assert(&states[i]->system().chemicalModel() == model,
+                "Cannot equilibrate the chemical states in parallel.",
+                "The state " << i << " does not belong to the ChemicalSystem instance of the solver of its chunk.");
+    }
+
+    std::vector<EquilibriumResult> results(num_states);
+
+    py::gil_scoped_release release;
+
+    // Solve the states in the range [begin, end) with the k-th solver
+    auto solve = [&](Index k, Index begin, Index end)
+    {
+        for(Index i = begin; i < end; ++i)
+            results[i] = solvers[k]->solve(*states[i], T[i], P[i], b.row(i).data());
+    };
+
+    // Use one task per solver, each solving its own contiguous chunk of states
+    parallelFor(num_solvers, [&](Index kbegin, Index kend)
+    {
+        for(Index k = kbegin; k < kend; ++k)
+            solve(k, k * num_states / num_solvers, (k + 1) * num_states / num_solvers);
+    }, num_solvers);
+
+    return results;
+}
+
+auto solveManySerial(EquilibriumSolver& solver, const std::vector<ChemicalState*>& states,
+    VectorConstRef T, VectorConstRef P, RowMajorMatrixConstRef b) -> std::vector<EquilibriumResult>
+{
+    return solveMany({&solver}, states, T, P, b);
+}
+
+}  // namespace
 
 void exportEquilibriumSolver(py::module& m)
 {
@@ -55,12 +137,16 @@ void exportEquilibriumSolver(py::module& m)
         .def("solve", solve2)
         .def("solve", solve3)
         .def("solve", solve4)
+        .def("solveMany", solveManySerial)
+        .def("system", &EquilibriumSolver::system, py::return_value_policy::reference_internal)
         .def("properties", &EquilibriumSolver::properties, py::return_value_policy::reference_internal)
         .def("sensitivity", &EquilibriumSolver::sensitivity, py::return_value_policy::reference_internal)
 //        .def("dndT", &EquilibriumSolver::dndT, py::return_value_policy::reference_internal)
 //        .def("dndP", &EquilibriumSolver::dndP, py::return_value_policy::reference_internal)
 //        .def("dndb", &EquilibriumSolver::dndb, py::return_value_policy::reference_internal)
         ;
+
+    m.def("solveMany", solveMany);
 }
 
 } // namespace Reaktoro
@@ -0,0 +1,55 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright (C) 2014-2018 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+// pybind11 includes
+#include <pybind11/pybind11.h>
+#include <pybind11/eigen.h>
+#include <pybind11/stl.h>
+namespace py = pybind11;
+
+// Reaktoro includes
+#include <Reaktoro/Core/ChemicalSystem.hpp>
+#include <Reaktoro/Equilibrium/SmartEquilibriumDatabase.hpp>
+
+namespace Reaktoro {
+
+void exportSmartEquilibriumDatabase(py::module& m)
+{
+    auto add1 = static_cast<void (SmartEquilibriumDatabase::*)(const SmartEquilibriumReference&)>(&SmartEquilibriumDatabase::add);
+    auto add2 = static_cast<void (SmartEquilibriumDatabase::*)(const std::vector<SmartEquilibriumReference>&)>(&SmartEquilibriumDatabase::add);
+
+    py::class_<SmartEquilibriumReference>(m, "SmartEquilibriumReference")
+        .def(py::init<>())
+        .def_readwrite("be", &SmartEquilibriumReference::be)
+        .def_readwrite("state", &SmartEquilibriumReference::state)
+        .def_readwrite("properties", &SmartEquilibriumReference::properties)
+        .def_readwrite("sensitivity", &SmartEquilibriumReference::sensitivity)
+        ;
+
+    py::class_<SmartEquilibriumDatabase>(m, "SmartEquilibriumDatabase")
+        .def(py::init<>())
+        .def(py::init<const ChemicalSystem&>())
+        .def("system", &SmartEquilibriumDatabase::system, py::return_value_policy::reference_internal)
+        .def("add", add1)
+        .def("add", add2)
+        .def("size", &SmartEquilibriumDatabase::size)
+        .def("save", &SmartEquilibriumDatabase::save)
+        .def("load", &SmartEquilibriumDatabase::load)
+        ;
+}
+
+} // namespace Reaktoro
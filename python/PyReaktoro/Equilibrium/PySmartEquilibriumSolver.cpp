@@ -28,6 +28,7 @@ namespace py = pybind11;
 #include <Reaktoro/Equilibrium/EquilibriumOptions.hpp>
 #include <Reaktoro/Equilibrium/EquilibriumProblem.hpp>
 #include <Reaktoro/Equilibrium/EquilibriumResult.hpp>
+#include <Reaktoro/Equilibrium/SmartEquilibriumDatabase.hpp>
 #include <Reaktoro/Equilibrium/SmartEquilibriumSolver.hpp>
 
 namespace Reaktoro {
@@ -54,6 +55,11 @@ void exportSmartEquilibriumSolver(py::module& m)
         .def("solve", solve1)
         .def("solve", solve2)
         .def("properties", &SmartEquilibriumSolver::properties, py::return_value_policy::reference_internal)
+        .def("setDatabase", &SmartEquilibriumSolver::setDatabase)
+        .def("database", &SmartEquilibriumSolver::database, py::return_value_policy::reference_internal)
+        .def("numLearnedStates", &SmartEquilibriumSolver::numLearnedStates)
+        .def("save", &SmartEquilibriumSolver::save)
+        .def("load", &SmartEquilibriumSolver::load)
         ;
 }
 
@@ -38,6 +38,7 @@ void exportPhreeqc(py::module& m)
         .def("load", &Phreeqc::load)
         .def("execute", execute1)
         .def("execute", execute2)
+        .def("replicate", &Phreeqc::replicate)
         .def("reset", &Phreeqc::reset)
         .def("reactions", &Phreeqc::reactions)
         .def("stoichiometricMatrix", &Phreeqc::stoichiometricMatrix)
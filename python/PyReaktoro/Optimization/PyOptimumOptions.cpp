@@ -90,6 +90,13 @@ void exportOptimumOptions(py::module& m)
         .def_readwrite("use_kkt_solver", &OptimumParamsKarpov::use_kkt_solver)
         ;
 
+    py::class_<OptimumParamsSimplex>(m, "OptimumParamsSimplex")
+        .def(py::init<>())
+        .def_readwrite("refactorization_frequency", &OptimumParamsSimplex::refactorization_frequency)
+        .def_readwrite("pivot_tolerance", &OptimumParamsSimplex::pivot_tolerance)
+        .def_readwrite("warmstart", &OptimumParamsSimplex::warmstart)
+        ;
+
     py::class_<OptimumOutputOptions, OutputterOptions>(m, "OptimumOutput")
         .def(py::init<>())
         .def_readwrite("xprefix", &OptimumOutputOptions::xprefix)
@@ -126,6 +133,7 @@ void exportOptimumOptions(py::module& m)
         .def_readwrite("ipnewton", &OptimumOptions::ipnewton)
         .def_readwrite("ipactive", &OptimumOptions::ipactive)
         .def_readwrite("karpov", &OptimumOptions::karpov)
+        .def_readwrite("simplex", &OptimumOptions::simplex)
         .def_readwrite("regularization", &OptimumOptions::regularization)
         ;
 }
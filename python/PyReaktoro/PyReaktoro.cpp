@@ -58,6 +58,7 @@ PYBIND11_MODULE(PyReaktoro, m)
     exportEquilibriumSensitivity(m);
     exportEquilibriumSolver(m);
     exportEquilibriumUtils(m);
+    exportSmartEquilibriumDatabase(m);
     exportSmartEquilibriumSolver(m);
 
     // Backends module
@@ -65,6 +66,7 @@ PYBIND11_MODULE(PyReaktoro, m)
     exportGems(m);
     exportPhreeqc(m);
     exportPhreeqcEditor(m);
+    exportPhreeqcPool(m);
 
     // Interpreter module
     exportInterpreter(m);
@@ -107,4 +109,6 @@ PYBIND11_MODULE(PyReaktoro, m)
     exportChemicalField(m);
     exportMesh(m);
     exportTransportSolver(m);
+    exportFiniteVolumeMesh(m);
+    exportFiniteVolumeTransportSolver(m);
     exportReactiveTransportSolver(m);}
@@ -60,6 +60,7 @@ void exportEquilibriumResult(py::module& m);
 void exportEquilibriumSensitivity(py::module& m);
 void exportEquilibriumSolver(py::module& m);
 void exportEquilibriumUtils(py::module& m);
+void exportSmartEquilibriumDatabase(py::module& m);
 void exportSmartEquilibriumSolver(py::module& m);
 
 // Backends module
@@ -67,6 +68,7 @@ void exportGems(py::module& m);
 void exportInterface(py::module& m);
 void exportPhreeqc(py::module& m);
 void exportPhreeqcEditor(py::module& m);
+void exportPhreeqcPool(py::module& m);
 
 // Interpreter module
 void exportInterpreter(py::module& m);
@@ -109,6 +111,8 @@ void exportWater(py::module& m);
 void exportChemicalField(py::module& m);
 void exportMesh(py::module& m);
 void exportTransportSolver(py::module& m);
+void exportFiniteVolumeMesh(py::module& m);
+void exportFiniteVolumeTransportSolver(py::module& m);
 void exportReactiveTransportSolver(py::module& m);
 
 } // namespace Reaktoro
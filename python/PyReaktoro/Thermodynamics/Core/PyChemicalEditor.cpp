@@ -21,6 +21,7 @@
 namespace py = pybind11;
 
 // Reaktoro includes
+#include <Reaktoro/Common/InterpolationUtils.hpp>
 #include <Reaktoro/Core/ChemicalSystem.hpp>
 #include <Reaktoro/Core/ReactionSystem.hpp>
 #include <Reaktoro/Thermodynamics/Core/ChemicalEditor.hpp>
@@ -37,6 +38,11 @@ namespace Reaktoro {
 
 void exportChemicalEditor(py::module& m)
 {
+    py::enum_<InterpolationMethod>(m, "InterpolationMethod")
+        .value("Bilinear", InterpolationMethod::Bilinear)
+        .value("Bicubic", InterpolationMethod::Bicubic)
+        ;
+
     auto addPhase1 = static_cast<AqueousPhase&(ChemicalEditor::*)(const AqueousPhase&)>(&ChemicalEditor::addPhase);
     auto addPhase2 = static_cast<GaseousPhase&(ChemicalEditor::*)(const GaseousPhase&)>(&ChemicalEditor::addPhase);
     auto addPhase3 = static_cast<MineralPhase&(ChemicalEditor::*)(const MineralPhase&)>(&ChemicalEditor::addPhase);
@@ -67,6 +73,8 @@ void exportChemicalEditor(py::module& m)
         .def(py::init<const Database&>())
         .def("setTemperatures", &ChemicalEditor::setTemperatures)
         .def("setPressures", &ChemicalEditor::setPressures)
+        .def("setInterpolationMethod", &ChemicalEditor::setInterpolationMethod)
+        .def("setInterpolationTolerance", &ChemicalEditor::setInterpolationTolerance)
         .def("addPhase", addPhase1, py::return_value_policy::reference_internal)
         .def("addPhase", addPhase2, py::return_value_policy::reference_internal)
         .def("addPhase", addPhase3, py::return_value_policy::reference_internal)
@@ -32,6 +32,8 @@ void exportAqueousPhase(py::module& m)
 {
 	auto setChemicalModelDebyeHuckel1 = static_cast<AqueousPhase&(AqueousPhase::*)()>(&AqueousPhase::setChemicalModelDebyeHuckel);
 	auto setChemicalModelDebyeHuckel2 = static_cast<AqueousPhase&(AqueousPhase::*)(const DebyeHuckelParams&)>(&AqueousPhase::setChemicalModelDebyeHuckel);
+	auto setChemicalModelDebyeHuckelVectorized1 = static_cast<AqueousPhase&(AqueousPhase::*)()>(&AqueousPhase::setChemicalModelDebyeHuckelVectorized);
+	auto setChemicalModelDebyeHuckelVectorized2 = static_cast<AqueousPhase&(AqueousPhase::*)(const DebyeHuckelParams&)>(&AqueousPhase::setChemicalModelDebyeHuckelVectorized);
 
     py::class_<AqueousPhase, Phase>(m, "AqueousPhase")
         .def(py::init<>())
@@ -40,7 +42,10 @@ void exportAqueousPhase(py::module& m)
         .def("setChemicalModelIdeal", &AqueousPhase::setChemicalModelIdeal, py::return_value_policy::reference_internal)
         .def("setChemicalModelDebyeHuckel", setChemicalModelDebyeHuckel1, py::return_value_policy::reference_internal)
         .def("setChemicalModelDebyeHuckel", setChemicalModelDebyeHuckel2, py::return_value_policy::reference_internal)
+        .def("setChemicalModelDebyeHuckelVectorized", setChemicalModelDebyeHuckelVectorized1, py::return_value_policy::reference_internal)
+        .def("setChemicalModelDebyeHuckelVectorized", setChemicalModelDebyeHuckelVectorized2, py::return_value_policy::reference_internal)
         .def("setChemicalModelHKF", &AqueousPhase::setChemicalModelHKF, py::return_value_policy::reference_internal)
+        .def("setChemicalModelHKFVectorized", &AqueousPhase::setChemicalModelHKFVectorized, py::return_value_policy::reference_internal)
         .def("setChemicalModelPitzerHMW", &AqueousPhase::setChemicalModelPitzerHMW, py::return_value_policy::reference_internal)
         .def("setActivityModel", &AqueousPhase::setActivityModel, py::return_value_policy::reference_internal)
         .def("setActivityModelIdeal", &AqueousPhase::setActivityModelIdeal, py::return_value_policy::reference_internal)
@@ -0,0 +1,80 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright (C) 2014-2018 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+// pybind11 includes
+#include <pybind11/pybind11.h>
+#include <pybind11/eigen.h>
+#include <pybind11/stl.h>
+namespace py = pybind11;
+
+// Reaktoro includes
+#include <Reaktoro/Transport/FiniteVolumeTransportSolver.hpp>
+
+namespace Reaktoro {
+
+void exportFiniteVolumeMesh(py::module& m)
+{
+    py::class_<FiniteVolumeMesh>(m, "FiniteVolumeMesh")
+        .def(py::init<>())
+        .def(py::init<Index, Index, double, double>(), py::arg("nx"), py::arg("ny"), py::arg("Lx"), py::arg("Ly"))
+        .def(py::init<Index, Index, Index, double, double, double>(), py::arg("nx"), py::arg("ny"), py::arg("nz"), py::arg("Lx"), py::arg("Ly"), py::arg("Lz"))
+        .def("setCells", &FiniteVolumeMesh::setCells)
+        .def("addFace", &FiniteVolumeMesh::addFace)
+        .def("addBoundaryFace", &FiniteVolumeMesh::addBoundaryFace, py::arg("cell"), py::arg("area"), py::arg("normal"), py::arg("distance"), py::arg("tag") = 0)
+        .def("numCells", &FiniteVolumeMesh::numCells)
+        .def("numFaces", &FiniteVolumeMesh::numFaces)
+        .def("numBoundaryFaces", &FiniteVolumeMesh::numBoundaryFaces)
+        .def("volumes", &FiniteVolumeMesh::volumes)
+        .def("centroids", &FiniteVolumeMesh::centroids)
+        .def("owners", &FiniteVolumeMesh::owners)
+        .def("neighbours", &FiniteVolumeMesh::neighbours)
+        .def("faceAreas", &FiniteVolumeMesh::faceAreas)
+        .def("faceNormals", &FiniteVolumeMesh::faceNormals)
+        .def("faceDistances", &FiniteVolumeMesh::faceDistances)
+        .def("boundaryCells", &FiniteVolumeMesh::boundaryCells)
+        .def("boundaryAreas", &FiniteVolumeMesh::boundaryAreas)
+        .def("boundaryNormals", &FiniteVolumeMesh::boundaryNormals)
+        .def("boundaryDistances", &FiniteVolumeMesh::boundaryDistances)
+        .def("boundaryTags", &FiniteVolumeMesh::boundaryTags)
+        ;
+}
+
+void exportFiniteVolumeTransportSolver(py::module& m)
+{
+    auto step1 = static_cast<void(FiniteVolumeTransportSolver::*)(VectorRef, VectorConstRef)>(&FiniteVolumeTransportSolver::step);
+    auto step2 = static_cast<void(FiniteVolumeTransportSolver::*)(VectorRef)>(&FiniteVolumeTransportSolver::step);
+    auto step3 = static_cast<void(FiniteVolumeTransportSolver::*)(MatrixRef, VectorConstRef)>(&FiniteVolumeTransportSolver::step);
+
+    py::class_<FiniteVolumeTransportSolver>(m, "FiniteVolumeTransportSolver")
+        .def(py::init<>())
+        .def("setMesh", &FiniteVolumeTransportSolver::setMesh)
+        .def("setVelocity", &FiniteVolumeTransportSolver::setVelocity)
+        .def("setFluxes", &FiniteVolumeTransportSolver::setFluxes)
+        .def("setDiffusionCoeff", &FiniteVolumeTransportSolver::setDiffusionCoeff)
+        .def("setBoundaryValue", &FiniteVolumeTransportSolver::setBoundaryValue)
+        .def("setTimeStep", &FiniteVolumeTransportSolver::setTimeStep)
+        .def("setNumThreads", &FiniteVolumeTransportSolver::setNumThreads)
+        .def("mesh", &FiniteVolumeTransportSolver::mesh, py::return_value_policy::reference_internal)
+        .def("courant", &FiniteVolumeTransportSolver::courant)
+        .def("initialize", &FiniteVolumeTransportSolver::initialize)
+        .def("step", step1)
+        .def("step", step2)
+        .def("step", step3)
+        ;
+}
+
+} // namespace Reaktoro
@@ -52,6 +52,13 @@ auto ChemicalField_getitem(const ChemicalField& self, Index i) -> const Chemical
     return self[i];
 }
 
+auto ChemicalField_evaluate(const ChemicalField& self, ChemicalQuantityPlan& plan) -> Matrix
+{
+    Matrix values(plan.size(), self.size());
+    self.evaluate(plan, values);
+    return values;
+}
+
 void exportChemicalField(py::module& m)
 {
     py::class_<ChemicalField>(m, "ChemicalField")
@@ -62,7 +69,15 @@ void exportChemicalField(py::module& m)
         .def("temperature", &ChemicalField::temperature)
         .def("pressure", &ChemicalField::pressure)
         .def("elementAmounts", &ChemicalField::elementAmounts)
+        .def("temperatures", &ChemicalField::temperatures)
+        .def("pressures", &ChemicalField::pressures)
+        .def("speciesAmounts", &ChemicalField::speciesAmounts)
+        .def("elementDualPotentials", &ChemicalField::elementDualPotentials)
+        .def("speciesDualPotentials", &ChemicalField::speciesDualPotentials)
         .def("output", &ChemicalField::output)
+        .def("evaluate", ChemicalField_evaluate)
+        .def("save", static_cast<void(ChemicalField::*)(std::string) const>(&ChemicalField::save))
+        .def("load", static_cast<void(ChemicalField::*)(std::string)>(&ChemicalField::load))
         .def("__setitem__", ChemicalField_setitem)
         .def("__getitem__", ChemicalField_getitem, py::return_value_policy::reference_internal)
         ;
@@ -81,25 +96,70 @@ void exportTransportSolver(py::module& m)
         .def("setBoundaryValue", &TransportSolver::setBoundaryValue)
         .def("setTimeStep", &TransportSolver::setTimeStep)
         .def("mesh", &TransportSolver::mesh, py::return_value_policy::reference_internal)
+        .def("courant", &TransportSolver::courant)
         .def("initialize", &TransportSolver::initialize)
         .def("step", step1)
         .def("step", step2)
+        .def("stepMultiple", &TransportSolver::stepMultiple)
         ;
 }
 
 void exportReactiveTransportSolver(py::module& m)
 {
+    py::class_<ReactiveTransportOptions>(m, "ReactiveTransportOptions")
+        .def(py::init<>())
+        .def_readwrite("skip_quiescent_cells", &ReactiveTransportOptions::skip_quiescent_cells)
+        .def_readwrite("skip_relative_tolerance", &ReactiveTransportOptions::skip_relative_tolerance)
+        .def_readwrite("skip_absolute_tolerance", &ReactiveTransportOptions::skip_absolute_tolerance)
+        .def_readwrite("skip_temperature_tolerance", &ReactiveTransportOptions::skip_temperature_tolerance)
+        .def_readwrite("skip_pressure_tolerance", &ReactiveTransportOptions::skip_pressure_tolerance)
+        .def_readwrite("skip_sensitivity_update", &ReactiveTransportOptions::skip_sensitivity_update)
+        .def_readwrite("max_courant", &ReactiveTransportOptions::max_courant)
+        .def_readwrite("adaptive_time_step", &ReactiveTransportOptions::adaptive_time_step)
+        .def_readwrite("min_time_step", &ReactiveTransportOptions::min_time_step)
+        .def_readwrite("max_time_step", &ReactiveTransportOptions::max_time_step)
+        .def_readwrite("time_step_increase_factor", &ReactiveTransportOptions::time_step_increase_factor)
+        .def_readwrite("time_step_decrease_factor", &ReactiveTransportOptions::time_step_decrease_factor)
+        .def_readwrite("time_step_increase_iterations", &ReactiveTransportOptions::time_step_increase_iterations)
+        .def_readwrite("time_step_decrease_iterations", &ReactiveTransportOptions::time_step_decrease_iterations)
+        .def_readwrite("phase_amount_threshold", &ReactiveTransportOptions::phase_amount_threshold)
+        ;
+
+    py::class_<ReactiveTransportResult>(m, "ReactiveTransportResult")
+        .def(py::init<>())
+        .def_readwrite("num_cells_solved", &ReactiveTransportResult::num_cells_solved)
+        .def_readwrite("num_cells_skipped", &ReactiveTransportResult::num_cells_skipped)
+        .def_readwrite("time_step", &ReactiveTransportResult::time_step)
+        .def_readwrite("num_transport_substeps", &ReactiveTransportResult::num_transport_substeps)
+        .def_readwrite("max_equilibrium_iterations", &ReactiveTransportResult::max_equilibrium_iterations)
+        .def_readwrite("num_cells_assemblage_changed", &ReactiveTransportResult::num_cells_assemblage_changed)
+        ;
+
+    auto setMesh1 = static_cast<void(ReactiveTransportSolver::*)(const Mesh&)>(&ReactiveTransportSolver::setMesh);
+    auto setMesh2 = static_cast<void(ReactiveTransportSolver::*)(const FiniteVolumeMesh&)>(&ReactiveTransportSolver::setMesh);
+
+    auto setVelocity1 = static_cast<void(ReactiveTransportSolver::*)(double)>(&ReactiveTransportSolver::setVelocity);
+    auto setVelocity2 = static_cast<void(ReactiveTransportSolver::*)(VectorConstRef)>(&ReactiveTransportSolver::setVelocity);
+
     py::class_<ReactiveTransportSolver>(m, "ReactiveTransportSolver")
         .def(py::init<const ChemicalSystem&>())
-        .def("setMesh", &ReactiveTransportSolver::setMesh)
-        .def("setVelocity", &ReactiveTransportSolver::setVelocity)
+        .def("setMesh", setMesh1)
+        .def("setMesh", setMesh2)
+        .def("setVelocity", setVelocity1)
+        .def("setVelocity", setVelocity2)
+        .def("setFluxes", &ReactiveTransportSolver::setFluxes)
         .def("setDiffusionCoeff", &ReactiveTransportSolver::setDiffusionCoeff)
+        .def("setNumThreads", &ReactiveTransportSolver::setNumThreads)
         .def("setBoundaryState", &ReactiveTransportSolver::setBoundaryState)
         .def("setTimeStep", &ReactiveTransportSolver::setTimeStep)
+        .def("setOptions", &ReactiveTransportSolver::setOptions)
+        .def("timeStep", &ReactiveTransportSolver::timeStep)
         .def("system", &ReactiveTransportSolver::system, py::return_value_policy::reference_internal)
         .def("output", &ReactiveTransportSolver::output)
         .def("initialize", &ReactiveTransportSolver::initialize)
         .def("step", &ReactiveTransportSolver::step)
+        .def("save", &ReactiveTransportSolver::save, py::arg("filename"), py::arg("field"), py::arg("caches") = true)
+        .def("load", &ReactiveTransportSolver::load)
         ;
 }
 
@@ -0,0 +1,163 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright (C) 2014-2018 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+#include <doctest/doctest.hpp>
+
+// Reaktoro includes
+#include <Reaktoro/Reaktoro.hpp>
+using namespace Reaktoro;
+
+const Database db("supcrt98");
+
+/// Return true if two matrices are equal up to a relative tolerance.
+template<typename MatrixA, typename MatrixB>
+auto approxEqual(const MatrixA& a, const MatrixB& b) -> bool
+{
+    return (a - b).norm() <= 1e-10 * std::max(1.0, b.norm());
+}
+
+/// Check that the chemical properties of a vectorized aqueous model match those of the per-ion model.
+auto checkVectorizedModel(double T, double P, std::function<void(AqueousPhase&)> original, std::function<void(AqueousPhase&)> vectorized, Index izero) -> void
+{
+    ChemicalEditor editor0(db), editor1(db);
+    original(editor0.addAqueousPhase("H2O NaCl CaCO3 MgSO4 KCl CO2"));
+    vectorized(editor1.addAqueousPhase("H2O NaCl CaCO3 MgSO4 KCl CO2"));
+    editor0.addMineralPhase("Calcite");
+    editor1.addMineralPhase("Calcite");
+
+    ChemicalSystem system0(editor0);
+    ChemicalSystem system1(editor1);
+
+    EquilibriumProblem problem(system0);
+    problem.setTemperature(T);
+    problem.setPressure(P);
+    problem.add("H2O", 1, "kg");
+    problem.add("NaCl", 1, "mol");
+    problem.add("CaCO3", 0.1, "mol");
+    problem.add("MgSO4", 0.05, "mol");
+    problem.add("CO2", 0.2, "mol");
+
+    ChemicalState state = equilibrate(problem);
+    Vector n = state.speciesAmounts();
+
+    // Set the amount of a charged species to zero, which is skipped in the per-ion HKF model
+    if(izero < n.size())
+        n[izero] = 0.0;
+
+    ChemicalProperties props0 = system0.properties(T, P, n);
+    ChemicalProperties props1 = system1.properties(T, P, n);
+
+    const Index iaqueous = system0.indexPhase("Aqueous");
+    const Index ifirst = system0.indexFirstSpeciesInPhase(iaqueous);
+    const Index size = system0.numSpeciesInPhase(iaqueous);
+
+    const ChemicalVector ln_g0 = props0.lnActivityCoefficients();
+    const ChemicalVector ln_g1 = props1.lnActivityCoefficients();
+    const ChemicalVector ln_a0 = props0.lnActivities();
+    const ChemicalVector ln_a1 = props1.lnActivities();
+
+    // Compare only the aqueous species, ignoring those with zero amount in the ln activities
+    for(Index i = ifirst; i < ifirst + size; ++i)
+    {
+        CHECK(ln_g1.val[i] == approx(ln_g0.val[i]));
+        CHECK(approxEqual(ln_g1.ddn.row(i), ln_g0.ddn.row(i)));
+        CHECK(ln_g1.ddT[i] == approx(ln_g0.ddT[i]));
+        CHECK(ln_g1.ddP[i] == approx(ln_g0.ddP[i]));
+
+        if(i == izero) continue;
+
+        CHECK(ln_a1.val[i] == approx(ln_a0.val[i]));
+        CHECK(approxEqual(ln_a1.ddn.row(i), ln_a0.ddn.row(i)));
+        CHECK(ln_a1.ddT[i] == approx(ln_a0.ddT[i]));
+        CHECK(ln_a1.ddP[i] == approx(ln_a0.ddP[i]));
+    }
+}
+
+TEST_CASE("Testing vectorized aqueous chemical models against per-ion models")
+{
+    const auto dh = [](AqueousPhase& phase) { phase.setChemicalModelDebyeHuckel(); };
+    const auto dhvec = [](AqueousPhase& phase) { phase.setChemicalModelDebyeHuckelVectorized(); };
+    const auto hkf = [](AqueousPhase& phase) { phase.setChemicalModelHKF(); };
+    const auto hkfvec = [](AqueousPhase& phase) { phase.setChemicalModelHKFVectorized(); };
+
+    const Index none = std::numeric_limits<Index>::max();
+
+    SUBCASE("Debye-Huckel at 25 C and 1 bar")
+    {
+        checkVectorizedModel(298.15, 1e5, dh, dhvec, none);
+    }
+
+    SUBCASE("Debye-Huckel at 150 C and 100 bar")
+    {
+        checkVectorizedModel(423.15, 100e5, dh, dhvec, none);
+    }
+
+    // The parameters of the Debye-Huckel model with non-zero ion sizes and b parameters
+    DebyeHuckelParams phreeqc, wateq4f, custom;
+    phreeqc.setPHREEQC();
+    wateq4f.setWATEQ4F();
+    custom.aion(4.5);
+    custom.aion("Ca++", 5.0);
+    custom.bion(0.1);
+    custom.bion("Cl-", 0.02);
+    custom.bneutral(0.1);
+
+    const auto dhparams = [](const DebyeHuckelParams& params)
+    {
+        return [=](AqueousPhase& phase) { phase.setChemicalModelDebyeHuckel(params); };
+    };
+    const auto dhvecparams = [](const DebyeHuckelParams& params)
+    {
+        return [=](AqueousPhase& phase) { phase.setChemicalModelDebyeHuckelVectorized(params); };
+    };
+
+    SUBCASE("Debye-Huckel with the parameters of PHREEQC")
+    {
+        checkVectorizedModel(298.15, 1e5, dhparams(phreeqc), dhvecparams(phreeqc), none);
+        checkVectorizedModel(423.15, 100e5, dhparams(phreeqc), dhvecparams(phreeqc), none);
+    }
+
+    SUBCASE("Debye-Huckel with the parameters of WATEQ4F")
+    {
+        checkVectorizedModel(298.15, 1e5, dhparams(wateq4f), dhvecparams(wateq4f), none);
+        checkVectorizedModel(423.15, 100e5, dhparams(wateq4f), dhvecparams(wateq4f), none);
+    }
+
+    SUBCASE("Debye-Huckel with explicit ion sizes and b parameters")
+    {
+        checkVectorizedModel(298.15, 1e5, dhparams(custom), dhvecparams(custom), none);
+        checkVectorizedModel(423.15, 100e5, dhparams(custom), dhvecparams(custom), none);
+    }
+
+    SUBCASE("HKF at 25 C and 1 bar")
+    {
+        checkVectorizedModel(298.15, 1e5, hkf, hkfvec, none);
+    }
+
+    SUBCASE("HKF at 150 C and 100 bar")
+    {
+        checkVectorizedModel(423.15, 100e5, hkf, hkfvec, none);
+    }
+
+    SUBCASE("HKF with a charged species of zero amount")
+    {
+        ChemicalEditor editor(db);
+        editor.addAqueousPhase("H2O NaCl CaCO3 MgSO4 KCl CO2");
+        ChemicalSystem system(editor);
+        checkVectorizedModel(298.15, 1e5, hkf, hkfvec, system.indexSpecies("K+"));
+    }
+}
@@ -0,0 +1,114 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright (C) 2014-2018 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+#include <doctest/doctest.hpp>
+
+// C++ includes
+#include <limits>
+#include <sstream>
+
+// Reaktoro includes
+#include <Reaktoro/Common/BinaryUtils.hpp>
+using namespace Reaktoro;
+
+/// Return a binary stream with the given sizes followed by a few bytes of data.
+auto corrupted(std::uint64_t rows, std::uint64_t cols) -> std::stringstream
+{
+    std::stringstream stream;
+    writeBinary(stream, rows);
+    writeBinary(stream, cols);
+    writeBinary(stream, 1.0);
+    return stream;
+}
+
+TEST_CASE("Testing the binary serialization utilities")
+{
+    const std::string str = "Calcite";
+    const std::vector<double> values = {1.0, 2.0, 3.0};
+    const Vector vec = Vector::LinSpaced(5, 1.0, 5.0);
+    const Matrix mat = Matrix::Random(3, 4);
+
+    SUBCASE("Checking the values are read back as written")
+    {
+        std::stringstream stream;
+        writeBinary(stream, str);
+        writeBinary(stream, values);
+        writeBinary(stream, vec);
+        writeBinary(stream, mat);
+
+        std::string str_read;
+        std::vector<double> values_read;
+        Vector vec_read;
+        Matrix mat_read;
+        readBinary(stream, str_read);
+        readBinary(stream, values_read);
+        readBinary(stream, vec_read);
+        readBinary(stream, mat_read);
+
+        CHECK(stream.good());
+        CHECK(remainingBytes(stream) == 0);
+        CHECK(str_read == str);
+        CHECK(values_read == values);
+        CHECK(vec_read == vec);
+        CHECK(mat_read == mat);
+    }
+
+    SUBCASE("Checking the stored sizes are validated before allocating memory")
+    {
+        const std::uint64_t huge = std::numeric_limits<std::uint64_t>::max()/2;
+
+        std::string str_read;
+        std::stringstream stream_str = corrupted(huge, 0);
+        CHECK_THROWS(readBinary(stream_str, str_read));
+
+        std::vector<double> values_read;
+        std::stringstream stream_values = corrupted(huge, 0);
+        CHECK_THROWS(readBinary(stream_values, values_read));
+
+        Vector vec_read;
+        std::stringstream stream_vec = corrupted(huge, 1);
+        CHECK_THROWS(readBinary(stream_vec, vec_read));
+
+        Matrix mat_read;
+        std::stringstream stream_mat = corrupted(1000, 1000);
+        CHECK_THROWS(readBinary(stream_mat, mat_read));
+
+        // The number of entries of the matrix overflows in 64 bits
+        std::stringstream stream_overflow = corrupted(std::uint64_t(1) << 40, std::uint64_t(1) << 40);
+        CHECK_THROWS(readBinary(stream_overflow, mat_read));
+    }
+
+    SUBCASE("Checking truncated data is rejected")
+    {
+        std::stringstream stream;
+        writeBinary(stream, mat);
+        const std::string data = stream.str();
+
+        std::stringstream truncated(data.substr(0, data.size() - sizeof(double)));
+        Matrix mat_read;
+        CHECK_THROWS(readBinary(truncated, mat_read));
+    }
+
+    SUBCASE("Checking a failed stream is left to the caller")
+    {
+        std::stringstream empty;
+        Matrix mat_read;
+        CHECK_NOTHROW(readBinary(empty, mat_read));
+        CHECK(empty.fail());
+        CHECK(mat_read.size() == 0);
+    }
+}
@@ -0,0 +1,95 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright (C) 2014-2018 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+#include <doctest/doctest.hpp>
+
+// Reaktoro includes
+#include <Reaktoro/Reaktoro.hpp>
+using namespace Reaktoro;
+
+TEST_CASE("Testing bicubic interpolation of standard Gibbs energies")
+{
+    const Database db("supcrt98");
+    const Thermo thermo(db);
+
+    const std::vector<std::string> names = { "H2O(l)", "H+", "HCO3-", "CO2(aq)", "Calcite", "CO2(g)" };
+
+    std::vector<ThermoScalarFunction> fs;
+    for(auto name : names)
+        fs.push_back([=](double T, double P) { return thermo.standardPartialMolarGibbsEnergy(T, P, name); });
+
+    // A coarse grid from 0 to 300 celsius and from 1 to 1000 bar
+    std::vector<double> temperatures = { 273.15, 423.15, 573.15 };
+    std::vector<double> pressures = { 1.0e+5, 1000.0e+5 };
+
+    const double tolerance = 1.0; // in J/mol
+
+    // The coarse grid does not attain the tolerance without any bisection
+    std::vector<double> Ts = temperatures, Ps = pressures;
+    CHECK_FALSE(refineInterpolationPoints(Ts, Ps, fs, tolerance, 0));
+    CHECK(Ts == temperatures);
+    CHECK(Ps == pressures);
+
+    CHECK(refineInterpolationPoints(temperatures, pressures, fs, tolerance));
+
+    CHECK(temperatures.size() > 3);
+    CHECK(std::is_sorted(temperatures.begin(), temperatures.end()));
+    CHECK(std::is_sorted(pressures.begin(), pressures.end()));
+
+    ThermoVectorFunction interpolated = interpolate(temperatures, pressures, fs, InterpolationMethod::Bicubic);
+
+    for(double T = 280.0; T < 570.0; T += 37.3)
+    {
+        for(double P = 3.0e+5; P < 1000.0e+5; P += 111.1e+5)
+        {
+            const ThermoVector res = interpolated(T, P);
+
+            for(unsigned i = 0; i < fs.size(); ++i)
+            {
+                const ThermoScalar exact = fs[i](T, P);
+                CHECK(std::abs(res.val[i] - exact.val) < 10*tolerance);
+                CHECK(res.ddT[i] == approx(exact.ddT).epsilon(1e-2));
+            }
+        }
+    }
+}
+
+TEST_CASE("Testing the adaptive interpolation tables of ChemicalEditor")
+{
+    const Database db("supcrt98");
+
+    ChemicalEditor editor(db);
+    editor.addAqueousPhase("H2O(l) H+ OH- CO2(aq) HCO3-");
+    editor.setTemperatures({ 0, 150, 300 }, "celsius");
+    editor.setPressures({ 1, 1000 }, "bar");
+    editor.setInterpolationTolerance(1.0);
+
+    // The adaptive refinement cannot be used with bilinear interpolation
+    CHECK_THROWS(editor.createChemicalSystem());
+
+    editor.setInterpolationMethod(InterpolationMethod::Bicubic);
+
+    ChemicalSystem system(editor);
+
+    Thermo thermo(db);
+
+    const ThermoProperties properties = system.properties(400.0, 200.0e+5);
+    const ThermoVector G = properties.standardPartialMolarGibbsEnergies();
+
+    for(Index i = 0; i < system.numSpecies(); ++i)
+        CHECK(std::abs(G.val[i] - thermo.standardPartialMolarGibbsEnergy(400.0, 200.0e+5, system.species(i).name()).val) < 1.0);
+}
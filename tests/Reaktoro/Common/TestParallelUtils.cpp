@@ -0,0 +1,97 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright (C) 2014-2018 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+#include <doctest/doctest.hpp>
+
+// C++ includes
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <thread>
+
+// Reaktoro includes
+#include <Reaktoro/Common/ParallelUtils.hpp>
+using namespace Reaktoro;
+
+TEST_CASE("Testing parallelFor")
+{
+    const Index size = 1000;
+
+    // The values computed serially
+    std::vector<double> expected(size);
+    for(Index i = 0; i < size; ++i)
+        expected[i] = std::sin(i) * std::exp(-1e-3 * i);
+
+    auto compute = [&](std::vector<double>& values, Index begin, Index end)
+    {
+        for(Index i = begin; i < end; ++i)
+            values[i] = std::sin(i) * std::exp(-1e-3 * i);
+    };
+
+    SUBCASE("Checking the parallel results match the serial ones")
+    {
+        for(unsigned num_threads : {1, 2, 3, 8, 64})
+        {
+            std::vector<double> values(size, 0.0);
+            parallelFor(size, [&](Index begin, Index end) { compute(values, begin, end); }, num_threads);
+            CHECK(values == expected);
+        }
+    }
+
+    SUBCASE("Checking every iteration is processed once in repeated calls")
+    {
+        std::vector<int> counts(size, 0);
+        for(unsigned k = 0; k < 100; ++k)
+            parallelFor(size, [&](Index begin, Index end) {
+                for(Index i = begin; i < end; ++i)
+                    counts[i] += 1;
+            }, 4);
+        CHECK(std::all_of(counts.begin(), counts.end(), [](int count) { return count == 100; }));
+    }
+
+    SUBCASE("Checking parallel loops called from several threads and nested ones")
+    {
+        std::vector<std::vector<double>> values(4, std::vector<double>(size, 0.0));
+        std::vector<std::thread> threads;
+        for(Index k = 0; k < values.size(); ++k)
+            threads.emplace_back([&, k]() {
+                parallelFor(size, [&](Index begin, Index end) {
+                    parallelFor(end - begin, [&](Index ibegin, Index iend) {
+                        compute(values[k], begin + ibegin, begin + iend);
+                    }, 2);
+                }, 3);
+            });
+        for(auto& thread : threads)
+            thread.join();
+        for(const auto& v : values)
+            CHECK(v == expected);
+    }
+
+    SUBCASE("Checking an exception in a chunk is rethrown")
+    {
+        auto fail = [&](Index begin, Index end) {
+            if(begin <= size/2 && size/2 < end)
+                throw std::runtime_error("failure");
+        };
+        CHECK_THROWS_AS(parallelFor(size, fail, 4), std::runtime_error);
+
+        // The thread pool can still be used after the failure
+        std::vector<double> values(size, 0.0);
+        parallelFor(size, [&](Index begin, Index end) { compute(values, begin, end); }, 4);
+        CHECK(values == expected);
+    }
+}
@@ -0,0 +1,133 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright (C) 2014-2018 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+#include <doctest/doctest.hpp>
+
+// The profiler macros are tested regardless of the cmake option ENABLE_PROFILING
+#ifndef ENABLE_PROFILING
+#define ENABLE_PROFILING
+#endif
+
+// C++ includes
+#include <sstream>
+#include <thread>
+
+// Reaktoro includes
+#include <Reaktoro/Common/Profiling.hpp>
+using namespace Reaktoro;
+
+auto profiledInner() -> void
+{
+    ProfilerScope("TestProfiling::inner");
+    std::this_thread::sleep_for(std::chrono::milliseconds(2));
+}
+
+auto profiledOuter() -> void
+{
+    ProfilerScope("TestProfiling::outer");
+    profiledInner();
+    profiledInner();
+    ProfilerCount("TestProfiling::counter", 3.0);
+}
+
+/// Return the number of occurrences of a string in another.
+auto occurrences(const std::string& str, const std::string& pattern) -> Index
+{
+    Index count = 0;
+    for(auto pos = str.find(pattern); pos != std::string::npos; pos = str.find(pattern, pos + 1))
+        ++count;
+    return count;
+}
+
+/// Return the number of calls (or samples) of a scope (or counter) in the summary of the profiler.
+auto summaryCount(const std::string& name) -> Index
+{
+    std::istringstream summary(Profiler::summary());
+    std::string line, first;
+    Index count = 0;
+    while(std::getline(summary, line))
+        if(std::istringstream(line) >> first && first == name)
+            std::istringstream(line) >> first >> count;
+    return count;
+}
+
+TEST_CASE("Testing the built-in profiler")
+{
+    Profiler::clear();
+
+    profiledOuter();
+    std::thread(profiledOuter).join();
+
+    // Disabled at runtime, nothing is recorded
+    Profiler::setEnabled(false);
+    profiledOuter();
+    Profiler::setEnabled(true);
+
+    const std::string summary = Profiler::summary();
+    const std::string trace = Profiler::chromeTrace();
+
+    CHECK(summary.find("TestProfiling::outer") != std::string::npos);
+    CHECK(summary.find("TestProfiling::inner") != std::string::npos);
+    CHECK(summary.find("TestProfiling::counter") != std::string::npos);
+
+    // Two threads with one outer and two inner scopes each, and one counter sample each
+    CHECK(occurrences(trace, "\"name\":\"TestProfiling::outer\",\"ph\":\"X\"") == 2);
+    CHECK(occurrences(trace, "\"name\":\"TestProfiling::inner\",\"ph\":\"X\"") == 4);
+    CHECK(occurrences(trace, "\"name\":\"TestProfiling::counter\",\"ph\":\"C\"") == 2);
+    CHECK(occurrences(trace, "\"tid\":0") > 0);
+    CHECK(occurrences(trace, "\"tid\":1") > 0);
+
+    Profiler::clear();
+
+    CHECK(Profiler::chromeTrace().find("TestProfiling::outer") == std::string::npos);
+}
+
+TEST_CASE("Testing the bounded buffers of the built-in profiler")
+{
+    const Index capacity = Profiler::capacity();
+
+    // Each call to profiledOuter records three scopes and one counter value
+    Profiler::setCapacity(6);
+
+    SUBCASE("Checking the trace keeps the most recent measurements and the summary all of them")
+    {
+        for(Index i = 0; i < 10; ++i)
+            profiledOuter();
+
+        const std::string trace = Profiler::chromeTrace();
+        CHECK(occurrences(trace, "\"ph\":\"X\"") == 6);
+        CHECK(occurrences(trace, "\"ph\":\"C\"") == 6);
+        CHECK(summaryCount("TestProfiling::outer") == 10);
+        CHECK(summaryCount("TestProfiling::inner") == 20);
+        CHECK(summaryCount("TestProfiling::counter") == 10);
+    }
+
+    SUBCASE("Checking the measurements of exited threads are kept in bounded buffers")
+    {
+        for(Index i = 0; i < 10; ++i)
+            std::thread(profiledOuter).join();
+
+        const std::string trace = Profiler::chromeTrace();
+        CHECK(occurrences(trace, "\"ph\":\"X\"") == 6);
+        CHECK(occurrences(trace, "\"ph\":\"C\"") == 6);
+        CHECK(summaryCount("TestProfiling::outer") == 10);
+        CHECK(summaryCount("TestProfiling::inner") == 20);
+        CHECK(summaryCount("TestProfiling::counter") == 10);
+    }
+
+    Profiler::setCapacity(capacity);
+}
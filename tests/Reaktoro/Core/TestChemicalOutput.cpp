@@ -0,0 +1,196 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright (C) 2014-2018 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+#include <doctest/doctest.hpp>
+
+// C++ includes
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+
+// Reaktoro includes
+#include <Reaktoro/Reaktoro.hpp>
+using namespace Reaktoro;
+
+namespace {
+
+/// The quantities written to the output files in the tests
+const std::vector<std::string> output_quantities = {"t", "temperature", "speciesAmount(Na+)", "elementAmount(Cl)"};
+
+/// Return the chemical states of a brine at increasing temperatures and amounts of NaCl.
+auto brineStates(const ChemicalSystem& system, Index num_states) -> std::vector<ChemicalState>
+{
+    std::vector<ChemicalState> states;
+    for(Index i = 0; i < num_states; ++i)
+    {
+        ChemicalState state(system);
+        state.setTemperature(298.15 + i);
+        state.setPressure(1.0e5);
+        state.setSpeciesAmount("H2O(l)", 55.5);
+        state.setSpeciesAmount("Na+", 0.1 + 0.01*i);
+        state.setSpeciesAmount("Cl-", 0.1 + 0.01*i);
+        states.push_back(state);
+    }
+    return states;
+}
+
+/// Write the chemical states to an output file with given format and return the expected values of its columns.
+auto writeOutput(const ChemicalSystem& system, const std::vector<ChemicalState>& states, std::string filename, ChemicalOutputFormat format) -> Matrix
+{
+    const std::vector<std::string>& quantities = output_quantities;
+
+    ChemicalOutput output(system);
+    output.filename(filename);
+    output.format(format);
+    output.blockSize(3);
+    for(auto quantity : quantities)
+        output.add(quantity);
+
+    ChemicalQuantity quantity(system);
+    Matrix expected(states.size(), quantities.size());
+
+    output.open();
+    for(Index i = 0; i < states.size(); ++i)
+    {
+        output.update(states[i], 0.5*i);
+        quantity.update(states[i], 0.5*i);
+        for(Index j = 0; j < quantities.size(); ++j)
+            expected(i, j) = quantity.value(quantities[j]);
+    }
+    output.close();
+
+    return expected;
+}
+
+} // namespace
+
+TEST_CASE("Testing binary output files of ChemicalOutput")
+{
+    ChemicalEditor editor;
+    editor.addAqueousPhase("H2O NaCl");
+
+    ChemicalSystem system = editor.createChemicalSystem();
+
+    // The number of states is not a multiple of the block size, so that the last block is partial
+    const auto states = brineStates(system, 10);
+    const std::string filename = "TestChemicalOutput.rko";
+
+    SUBCASE("Double precision values are written exactly")
+    {
+        const Matrix expected = writeOutput(system, states, filename, ChemicalOutputFormat::Binary64);
+        ChemicalOutputReader reader(filename);
+        CHECK(reader.headings() == output_quantities);
+        CHECK(reader.values().rows() == 10);
+        CHECK(reader.values() == expected);
+        CHECK(reader.column("speciesAmount(Na+)") == expected.col(2));
+    }
+
+    SUBCASE("Single precision values are written with float precision")
+    {
+        const Matrix expected = writeOutput(system, states, filename, ChemicalOutputFormat::Binary32);
+        ChemicalOutputReader reader(filename);
+        CHECK(reader.values().rows() == 10);
+        CHECK(reader.values() == expected.cast<float>().cast<double>());
+    }
+
+    SUBCASE("The same instance writes several files in sequence")
+    {
+        ChemicalOutput output(system);
+        output.format(ChemicalOutputFormat::Binary64);
+        output.blockSize(4);
+        output.add("t");
+        output.add("speciesAmount(Na+)");
+        output.filename(filename);
+
+        for(Index k = 0; k < 3; ++k)
+        {
+            output.suffix("-" + std::to_string(k));
+            output.open();
+            for(Index i = 0; i <= k*3; ++i)
+                output.update(states[i], i);
+            output.close();
+
+            // The file is complete once it is closed
+            ChemicalOutputReader reader(output.filename());
+            REQUIRE(reader.values().rows() == k*3 + 1);
+            for(Index i = 0; i <= k*3; ++i)
+            {
+                CHECK(reader.values()(i, 0) == i);
+                CHECK(reader.values()(i, 1) == states[i].speciesAmount("Na+"));
+            }
+            std::remove(output.filename().c_str());
+        }
+    }
+
+    SUBCASE("The CSV conversion writes all headings and values")
+    {
+        const Matrix expected = writeOutput(system, states, filename, ChemicalOutputFormat::Binary64);
+        const std::string csvfilename = "TestChemicalOutput.csv";
+        ChemicalOutputReader(filename).csv(csvfilename);
+
+        std::ifstream csv(csvfilename);
+        std::string line;
+        std::getline(csv, line);
+        CHECK(line == "t,temperature,speciesAmount(Na+),elementAmount(Cl)");
+
+        // The values are written with 17 significant digits, so that they are read back exactly
+        Index numrows = 0;
+        while(std::getline(csv, line))
+        {
+            std::stringstream ss(line);
+            std::string word;
+            for(Index j = 0; j < 4; ++j)
+            {
+                REQUIRE(std::getline(ss, word, ','));
+                CHECK(std::stod(word) == expected(numrows, j));
+            }
+            ++numrows;
+        }
+        CHECK(numrows == 10);
+
+        std::remove(csvfilename.c_str());
+    }
+
+    SUBCASE("Invalid files are rejected")
+    {
+        std::ofstream(filename) << "not a binary output file";
+        CHECK_THROWS(ChemicalOutputReader().read(filename));
+
+        // A file truncated in the middle of a block
+        writeOutput(system, states, filename, ChemicalOutputFormat::Binary64);
+        std::ifstream in(filename, std::ios::binary);
+        std::string contents((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+        in.close();
+        std::ofstream(filename, std::ios::binary) << contents.substr(0, contents.size() - 12);
+        CHECK_THROWS(ChemicalOutputReader().read(filename));
+
+        // A file with corrupted numbers of columns and rows, which are rejected before allocating them
+        const std::uint64_t huge = std::uint64_t(1) << 62;
+        const std::string bytes(reinterpret_cast<const char*>(&huge), sizeof(huge));
+        const Index numcols_offset = sizeof(std::uint64_t) + std::string("REAKTORO-CHEMICAL-OUTPUT").size() + sizeof(std::uint32_t) + sizeof(std::uint8_t);
+
+        std::string corrupted_header = contents;
+        corrupted_header.replace(numcols_offset, sizeof(huge), bytes);
+        std::ofstream(filename, std::ios::binary) << corrupted_header;
+        CHECK_THROWS(ChemicalOutputReader().read(filename));
+
+        std::ofstream(filename, std::ios::binary) << contents + bytes;
+        CHECK_THROWS(ChemicalOutputReader().read(filename));
+    }
+
+    std::remove(filename.c_str());
+}
@@ -0,0 +1,200 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright (C) 2014-2018 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+#include <doctest/doctest.hpp>
+
+// Reaktoro includes
+#include <Reaktoro/Reaktoro.hpp>
+#include <Reaktoro/Transport/TransportSolver.hpp>
+using namespace Reaktoro;
+
+namespace {
+
+/// The numbers of evaluations of the thermodynamic and chemical models of a chemical system.
+struct Evaluations
+{
+    Index thermo = 0;
+    Index chemical = 0;
+};
+
+/// Return a chemical system whose phases count the evaluations of their thermodynamic and chemical models.
+auto createCountingSystem(Evaluations& evaluations) -> ChemicalSystem
+{
+    ChemicalEditor editor;
+    editor.addAqueousPhase("H2O NaCl");
+
+    std::vector<Phase> phases = editor.createChemicalSystem().phases();
+    for(auto& phase : phases)
+    {
+        const PhaseThermoModel thermo_model = phase.thermoModel();
+        phase.setThermoModel([=, &evaluations](PhaseThermoModelResult& res, Temperature T, Pressure P)
+        {
+            ++evaluations.thermo;
+            thermo_model(res, T, P);
+        });
+
+        const PhaseChemicalModel chemical_model = phase.chemicalModel();
+        phase.setChemicalModel([=, &evaluations](PhaseChemicalModelResult& res, Temperature T, Pressure P, VectorConstRef n)
+        {
+            ++evaluations.chemical;
+            chemical_model(res, T, P, n);
+        });
+    }
+
+    return ChemicalSystem(phases);
+}
+
+/// Return a chemical state of an aqueous NaCl solution.
+auto createState(const ChemicalSystem& system, double T, double molality) -> ChemicalState
+{
+    ChemicalState state(system);
+    state.setTemperature(T);
+    state.setPressure(1.0e5);
+    state.setSpeciesAmount("H2O(l)", 55.508);
+    state.setSpeciesAmount("H+", 1.0e-7);
+    state.setSpeciesAmount("OH-", 1.0e-7);
+    state.setSpeciesAmount("Na+", molality);
+    state.setSpeciesAmount("Cl-", molality);
+    return state;
+}
+
+} // namespace
+
+TEST_CASE("Testing the lazy evaluation of chemical properties in ChemicalQuantity")
+{
+    Evaluations evaluations;
+    const ChemicalSystem system = createCountingSystem(evaluations);
+
+    ChemicalQuantity quantity(system);
+    quantity.update(createState(system, 300.0, 0.1));
+
+    SUBCASE("Checking quantities of the chemical state do not evaluate the chemical properties")
+    {
+        CHECK(quantity.value("speciesAmount(Na+)") == 0.1);
+        CHECK(quantity.value("elementAmount(Cl)") == doctest::Approx(0.1));
+        CHECK(quantity.value("phaseAmount(Aqueous)") == doctest::Approx(55.508 + 0.2 + 2.0e-7));
+        double mass = 0.0;
+        for(const auto& species : system.species())
+            mass += species.molarMass() * quantity.state().speciesAmount(species.name());
+        CHECK(quantity.value("phaseMass(Aqueous)") == doctest::Approx(mass));
+        CHECK(evaluations.thermo == 0);
+        CHECK(evaluations.chemical == 0);
+    }
+
+    SUBCASE("Checking the chemical properties are evaluated once per state")
+    {
+        const double pH = quantity.value("pH");
+        quantity.value("ionicStrength");
+        quantity.properties();
+        CHECK(evaluations.thermo == 1);
+        CHECK(evaluations.chemical == 1);
+
+        // The properties evaluated lazily are the properties of the current state
+        const ChemicalState state = createState(system, 300.0, 0.1);
+        CHECK(quantity.properties().lnActivities().val == state.properties().lnActivities().val);
+        CHECK(pH == ChemicalQuantity(state).value("pH"));
+
+        evaluations = Evaluations();
+
+        // A state at the same temperature and pressure does not evaluate the thermodynamic model again
+        quantity.update(createState(system, 300.0, 0.2));
+        CHECK(evaluations.chemical == 0);
+        CHECK(quantity.value("pH") == ChemicalQuantity(createState(system, 300.0, 0.2)).value("pH"));
+
+        evaluations = Evaluations();
+        quantity.update(createState(system, 300.0, 0.3));
+        quantity.value("pH");
+        CHECK(evaluations.thermo == 0);
+        CHECK(evaluations.chemical == 1);
+
+        // A state at another temperature evaluates the thermodynamic model again
+        evaluations = Evaluations();
+        quantity.update(createState(system, 350.0, 0.3));
+        quantity.value("pH");
+        CHECK(evaluations.thermo == 1);
+        CHECK(evaluations.chemical == 1);
+        CHECK(quantity.properties().lnActivities().val == createState(system, 350.0, 0.3).properties().lnActivities().val);
+    }
+}
+
+TEST_CASE("Testing ChemicalQuantityPlan")
+{
+    Evaluations evaluations;
+    const ChemicalSystem system = createCountingSystem(evaluations);
+
+    const std::vector<std::string> quantities = {"temperature", "speciesAmount(Na+)", "pH",
+        "ionicStrength", "phaseMass(Aqueous)", "elementMolality(Cl)", "t"};
+
+    const std::vector<ChemicalState> states = {
+        createState(system, 300.0, 0.1),
+        createState(system, 300.0, 0.5),
+        createState(system, 350.0, 1.0)};
+
+    /// Return the values of the quantities calculated with ChemicalQuantity at a state.
+    auto expected = [&](const ChemicalState& state, double t)
+    {
+        ChemicalQuantity quantity(state.system());
+        quantity.update(state, t);
+        Vector values(quantities.size());
+        for(Index i = 0; i < quantities.size(); ++i)
+            values[i] = quantity.value(quantities[i]);
+        return values;
+    };
+
+    ChemicalQuantityPlan plan(system, quantities);
+    CHECK(plan.size() == quantities.size());
+    CHECK(plan.quantities() == quantities);
+
+    SUBCASE("Checking the plan calculates the same values as ChemicalQuantity")
+    {
+        Vector values(plan.size());
+        for(Index k = 0; k < states.size(); ++k)
+        {
+            plan.evaluate(states[k], 10.0 * k, values);
+            CHECK(values == expected(states[k], 10.0 * k));
+        }
+
+        Vector wrong(plan.size() + 1);
+        CHECK_THROWS(plan.evaluate(states[0], 0.0, wrong));
+    }
+
+    SUBCASE("Checking a plan of quantities of the chemical state does not evaluate the chemical properties")
+    {
+        ChemicalQuantityPlan amounts(system, {"speciesAmount(Na+)", "elementAmount(Cl)", "phaseAmount(Aqueous)"});
+        Vector values(amounts.size());
+        for(const auto& state : states)
+            amounts.evaluate(state, 0.0, values);
+        CHECK(values[0] == 1.0);
+        CHECK(evaluations.thermo == 0);
+        CHECK(evaluations.chemical == 0);
+    }
+
+    SUBCASE("Checking the evaluation of a plan in a chemical field")
+    {
+        ChemicalField field(states.size(), system);
+        for(Index k = 0; k < states.size(); ++k)
+            field[k] = states[k];
+
+        Matrix values(plan.size(), field.size());
+        field.evaluate(plan, values);
+        for(Index k = 0; k < states.size(); ++k)
+            CHECK(Vector(values.col(k)) == expected(states[k], k));
+
+        Matrix wrong(plan.size(), field.size() + 1);
+        CHECK_THROWS(field.evaluate(plan, wrong));
+    }
+}
@@ -0,0 +1,75 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright (C) 2014-2018 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+#include <doctest/doctest.hpp>
+
+// Reaktoro includes
+#include <Reaktoro/Reaktoro.hpp>
+using namespace Reaktoro;
+
+/// Solve an inverse equilibrium problem with fixed pH and check its constraints.
+auto checkInverseProblem(const ChemicalSystem& system, double pH, bool broyden) -> void
+{
+    EquilibriumInverseProblem problem(system);
+    problem.add("H2O", 1, "kg");
+    problem.add("NaCl", 0.1, "mol");
+    problem.add("CaCl2", 2, "mmol");
+    problem.add("MgCl2", 4, "mmol");
+    problem.pH(pH, "HCl", "NaOH");
+    problem.fixSpeciesAmount("CO2(g)", 1.0, "mol");
+    problem.fixSpeciesActivity("O2(g)", 0.20);
+
+    EquilibriumOptions options;
+    options.nonlinear.broyden = broyden;
+
+    EquilibriumInverseSolver solver(system);
+    solver.setOptions(options);
+
+    ChemicalState state(system);
+    const auto res = solver.solve(state, problem);
+
+    REQUIRE(res.optimum.succeeded);
+
+    const ChemicalProperties properties = state.properties();
+    const double ln_aH = properties.lnActivities().val[system.indexSpecies("H+")];
+    const double ln_aO2 = properties.lnActivities().val[system.indexSpecies("O2(g)")];
+
+    CHECK(-ln_aH/std::log(10.0) == approx(pH).epsilon(1e-5));
+    CHECK(std::exp(ln_aO2) == approx(0.20).epsilon(1e-5));
+    CHECK(state.speciesAmount("CO2(g)") == approx(1.0).epsilon(1e-5));
+}
+
+TEST_CASE("Testing EquilibriumInverseSolver")
+{
+    ChemicalEditor editor;
+    editor.addAqueousPhase("H O Na Cl Ca Mg C");
+    editor.addGaseousPhase("H O C");
+
+    ChemicalSystem system(editor);
+
+    SUBCASE("Using exact Jacobian matrices")
+    {
+        for(double pH : {3.0, 5.0, 7.0})
+            checkInverseProblem(system, pH, false);
+    }
+
+    SUBCASE("Using Broyden updates")
+    {
+        for(double pH : {3.0, 5.0, 7.0})
+            checkInverseProblem(system, pH, true);
+    }
+}
@@ -0,0 +1,92 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright (C) 2014-2018 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+#include <doctest/doctest.hpp>
+
+// Reaktoro includes
+#include <Reaktoro/Reaktoro.hpp>
+using namespace Reaktoro;
+
+const Database db("supcrt98");
+
+TEST_CASE("Testing reduced equilibrium calculations against full ones")
+{
+    ChemicalEditor editor(db);
+    editor.addAqueousPhase("H2O NaCl CaCO3 MgSO4 KCl SiO2 Al2O3 CO2");
+    editor.addGaseousPhase({"H2O(g)", "CO2(g)"});
+    editor.addMineralPhase("Calcite");
+    editor.addMineralPhase("Dolomite");
+    editor.addMineralPhase("Quartz");
+    editor.addMineralPhase("Kaolinite");
+    editor.addMineralPhase("Gibbsite");
+    editor.addMineralPhase("Magnesite");
+    editor.addMineralPhase("Halite");
+    editor.addMineralPhase("Sylvite");
+
+    ChemicalSystem system(editor);
+
+    EquilibriumProblem problem(system);
+    problem.add("H2O", 1, "kg");
+    problem.add("NaCl", 1, "mol");
+    problem.add("CaCO3", 0.1, "mol");
+    problem.add("MgSO4", 0.05, "mol");
+    problem.add("CO2", 0.2, "mol");
+    problem.add("SiO2", 0.01, "mol");
+    problem.add("Al2O3", 0.001, "mol");
+    problem.add("KCl", 0.01, "mol");
+
+    const ChemicalState initial = equilibrate(problem);
+    const Vector b = initial.elementAmounts();
+
+    EquilibriumOptions options;
+    options.reduction.active = true;
+
+    EquilibriumSolver full(system);
+    EquilibriumSolver reduced(system);
+    reduced.setOptions(options);
+
+    ChemicalState state_full = initial;
+    ChemicalState state_reduced = initial;
+
+    // The number of calculations in which the reduced problem had pinned species
+    Index num_reduced = 0;
+
+    // Perform a sequence of warm-started calculations, in which some minerals dissolve or precipitate
+    for(double T : {298.15, 308.15, 323.15, 348.15, 373.15, 323.15, 298.15})
+    {
+        const auto res_full = full.solve(state_full, T, 1e5, b);
+        const auto res_reduced = reduced.solve(state_reduced, T, 1e5, b);
+
+        REQUIRE(res_full.optimum.succeeded);
+        REQUIRE(res_reduced.optimum.succeeded);
+
+        CHECK(res_full.pinned == 0);
+        if(res_reduced.pinned > 0)
+            ++num_reduced;
+
+        const Vector n_full = state_full.speciesAmounts();
+        const Vector n_reduced = state_reduced.speciesAmounts();
+
+        for(Index i = 0; i < system.numSpecies(); ++i)
+            CHECK(std::abs(n_reduced[i] - n_full[i]) <= 1e-6 * n_full[i] + 1e-12);
+
+        CHECK(state_reduced.elementAmounts().isApprox(b, 1e-12));
+    }
+
+    // Ensure the comparison above was made with reduced problems
+    CHECK(num_reduced > 0);
+}
@@ -0,0 +1,174 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright (C) 2014-2018 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+#include <doctest/doctest.hpp>
+
+// C++ includes
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <thread>
+
+// Reaktoro includes
+#include <Reaktoro/Reaktoro.hpp>
+using namespace Reaktoro;
+
+namespace {
+
+/// Return a reference state of a brine whose first amount of element is the given label.
+auto brineReference(const ChemicalSystem& system, double label) -> SmartEquilibriumReference
+{
+    SmartEquilibriumReference reference;
+    reference.be = Vector::Constant(system.numElements(), 1.0);
+    reference.be[0] = label;
+    reference.state = ChemicalState(system);
+    reference.state.setTemperature(298.15);
+    reference.state.setPressure(1.0e5);
+    return reference;
+}
+
+} // namespace
+
+TEST_CASE("Testing the snapshots of SmartEquilibriumDatabase")
+{
+    ChemicalEditor editor;
+    editor.addAqueousPhase("H2O NaCl");
+
+    ChemicalSystem system = editor.createChemicalSystem();
+
+    SmartEquilibriumDatabase database(system);
+    CHECK(database.references()->empty());
+
+    // Add states one at a time and in batches, filling several chunks
+    const Index num_references = 1000;
+    for(Index i = 0; i < 300; ++i)
+        database.add(brineReference(system, i));
+
+    const auto snapshot = database.references();
+
+    std::vector<SmartEquilibriumReference> batch;
+    for(Index i = 300; i < num_references; ++i)
+        batch.push_back(brineReference(system, i));
+    database.add(batch);
+
+    // A snapshot keeps the states it had when it was acquired
+    CHECK(snapshot->size() == 300);
+    for(Index i = 0; i < snapshot->size(); ++i)
+        CHECK((*snapshot)[i].be[0] == i);
+
+    const auto references = database.references();
+    REQUIRE(database.size() == num_references);
+    REQUIRE(references->size() == num_references);
+    for(Index i = 0; i < num_references; ++i)
+        CHECK((*references)[i].be[0] == i);
+
+    SUBCASE("Checking a saved database is loaded with the same states")
+    {
+        const std::string filename = "TestSmartEquilibriumDatabase.dat";
+        database.save(filename);
+
+        SmartEquilibriumDatabase loaded(system);
+        loaded.load(filename);
+        REQUIRE(loaded.size() == num_references);
+        for(Index i = 0; i < num_references; ++i)
+            CHECK((*loaded.references())[i].be == (*references)[i].be);
+
+        std::remove(filename.c_str());
+    }
+
+    SUBCASE("Checking a database is set only in solvers of equivalent chemical systems")
+    {
+        SmartEquilibriumSolver solver(system);
+        CHECK_NOTHROW(solver.setDatabase(database));
+        CHECK(solver.database().size() == num_references);
+
+        ChemicalEditor other;
+        other.addAqueousPhase("H2O NaCl CO2");
+        SmartEquilibriumSolver mismatched(other.createChemicalSystem());
+        CHECK_THROWS(mismatched.setDatabase(database));
+
+        // A chemical system with the same numbers of species and elements, but other species
+        ChemicalEditor same_sizes;
+        same_sizes.addAqueousPhase("H2O KCl");
+        const ChemicalSystem potassium = same_sizes.createChemicalSystem();
+        REQUIRE(potassium.numSpecies() == system.numSpecies());
+        REQUIRE(potassium.numElements() == system.numElements());
+        SmartEquilibriumSolver different(potassium);
+        CHECK_THROWS(different.setDatabase(database));
+        CHECK(different.database().size() == 0);
+
+        // A chemical system with the same species, but another activity model
+        ChemicalEditor other_model;
+        other_model.addAqueousPhase("H2O NaCl").setChemicalModelDebyeHuckel();
+        SmartEquilibriumSolver debyehuckel(other_model.createChemicalSystem());
+        CHECK_THROWS(debyehuckel.setDatabase(database));
+    }
+}
+
+TEST_CASE("Testing concurrent additions to SmartEquilibriumDatabase")
+{
+    ChemicalEditor editor;
+    editor.addAqueousPhase("H2O NaCl");
+
+    ChemicalSystem system = editor.createChemicalSystem();
+
+    SmartEquilibriumDatabase database(system);
+
+    const Index num_writers = 4;
+    const Index num_additions = 400;
+
+    // A reader checks that every snapshot is complete while the writers add states
+    std::atomic<bool> done(false);
+    std::atomic<Index> num_invalid(0);
+    std::thread reader([&]()
+    {
+        Index last = 0;
+        while(!done)
+        {
+            const auto references = database.references();
+            if(references->size() < last)
+                ++num_invalid;
+            for(Index i = last; i < references->size(); ++i)
+                if((*references)[i].be.size() != system.numElements())
+                    ++num_invalid;
+            last = references->size();
+        }
+    });
+
+    std::vector<std::thread> writers;
+    for(Index k = 0; k < num_writers; ++k)
+        writers.emplace_back([&, k]()
+        {
+            for(Index i = 0; i < num_additions; ++i)
+                database.add(brineReference(system, k*num_additions + i));
+        });
+
+    for(auto& writer : writers)
+        writer.join();
+    done = true;
+    reader.join();
+
+    CHECK(num_invalid == 0);
+
+    // Every state was added exactly once
+    const auto references = database.references();
+    REQUIRE(references->size() == num_writers*num_additions);
+    std::vector<bool> found(num_writers*num_additions, false);
+    for(Index i = 0; i < references->size(); ++i)
+        found[Index((*references)[i].be[0])] = true;
+    CHECK(std::all_of(found.begin(), found.end(), [](bool val) { return val; }));
+}
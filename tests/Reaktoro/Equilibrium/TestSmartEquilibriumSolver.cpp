@@ -0,0 +1,182 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright (C) 2014-2018 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+#include <doctest/doctest.hpp>
+
+// C++ includes
+#include <cstdio>
+
+// Reaktoro includes
+#include <Reaktoro/Reaktoro.hpp>
+using namespace Reaktoro;
+
+namespace {
+
+/// The chemical system of a brine with dissolved CO2 and its learned conditions.
+struct Brine
+{
+    ChemicalSystem system;
+    ChemicalState state;
+    Vector b;
+
+    Brine()
+    {
+        ChemicalEditor editor;
+        editor.addAqueousPhase("H2O NaCl CO2");
+
+        system = editor.createChemicalSystem();
+
+        EquilibriumProblem problem(system);
+        problem.add("H2O", 1.0, "kg");
+        problem.add("NaCl", 1.0, "mol");
+        problem.add("CO2", 0.1, "mol");
+
+        state = equilibrate(problem);
+        b = problem.elementAmounts();
+    }
+
+    /// Return the element amounts of the brine with a given factor applied to the amount of carbon.
+    auto elementAmounts(double factor) const -> Vector
+    {
+        Vector res = b;
+        res[system.indexElement("C")] *= factor;
+        return res;
+    }
+
+    /// Return the species amounts calculated with a full equilibrium calculation.
+    auto equilibrium(double T, double P, VectorConstRef be) const -> Vector
+    {
+        ChemicalState res = state;
+        EquilibriumSolver solver(system);
+        REQUIRE(solver.solve(res, T, P, be).optimum.succeeded);
+        return res.speciesAmounts();
+    }
+};
+
+/// Return the relative error of species amounts with respect to expected ones.
+auto error(VectorConstRef n, VectorConstRef expected) -> double
+{
+    return (n - expected).norm()/expected.norm();
+}
+
+/// Return the relative error of the amounts of solutes, skipping the dominant amount of water.
+auto error(const Brine& brine, VectorConstRef n, VectorConstRef expected) -> double
+{
+    const Index iH2O = brine.system.indexSpecies("H2O(l)");
+    Vector dn = n - expected;
+    Vector ne = expected;
+    dn[iH2O] = ne[iH2O] = 0.0;
+    return dn.norm()/ne.norm();
+}
+
+} // namespace
+
+TEST_CASE("Testing the save and load of learned states in SmartEquilibriumSolver")
+{
+    Brine brine;
+
+    const double T = 298.15, P = 1.0e5;
+    const std::string filename = "TestSmartEquilibriumSolver.dat";
+
+    SmartEquilibriumSolver solver(brine.system);
+    for(double factor : {0.5, 1.0, 1.5, 2.0})
+    {
+        ChemicalState state = brine.state;
+        REQUIRE(solver.learn(state, T, P, brine.elementAmounts(factor)).optimum.succeeded);
+    }
+
+    solver.save(filename);
+
+    SmartEquilibriumSolver loaded(brine.system);
+    loaded.load(filename);
+    REQUIRE(loaded.numLearnedStates() == solver.numLearnedStates());
+
+    SUBCASE("Checking the loaded states give the same estimates as the original ones")
+    {
+        for(double factor : {0.51, 1.49, 1.98})
+        {
+            const Vector be = brine.elementAmounts(factor);
+
+            ChemicalState state = brine.state;
+            ChemicalState state_loaded = brine.state;
+            REQUIRE(solver.estimate(state, T, P, be).smart.succeeded);
+            REQUIRE(loaded.estimate(state_loaded, T, P, be).smart.succeeded);
+
+            CHECK(state_loaded.speciesAmounts() == state.speciesAmounts());
+
+            // The estimates approximate the full equilibrium calculation
+            CHECK(error(state_loaded.speciesAmounts(), brine.equilibrium(T, P, be)) < 1e-3);
+        }
+    }
+
+    SUBCASE("Checking the loaded states are appended to the learned ones")
+    {
+        loaded.load(filename);
+        CHECK(loaded.numLearnedStates() == 2*solver.numLearnedStates());
+    }
+
+    SUBCASE("Checking the states of a different chemical system are not loaded")
+    {
+        ChemicalEditor editor;
+        editor.addAqueousPhase("H2O NaCl CO2");
+        editor.addGaseousPhase("H2O(g) CO2(g)");
+
+        SmartEquilibriumSolver other(editor.createChemicalSystem());
+        CHECK_THROWS(other.load(filename));
+        CHECK(other.numLearnedStates() == 0);
+    }
+
+    std::remove(filename.c_str());
+}
+
+TEST_CASE("Testing the temperature and pressure in smart equilibrium estimates")
+{
+    Brine brine;
+
+    const double T0 = 298.15, P0 = 1.0e5;
+
+    SmartEquilibriumSolver solver(brine.system);
+    ChemicalState learned = brine.state;
+    REQUIRE(solver.learn(learned, T0, P0, brine.b).optimum.succeeded);
+
+    // The estimates at other temperatures and pressures improve on the learned
+    // state, which is what an estimate ignoring their changes would return
+    struct Case { double T, P, ratio; };
+    for(Case c : {Case{T0 + 5.0, P0, 0.5}, Case{T0 - 5.0, 5.0*P0, 0.5}, Case{T0, 20.0*P0, 1.0}})
+    {
+        const double T = c.T, P = c.P;
+
+        ChemicalState state = brine.state;
+        REQUIRE(solver.estimate(state, T, P, brine.b).smart.succeeded);
+
+        CHECK(state.temperature() == T);
+        CHECK(state.pressure() == P);
+
+        const Vector n = brine.equilibrium(T, P, brine.b);
+        CHECK(error(brine, state.speciesAmounts(), n) < c.ratio*error(brine, learned.speciesAmounts(), n));
+    }
+
+    // The nearest learned state in temperature is used as reference
+    ChemicalState hot = brine.state;
+    REQUIRE(solver.learn(hot, T0 + 50.0, P0, brine.b).optimum.succeeded);
+
+    ChemicalState state = brine.state;
+    REQUIRE(solver.estimate(state, T0 + 48.0, P0, brine.b).smart.succeeded);
+
+    const Vector n = brine.equilibrium(T0 + 48.0, P0, brine.b);
+    CHECK(error(brine, state.speciesAmounts(), n) < 0.5*error(brine, hot.speciesAmounts(), n));
+}
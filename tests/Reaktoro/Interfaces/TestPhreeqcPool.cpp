@@ -0,0 +1,127 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright (C) 2014-2018 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+#include <doctest/doctest.hpp>
+
+// C++ includes
+#include <atomic>
+#include <thread>
+
+// Reaktoro includes
+#include <Reaktoro/Reaktoro.hpp>
+using namespace Reaktoro;
+
+/// Return the path of the PHREEQC database in the source tree of Reaktoro
+auto databasePath(std::string name) -> std::string
+{
+    const std::string file = __FILE__;
+    const std::string dir = file.substr(0, file.find_last_of("/\\") + 1);
+    return dir + "../../../databases/phreeqc/" + name;
+}
+
+const std::string script = R"(
+SOLUTION 1
+    units   mol/kgw
+    temp    25.0
+    pH      7.0 charge
+    Na      0.1
+    Cl      0.1
+    Ca      0.01
+    C(4)    0.02
+EQUILIBRIUM_PHASES 1
+    Calcite 0.0 0.1
+END
+)";
+
+TEST_CASE("Testing PhreeqcPool")
+{
+    Phreeqc phreeqc(databasePath("phreeqc.dat"));
+    phreeqc.execute(script);
+
+    const unsigned pool_size = 2;
+    PhreeqcPool pool(phreeqc, pool_size);
+
+    CHECK(pool.size() == pool_size);
+    CHECK(pool.numSpecies() == phreeqc.numSpecies());
+    CHECK(pool.temperature() == phreeqc.temperature());
+    CHECK(pool.speciesAmounts() == phreeqc.speciesAmounts());
+
+    ChemicalSystem reference = phreeqc;
+    ChemicalSystem system = pool;
+
+    const double T = phreeqc.temperature();
+    const double P = phreeqc.pressure();
+    const Vector n0 = phreeqc.speciesAmounts();
+    const Index iH2O = reference.indexSpecies("H2O");
+
+    // The amounts of species in each case, with solute molalities changing by 10% between cases
+    const Index num_cases = 8;
+    std::vector<Vector> n(num_cases, n0);
+    for(Index k = 0; k < num_cases; ++k)
+    {
+        n[k] *= 1.0 + 0.1 * k;
+        n[k][iH2O] = n0[iH2O];
+    }
+
+    // The ln activities of the species in each case calculated serially without the pool
+    std::vector<Vector> expected(num_cases);
+    for(Index k = 0; k < num_cases; ++k)
+        expected[k] = reference.properties(T, P, n[k]).lnActivities().val;
+
+    // Return true if the ln activities of a case calculated with the pool are the expected ones
+    auto check = [&](Index k) -> bool
+    {
+        const Vector ln_a = system.properties(T, P, n[k]).lnActivities().val;
+        return (ln_a - expected[k]).norm() <= 1e-12 * expected[k].norm();
+    };
+
+    SUBCASE("Checking more threads than instances in the pool across repeated calls")
+    {
+        const unsigned num_threads = 3 * pool_size;
+
+        std::atomic<unsigned> failures(0);
+
+        for(unsigned round = 0; round < 3; ++round)
+        {
+            std::vector<std::thread> threads;
+            for(unsigned i = 0; i < num_threads; ++i)
+                threads.emplace_back([&, i]() {
+                    for(Index k = 0; k < num_cases; ++k)
+                        if(!check((k + i) % num_cases))
+                            ++failures;
+                });
+            for(auto& thread : threads)
+                thread.join();
+        }
+
+        CHECK(failures == 0);
+    }
+
+    SUBCASE("Checking the pool in parallel loops")
+    {
+        std::atomic<unsigned> failures(0);
+
+        for(unsigned round = 0; round < 3; ++round)
+            parallelFor(4 * num_cases, [&](Index begin, Index end) {
+                for(Index i = begin; i < end; ++i)
+                    if(!check(i % num_cases))
+                        ++failures;
+            }, 4 * pool_size);
+
+        CHECK(failures == 0);
+    }
+}
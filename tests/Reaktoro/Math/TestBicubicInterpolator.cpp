@@ -0,0 +1,64 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright (C) 2014-2018 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+#include <doctest/doctest.hpp>
+
+// Reaktoro includes
+#include <Reaktoro/Math/BicubicInterpolator.hpp>
+using namespace Reaktoro;
+
+TEST_CASE("Testing BicubicInterpolator")
+{
+    // A cubic polynomial with constant mixed derivative, which is reproduced exactly by the interpolation
+    const auto f  = [](double x, double y) { return x*x*x - 2*y*y*y + 3*x*y + x*x + y*y - 4*x + 5; };
+    const auto fx = [](double x, double y) { return 3*x*x + 3*y + 2*x - 4; };
+    const auto fy = [](double x, double y) { return -6*y*y + 3*x + 2*y; };
+
+    const std::vector<double> xcoordinates = { 0.0, 0.5, 2.0, 3.0 };
+    const std::vector<double> ycoordinates = { -1.0, 1.0, 1.5 };
+
+    std::vector<double> data, ddx, ddy;
+    for(double y : ycoordinates)
+        for(double x : xcoordinates)
+        {
+            data.push_back(f(x, y));
+            ddx.push_back(fx(x, y));
+            ddy.push_back(fy(x, y));
+        }
+
+    BicubicInterpolator interpolator(xcoordinates, ycoordinates, data, ddx, ddy);
+
+    CHECK(!interpolator.empty());
+
+    for(double x : { 0.0, 0.3, 0.5, 1.7, 2.9, 3.0 })
+    {
+        for(double y : { -1.0, -0.2, 1.0, 1.2, 1.5 })
+        {
+            double ddxval, ddyval;
+            const double val = interpolator(x, y, ddxval, ddyval);
+
+            CHECK(val == approx(f(x, y)));
+            CHECK(ddxval == approx(fx(x, y)));
+            CHECK(ddyval == approx(fy(x, y)));
+            CHECK(interpolator(x, y) == approx(val));
+        }
+    }
+
+    // Points outside the coordinates are clamped to their bounds
+    CHECK(interpolator(-1.0, 2.0) == approx(f(0.0, 1.5)));
+    CHECK(interpolator(4.0, -3.0) == approx(f(3.0, -1.0)));
+}
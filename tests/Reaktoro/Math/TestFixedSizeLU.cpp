@@ -0,0 +1,67 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright (C) 2014-2018 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+#include <doctest/doctest.hpp>
+
+// C++ includes
+#include <algorithm>
+
+// Reaktoro includes
+#include <Reaktoro/Math/Eigen/LU>
+#include <Reaktoro/Math/FixedSizeLU.hpp>
+#include <Reaktoro/Math/MathUtils.hpp>
+using namespace Reaktoro;
+
+TEST_CASE("Testing FixedSizeLU")
+{
+    // Check the fixed-size kernels, below and above the threshold, and the dynamic-size fallback
+    for(Index threshold : {Index(0), FixedSizeLU::default_threshold, FixedSizeLU::max_fixed_size, Index(100)})
+    {
+        for(Index n : {1, 2, 3, 7, 8, 10, 16, 17, 24})
+        {
+            // A well-conditioned matrix whose decomposition requires row pivoting
+            const Matrix A = Matrix::Random(n, n) + 2.0*n*Matrix::Identity(n, n).rowwise().reverse();
+            const Vector x = Vector::LinSpaced(n, 1.0, 2.0);
+            const Vector b = A*x;
+
+            FixedSizeLU lu;
+            lu.threshold = threshold;
+            lu.compute(A);
+
+            CHECK(lu.rows() == n);
+            CHECK(lu.cols() == n);
+            CHECK(lu.fixed() == (n <= std::min(threshold, FixedSizeLU::max_fixed_size)));
+
+            const Vector res = lu.solve(b) - x;
+
+            CHECK(res.norm() < 1e-12 * x.norm());
+
+            // The factors are the same as those of the dynamic-size algorithm
+            const Eigen::PartialPivLU<Matrix> expected(A);
+            CHECK((lu.LU - expected.matrixLU()).norm() < 1e-12 * A.norm());
+            CHECK(lu.P == expected.permutationP().indices());
+        }
+    }
+
+    // The threshold used in the decomposition also applies to the solution
+    const Matrix A = Matrix::Random(4, 4) + 8.0*Matrix::Identity(4, 4);
+    FixedSizeLU lu(A);
+    REQUIRE(lu.fixed());
+    lu.threshold = 0;
+    CHECK(lu.fixed());
+    CHECK((A*lu.solve(ones(4)) - ones(4)).norm() < 1e-12);
+}
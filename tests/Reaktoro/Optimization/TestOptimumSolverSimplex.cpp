@@ -0,0 +1,154 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright (C) 2014-2018 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+#include <doctest/doctest.hpp>
+
+// C++ includes
+#include <random>
+
+// Reaktoro includes
+#include <Reaktoro/Optimization/OptimumMethod.hpp>
+#include <Reaktoro/Optimization/OptimumOptions.hpp>
+#include <Reaktoro/Optimization/OptimumProblem.hpp>
+#include <Reaktoro/Optimization/OptimumResult.hpp>
+#include <Reaktoro/Optimization/OptimumSolver.hpp>
+#include <Reaktoro/Optimization/OptimumSolverSimplex.hpp>
+#include <Reaktoro/Optimization/OptimumState.hpp>
+using namespace Reaktoro;
+
+namespace {
+
+/// Return a feasible linear programming problem with bounded variables and random coefficients.
+auto linearProblem(Index m, Index n) -> OptimumProblem
+{
+    std::mt19937 generator(42);
+    std::uniform_real_distribution<double> uniform(0.0, 1.0);
+    auto random = [&](Index rows, Index cols) { return Matrix(Matrix::NullaryExpr(rows, cols, [&]() { return uniform(generator); })); };
+
+    OptimumProblem problem;
+    problem.n = n;
+    problem.A = random(m, n);
+    problem.b = problem.A * random(n, 1);
+    problem.c = random(n, 1) - Vector::Constant(n, 0.5);
+    problem.l = zeros(n);
+    problem.u = Vector::Constant(n, 2.0);
+    return problem;
+}
+
+/// Return the maximum violation of the optimality conditions of a linear programming problem.
+auto optimalityError(const OptimumProblem& problem, const OptimumState& state) -> double
+{
+    const Vector residual = problem.A * state.x - problem.b;
+    const Vector stationarity = problem.c - tr(problem.A) * state.y - state.z + state.w;
+    double error = std::max(residual.lpNorm<Eigen::Infinity>(), stationarity.lpNorm<Eigen::Infinity>());
+    error = std::max(error, -state.z.minCoeff());
+    error = std::max(error, -state.w.minCoeff());
+    error = std::max(error, (problem.l - state.x).maxCoeff());
+    error = std::max(error, (state.x - problem.u).maxCoeff());
+    return error;
+}
+
+} // namespace
+
+TEST_CASE("Testing the product-form updates of the simplex basis")
+{
+    const OptimumProblem problem = linearProblem(6, 40);
+
+    // The reference solution, with the basis factorized again at every pivot
+    OptimumOptions options;
+    options.simplex.pivot_tolerance = 1.0;
+    OptimumState expected;
+    const OptimumResult res = OptimumSolverSimplex().solve(problem, expected, options);
+    REQUIRE(res.succeeded);
+    REQUIRE(res.iterations > 10);
+    CHECK(optimalityError(problem, expected) < 1e-12);
+
+    for(unsigned frequency : {1u, 2u, 5u, 1000u})
+    {
+        OptimumOptions options;
+        options.simplex.refactorization_frequency = frequency;
+        OptimumState state;
+        const OptimumResult result = OptimumSolverSimplex().solve(problem, state, options);
+        CHECK(result.succeeded);
+        CHECK(result.iterations == res.iterations);
+        CHECK(optimalityError(problem, state) < 1e-12);
+        CHECK((state.x - expected.x).lpNorm<Eigen::Infinity>() < 1e-12);
+        CHECK(state.f.val == doctest::Approx(expected.f.val).epsilon(1e-14));
+    }
+}
+
+TEST_CASE("Testing the warm start of the simplex solver")
+{
+    OptimumProblem problem = linearProblem(6, 40);
+
+    OptimumSolverSimplex solver;
+    OptimumState state;
+    const OptimumResult cold = solver.solve(problem, state);
+    REQUIRE(cold.succeeded);
+
+    // A small change in `b` keeps the last basis feasible and optimal
+    problem.b *= 1.0 + 1e-6;
+
+    OptimumState expected;
+    OptimumOptions options;
+    options.simplex.warmstart = false;
+    const OptimumResult res = OptimumSolverSimplex().solve(problem, expected, options);
+
+    OptimumState warm;
+    const OptimumResult result = solver.solve(problem, warm);
+    CHECK(result.succeeded);
+    CHECK(result.iterations == 1);
+    CHECK(result.iterations < res.iterations);
+    CHECK(optimalityError(problem, warm) < 1e-12);
+    CHECK((warm.x - expected.x).lpNorm<Eigen::Infinity>() < 1e-12);
+
+    // A change in `A` prevents the warm start
+    problem.A(0, 0) *= 2.0;
+    const OptimumResult changed = solver.solve(problem, warm);
+    CHECK(changed.succeeded);
+    CHECK(changed.iterations > 1);
+    CHECK(optimalityError(problem, warm) < 1e-12);
+}
+
+TEST_CASE("Testing the persistence of the simplex basis in OptimumSolver")
+{
+    OptimumProblem problem = linearProblem(6, 40);
+
+    // The echelonization of the constraints depends on the last solution, which would change
+    // the equality constraint matrix seen by the simplex solver between the calculations
+    OptimumOptions options;
+    options.regularization.echelonize = false;
+
+    OptimumSolver solver(OptimumMethod::Simplex);
+    OptimumState state;
+    const OptimumResult cold = solver.solve(problem, state, options);
+    REQUIRE(cold.succeeded);
+
+    problem.b *= 1.0 + 1e-6;
+
+    // Setting the same method keeps the basis of the last calculation
+    solver.setMethod(OptimumMethod::Simplex);
+    CHECK(solver.solve(problem, state, options).iterations == 1);
+
+    // Changing the method discards it
+    solver.setMethod(OptimumMethod::IpNewton);
+    solver.setMethod(OptimumMethod::Simplex);
+    const OptimumResult result = solver.solve(problem, state, options);
+    CHECK(result.succeeded);
+    CHECK(result.iterations > 1);
+    CHECK(optimalityError(problem, state) < 1e-12);
+}
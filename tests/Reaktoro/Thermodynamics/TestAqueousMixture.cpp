@@ -0,0 +1,156 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright (C) 2014-2018 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+#include <doctest/doctest.hpp>
+
+// C++ includes
+#include <thread>
+
+// Reaktoro includes
+#include <Reaktoro/Reaktoro.hpp>
+using namespace Reaktoro;
+
+const Database db("supcrt98");
+
+/// Return true if two matrices are equal up to a relative tolerance.
+template<typename MatrixA, typename MatrixB>
+auto approxEqual(const MatrixA& a, const MatrixB& b) -> bool
+{
+    return (a - b).norm() <= 1e-12 * std::max(1.0, b.norm());
+}
+
+TEST_CASE("Testing the state of an aqueous mixture")
+{
+    ChemicalEditor editor(db);
+    AqueousPhase& phase = editor.addAqueousPhase("H2O NaCl CaCO3 MgSO4 CO2");
+    const AqueousMixture& mixture = phase.mixture();
+
+    const double T = 323.15;
+    const double P = 50e5;
+
+    Vector n = linspace(mixture.numSpecies(), 0.01, 1.0);
+    n[mixture.indexWater()] = 55.0;
+
+    SUBCASE("Checking the structured state against the dense calculation")
+    {
+        const AqueousMixtureState state = mixture.state(T, P, n);
+
+        const ChemicalVector x = mixture.moleFractions(n);
+        const ChemicalVector m = mixture.molalities(n);
+        const ChemicalVector ms = mixture.stoichiometricMolalities(m);
+        const ChemicalScalar Ie = mixture.effectiveIonicStrength(m);
+        const ChemicalScalar Is = mixture.stoichiometricIonicStrength(ms);
+
+        CHECK(approxEqual(state.x.val, x.val));
+        CHECK(approxEqual(state.x.ddn, x.ddn));
+        CHECK(approxEqual(state.m.val, m.val));
+        CHECK(approxEqual(state.m.ddn, m.ddn));
+        CHECK(approxEqual(state.ms.val, ms.val));
+        CHECK(approxEqual(state.ms.ddn, ms.ddn));
+        CHECK(state.Ie.val == approx(Ie.val));
+        CHECK(approxEqual(state.Ie.ddn, Ie.ddn));
+        CHECK(state.Is.val == approx(Is.val));
+        CHECK(approxEqual(state.Is.ddn, Is.ddn));
+    }
+
+    SUBCASE("Checking that a reused state is completely overwritten")
+    {
+        AqueousMixtureState state;
+        mixture.state(T, P, 2.0*n, state);
+        mixture.state(T, P, n, state);
+
+        const AqueousMixtureState expected = mixture.state(T, P, n);
+
+        CHECK(approxEqual(state.m.val, expected.m.val));
+        CHECK(approxEqual(state.m.ddn, expected.m.ddn));
+        CHECK(approxEqual(state.ms.ddn, expected.ms.ddn));
+        CHECK(state.Is.val == approx(expected.Is.val));
+
+        // A state without water has zero molalities, and the state calculated after it is still exact
+        Vector n_nowater = n;
+        n_nowater[mixture.indexWater()] = 0.0;
+        mixture.state(T, P, n_nowater, state);
+
+        CHECK(state.m.val.isZero());
+        CHECK(state.m.ddn.isZero());
+        CHECK(state.ms.ddn.isZero());
+        CHECK(state.Ie.ddn.isZero());
+
+        mixture.state(T, P, n, state);
+
+        CHECK(approxEqual(state.m.ddn, expected.m.ddn));
+        CHECK(approxEqual(state.ms.ddn, expected.ms.ddn));
+        CHECK(approxEqual(state.Is.ddn, expected.Is.ddn));
+    }
+
+    SUBCASE("Checking that an aqueous phase calculates the state once for all of its models")
+    {
+        // Count the calculations of the state by the evaluations of the water density they need
+        Index count = 0;
+        AqueousMixture counted = mixture;
+        counted.setWaterDensity([&](Temperature T, Pressure P) { ++count; return ThermoScalar(1000.0); });
+
+        AqueousPhase aqueous(counted);
+        aqueous.setChemicalModelHKF();
+        aqueous.setActivityModelDrummondCO2();
+        aqueous.setActivityModelSetschenow("NaCl(aq)", 0.1);
+
+        const Index num_species = aqueous.numSpecies();
+        ChemicalVector ln_g(num_species), ln_a(num_species);
+        ChemicalScalar V(num_species), G(num_species), H(num_species), Cp(num_species), Cv(num_species);
+        PhaseChemicalModelResult res{ln_g, ln_a, V, G, H, Cp, Cv};
+
+        aqueous.chemicalModel()(res, T, P, n);
+        CHECK(count == 1);
+    }
+
+    SUBCASE("Checking that systems from the same editor are evaluated independently in parallel")
+    {
+        phase.setChemicalModelHKF();
+        phase.setActivityModelDrummondCO2();
+
+        const ChemicalSystem system0 = editor.createChemicalSystem();
+        const ChemicalSystem system1 = editor.createChemicalSystem();
+
+        const Index num_species = system0.numSpecies();
+        const Vector n0 = linspace(num_species, 0.01, 1.0);
+        const Vector n1 = linspace(num_species, 1.0, 0.01);
+
+        const Vector expected0 = system0.properties(T, P, n0).lnActivities().val;
+        const Vector expected1 = system1.properties(T, P, n1).lnActivities().val;
+
+        const unsigned num_iterations = 200;
+
+        bool equal0 = true, equal1 = true;
+
+        std::thread thread0([&]() {
+            for(unsigned i = 0; i < num_iterations; ++i)
+                equal0 = equal0 && system0.properties(T, P, n0).lnActivities().val == expected0;
+        });
+
+        std::thread thread1([&]() {
+            for(unsigned i = 0; i < num_iterations; ++i)
+                equal1 = equal1 && system1.properties(T, P, n1).lnActivities().val == expected1;
+        });
+
+        thread0.join();
+        thread1.join();
+
+        CHECK(equal0);
+        CHECK(equal1);
+    }
+}
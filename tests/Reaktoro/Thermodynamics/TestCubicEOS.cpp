@@ -0,0 +1,158 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright (C) 2014-2018 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+#include <doctest/doctest.hpp>
+
+// C++ includes
+#include <cmath>
+
+// Reaktoro includes
+#include <Reaktoro/Core/Utils.hpp>
+#include <Reaktoro/Math/Roots.hpp>
+#include <Reaktoro/Thermodynamics/EOS/CubicEOS.hpp>
+using namespace Reaktoro;
+
+namespace {
+
+/// Return a Peng-Robinson equation of state for a mixture of CO2 and CH4.
+auto createCubicEOS() -> CubicEOS
+{
+    CubicEOS eos(2);
+    eos.setModel(CubicEOS::PengRobinson);
+    eos.setCriticalTemperatures({304.13, 190.56});
+    eos.setCriticalPressures({7.3773e6, 4.599e6});
+    eos.setAcentricFactors({0.22394, 0.0114});
+    return eos;
+}
+
+/// Check two chemical scalars are identical.
+auto checkEqual(const ChemicalScalar& l, const ChemicalScalar& r) -> void
+{
+    CHECK(l.val == r.val);
+    CHECK(l.ddT == r.ddT);
+    CHECK(l.ddP == r.ddP);
+    CHECK(l.ddn == r.ddn);
+}
+
+/// Check two chemical vectors are identical.
+auto checkEqual(const ChemicalVector& l, const ChemicalVector& r) -> void
+{
+    CHECK(l.val == r.val);
+    CHECK(l.ddT == r.ddT);
+    CHECK(l.ddP == r.ddP);
+    CHECK(l.ddn == r.ddn);
+}
+
+} // namespace
+
+TEST_CASE("Testing the batched roots of cubic equations")
+{
+    // Cubic equations with three real roots, and with a double root, as found near a phase boundary
+    const Vector a = (Vector(4) << -6.0, -4.0, -1.0, -0.95).finished();
+    const Vector b = (Vector(4) << 11.0, 5.0, 0.25, 0.28).finished();
+    const Vector c = (Vector(4) << -6.0, -2.0, -0.01, -0.02).finished();
+
+    for(double x0 : {0.0, 1.2, 10.0})
+    {
+        Vector x = constants(a.size(), x0);
+        newtonCubic(a, b, c, x, 1e-6, 100);
+
+        for(Index k = 0; k < a.size(); ++k)
+        {
+            auto f = [&](double z) { return std::make_tuple(z*z*z + a[k]*z*z + b[k]*z + c[k], 3*z*z + 2*a[k]*z + b[k]); };
+            CHECK(x[k] == newton(f, x0, 1e-6, 100));
+        }
+    }
+}
+
+TEST_CASE("Testing the batched evaluation of CubicEOS")
+{
+    for(bool liquid : {true, false})
+    {
+        CubicEOS single = createCubicEOS();
+        if(liquid) single.setPhaseAsLiquid();
+        else single.setPhaseAsVapor();
+
+        // States of CO2-rich mixtures around the saturation pressure of CO2, where the liquid and vapor roots are close
+        // (only the states at which the root solver converges from the initial guess of the phase are used)
+        std::vector<ThermoScalar> T, P;
+        std::vector<ChemicalVector> x;
+        std::vector<CubicEOS::Result> expected;
+        Index num_failed = 0, num_liquid_roots = 0, num_vapor_roots = 0;
+        for(double Tval : {280.0, 290.0, 300.0, 303.0})
+            for(double Pval : {3.0e6, 4.0e6, 5.0e6, 5.5e6, 6.0e6, 6.5e6, 6.7e6, 7.0e6, 7.4e6, 8.0e6, 9.0e6})
+                for(double xCO2 : {0.999, 0.99, 0.95})
+                {
+                    const ChemicalVector xval = moleFractions(Composition((Vector(2) << xCO2, 1.0 - xCO2).finished()));
+                    try { expected.push_back(single(Temperature(Tval), Pressure(Pval), xval)); }
+                    catch(...) { ++num_failed; continue; }
+                    T.push_back(Temperature(Tval));
+                    P.push_back(Pressure(Pval));
+                    x.push_back(xval);
+                    if(expected.back().molar_volume.val < 1e-4) ++num_liquid_roots;
+                    else ++num_vapor_roots;
+                }
+
+        // Both roots are found among the states, so that these cross the phase boundary
+        CHECK(num_liquid_roots > 0);
+        CHECK(num_vapor_roots > 0);
+
+        // A state without species, which yields zero properties
+        T.push_back(Temperature(300.0));
+        P.push_back(Pressure(1.0e5));
+        x.push_back(moleFractions(Composition(zeros(2))));
+        expected.push_back(single(T.back(), P.back(), x.back()));
+
+        CubicEOS eos = createCubicEOS();
+        if(liquid) eos.setPhaseAsLiquid();
+        else eos.setPhaseAsVapor();
+
+        std::vector<CubicEOS::Result> results;
+        eos(T, P, x, results);
+        REQUIRE(results.size() == T.size());
+
+        // The batched results are identical to those of the evaluation of each state with the scalar root solver
+        for(Index k = 0; k < T.size(); ++k)
+        {
+            checkEqual(results[k].molar_volume, expected[k].molar_volume);
+            checkEqual(results[k].residual_molar_gibbs_energy, expected[k].residual_molar_gibbs_energy);
+            checkEqual(results[k].residual_molar_enthalpy, expected[k].residual_molar_enthalpy);
+            checkEqual(results[k].partial_molar_volumes, expected[k].partial_molar_volumes);
+            checkEqual(results[k].ln_fugacity_coefficients, expected[k].ln_fugacity_coefficients);
+        }
+
+        // A smaller batch reuses the results of the previous one
+        std::vector<ThermoScalar> T2(T.begin(), T.begin() + 3), P2(P.begin(), P.begin() + 3);
+        std::vector<ChemicalVector> x2(x.begin(), x.begin() + 3);
+        eos(T2, P2, x2, results);
+        REQUIRE(results.size() == 3);
+        for(Index k = 0; k < 3; ++k)
+            checkEqual(results[k].ln_fugacity_coefficients, expected[k].ln_fugacity_coefficients);
+
+        CHECK_THROWS(eos(T2, P, x2, results));
+
+        // A batch with a state at which the root solver does not converge fails as the scalar evaluation
+        if(num_failed)
+        {
+            T2.push_back(Temperature(290.0));
+            P2.push_back(Pressure(3.0e6));
+            x2.push_back(moleFractions(Composition((Vector(2) << 0.999, 0.001).finished())));
+            CHECK_THROWS(single(T2.back(), P2.back(), x2.back()));
+            CHECK_THROWS(eos(T2, P2, x2, results));
+        }
+    }
+}
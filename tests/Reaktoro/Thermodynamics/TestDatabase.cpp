@@ -0,0 +1,232 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright (C) 2014-2018 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+#include <doctest/doctest.hpp>
+
+// C++ includes
+#include <cstdio>
+#include <fstream>
+
+// Reaktoro includes
+#include <Reaktoro/Reaktoro.hpp>
+#include <Reaktoro/Common/BinaryUtils.hpp>
+#include <Reaktoro/Thermodynamics/Databases/DatabaseUtils.hpp>
+using namespace Reaktoro;
+
+namespace {
+
+/// Return the names of a list of species.
+template<typename SpeciesType>
+auto speciesNames(const std::vector<SpeciesType>& species) -> std::vector<std::string>
+{
+    std::vector<std::string> names;
+    for(const auto& item : species)
+        names.push_back(item.name());
+    return names;
+}
+
+/// Return the value of the option exclude_species_with_missing_data recorded in a binary database file (-1 if not a valid file).
+auto excludedOption(std::string filename) -> int
+{
+    std::ifstream in(filename, std::ios::binary);
+    std::string magic;
+    std::uint32_t version = 0;
+    std::uint8_t excluded = 0;
+    readBinary(in, magic);
+    readBinary(in, version);
+    readBinary(in, excluded);
+    return in.good() ? excluded : -1;
+}
+
+/// Replace the hash of the built-in database recorded in a binary database file, and return the replaced one.
+auto replaceSourceHash(std::string filename, std::uint64_t hash) -> std::uint64_t
+{
+    std::fstream file(filename, std::ios::in | std::ios::out | std::ios::binary);
+    std::string magic;
+    std::uint32_t version = 0;
+    std::uint8_t excluded = 0;
+    std::uint64_t source = 0;
+    readBinary(file, magic);
+    readBinary(file, version);
+    readBinary(file, excluded);
+    const auto pos = file.tellg();
+    readBinary(file, source);
+    file.seekp(pos);
+    writeBinary(file, hash);
+    return source;
+}
+
+} // namespace
+
+TEST_CASE("Testing pre-parsed binary database files")
+{
+    Database xml("supcrt98.xml");
+
+    const std::string filename = "TestDatabase.rkdb";
+    xml.save(filename);
+
+    SUBCASE("Checking a binary database has the same contents as the xml one")
+    {
+        Database binary(filename);
+
+        CHECK(speciesNames(binary.elements()) == speciesNames(xml.elements()));
+        CHECK(speciesNames(binary.aqueousSpecies()) == speciesNames(xml.aqueousSpecies()));
+        CHECK(speciesNames(binary.gaseousSpecies()) == speciesNames(xml.gaseousSpecies()));
+        CHECK(speciesNames(binary.mineralSpecies()) == speciesNames(xml.mineralSpecies()));
+
+        Thermo thermo_xml(xml);
+        Thermo thermo_binary(binary);
+        for(auto name : {"H2O(l)", "CO2(aq)", "HCO3-", "Ca++", "CO2(g)", "Calcite"})
+        {
+            const double G_xml = thermo_xml.standardPartialMolarGibbsEnergy(350.0, 1.0e7, name).val;
+            const double G_binary = thermo_binary.standardPartialMolarGibbsEnergy(350.0, 1.0e7, name).val;
+            CHECK(G_binary == G_xml);
+        }
+    }
+
+    SUBCASE("Checking species created on demand match the xml ones")
+    {
+        // Each database is used from scratch, so that species are created by the queries below
+        Database binary(filename);
+        CHECK(binary.containsAqueousSpecies("CO2(aq)"));
+        CHECK_FALSE(binary.containsAqueousSpecies("CO2(g)"));
+        CHECK(binary.aqueousSpecies("CO2(aq)").formula() == xml.aqueousSpecies("CO2(aq)").formula());
+        CHECK(binary.mineralSpecies("Calcite").elements() == xml.mineralSpecies("Calcite").elements());
+        CHECK_THROWS(binary.aqueousSpecies("Unobtainium"));
+
+        Database binary2(filename);
+        const std::vector<std::string> elements = {"H", "O", "C", "Ca"};
+        CHECK(speciesNames(binary2.aqueousSpeciesWithElements(elements)) == speciesNames(xml.aqueousSpeciesWithElements(elements)));
+        CHECK(speciesNames(binary2.gaseousSpeciesWithElements(elements)) == speciesNames(xml.gaseousSpeciesWithElements(elements)));
+        CHECK(speciesNames(binary2.mineralSpeciesWithElements(elements)) == speciesNames(xml.mineralSpeciesWithElements(elements)));
+    }
+
+    SUBCASE("Checking an added species replaces the one in the binary file")
+    {
+        Database binary(filename);
+
+        AqueousSpecies species;
+        species.setName("CO2(aq)");
+        species.setFormula("CO2-custom");
+        species.setElements(xml.aqueousSpecies("CO2(aq)").elements());
+        binary.addAqueousSpecies(species);
+
+        CHECK(binary.aqueousSpecies("CO2(aq)").formula() == "CO2-custom");
+
+        const auto all = binary.aqueousSpecies();
+        CHECK(std::count_if(all.begin(), all.end(), [](const AqueousSpecies& s) { return s.name() == "CO2(aq)"; }) == 1);
+
+        // The replacement is kept in a new binary file created from this database
+        const std::string copyname = "TestDatabaseCopy.rkdb";
+        binary.save(copyname);
+        CHECK(Database(copyname).aqueousSpecies("CO2(aq)").formula() == "CO2-custom");
+        std::remove(copyname.c_str());
+    }
+
+    std::remove(filename.c_str());
+}
+
+TEST_CASE("Testing modified copies of a database")
+{
+    Database original("supcrt98.xml");
+    const AqueousSpecies species = original.aqueousSpecies("CO2(aq)");
+    const double molar_mass = species.elements().begin()->first.molarMass();
+
+    const double T = 350.0, P = 1.0e7;
+    const double G = Thermo(original).standardPartialMolarGibbsEnergy(T, P, "CO2(aq)").val;
+
+    Database copy = original;
+
+    SUBCASE("Checking the species of a modified copy are independent of the original ones")
+    {
+        Element element;
+        element.setName("Xx");
+        element.setMolarMass(1.0);
+        copy.addElement(element);
+
+        AqueousSpecies copyspecies = copy.aqueousSpecies("CO2(aq)");
+        copyspecies.setFormula("CO2-custom");
+        Element copyelement = copyspecies.elements().begin()->first;
+        copyelement.setMolarMass(2.0 * molar_mass);
+
+        CHECK(copy.aqueousSpecies("CO2(aq)").formula() == "CO2-custom");
+        CHECK(original.aqueousSpecies("CO2(aq)").formula() == species.formula());
+        CHECK(species.formula() != "CO2-custom");
+        CHECK(species.elements().begin()->first.molarMass() == molar_mass);
+        CHECK(speciesNames(original.elements()).size() + 1 == speciesNames(copy.elements()).size());
+    }
+
+    SUBCASE("Checking a modified copy does not share the thermodynamic states of the original")
+    {
+        // A Thermo instance of the unmodified copy shares the cache of the original
+        Thermo thermo(copy);
+        CHECK(thermo.standardPartialMolarGibbsEnergy(T, P, "CO2(aq)").val == G);
+
+        AqueousSpecies modified = species.clone();
+        AqueousSpeciesThermoData data = modified.thermoData();
+        data.hkf.get().Gf += 1000.0;
+        modified.setThermoData(data);
+        copy.addAqueousSpecies(modified);
+
+        CHECK(Thermo(copy).standardPartialMolarGibbsEnergy(T, P, "CO2(aq)").val != G);
+        CHECK(Thermo(original).standardPartialMolarGibbsEnergy(T, P, "CO2(aq)").val == G);
+        CHECK(thermo.standardPartialMolarGibbsEnergy(T, P, "CO2(aq)").val == G);
+        CHECK(original.aqueousSpecies("CO2(aq)").thermoData().hkf.get().Gf == species.thermoData().hkf.get().Gf);
+    }
+}
+
+TEST_CASE("Testing the cache of built-in databases")
+{
+    const auto options = global::options.database;
+
+    global::options.database.cache_directory = ".";
+    const std::string cachefile = "./supcrt98.xml.rkdb";
+    std::remove(cachefile.c_str());
+
+    const bool excluded = options.exclude_species_with_missing_data;
+
+    // The first use creates the cache and later uses load it
+    const Index num_species = Database("supcrt98.xml").aqueousSpecies().size();
+    REQUIRE(excludedOption(cachefile) == excluded);
+    CHECK(Database("supcrt98.xml").aqueousSpecies().size() == num_species);
+
+    // A cache created with a different option is not used, but created again with the current option
+    global::options.database.exclude_species_with_missing_data = !excluded;
+    Database("supcrt98.xml");
+    CHECK(excludedOption(cachefile) == !excluded);
+    global::options.database.exclude_species_with_missing_data = excluded;
+    Database("supcrt98.xml");
+    CHECK(excludedOption(cachefile) == excluded);
+
+    // A cache created from a different version of the built-in database is not used, but created again
+    const std::uint64_t hash = databaseHash("supcrt98.xml");
+    CHECK(hash != 0);
+    CHECK(databaseHash("supcrt98") == hash);
+    CHECK(databaseHash("supcrt07.xml") != hash);
+    CHECK(replaceSourceHash(cachefile, hash + 1) == hash);
+    CHECK(Database("supcrt98.xml").aqueousSpecies().size() == num_species);
+    CHECK(replaceSourceHash(cachefile, hash) == hash);
+
+    // A corrupted cache is ignored and replaced
+    std::ofstream(cachefile, std::ios::binary | std::ios::trunc) << "corrupted";
+    CHECK(Database("supcrt98.xml").aqueousSpecies().size() == num_species);
+    CHECK(excludedOption(cachefile) == excluded);
+    CHECK(Database("supcrt98.xml").aqueousSpecies().size() == num_species);
+
+    std::remove(cachefile.c_str());
+    global::options.database = options;
+}
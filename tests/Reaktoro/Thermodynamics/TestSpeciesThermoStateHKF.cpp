@@ -0,0 +1,50 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright (C) 2014-2018 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+#include <doctest/doctest.hpp>
+
+// Reaktoro includes
+#include <Reaktoro/Reaktoro.hpp>
+using namespace Reaktoro;
+
+TEST_CASE("Testing the temperature derivatives of the HKF properties of minerals")
+{
+    const Database db("supcrt98");
+    const Thermo thermo(db);
+
+    const double P = 100.0e+5;
+    const double h = 1.0e-3;
+
+    // Quartz has a phase transition at 848.15 K
+    for(auto name : { "Calcite", "Dolomite", "Quartz" })
+    {
+        for(double T : { 280.0, 298.15, 350.0, 500.0, 700.0, 900.0 })
+        {
+            const ThermoScalar G  = thermo.standardPartialMolarGibbsEnergy(T, P, name);
+            const ThermoScalar H  = thermo.standardPartialMolarEnthalpy(T, P, name);
+            const ThermoScalar S  = thermo.standardPartialMolarEntropy(T, P, name);
+            const ThermoScalar Cp = thermo.standardPartialMolarHeatCapacityConstP(T, P, name);
+
+            const double dGdT = (thermo.standardPartialMolarGibbsEnergy(T + h, P, name).val -
+                                 thermo.standardPartialMolarGibbsEnergy(T - h, P, name).val)/(2*h);
+
+            CHECK(G.ddT == approx(-S.val));
+            CHECK(G.ddT == approx(dGdT).epsilon(1e-6));
+            CHECK(H.ddT == approx(Cp.val));
+        }
+    }
+}
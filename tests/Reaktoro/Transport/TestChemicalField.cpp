@@ -0,0 +1,83 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright (C) 2014-2018 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+#include <doctest/doctest.hpp>
+
+// Reaktoro includes
+#include <Reaktoro/Reaktoro.hpp>
+#include <Reaktoro/Transport/TransportSolver.hpp>
+using namespace Reaktoro;
+
+TEST_CASE("Testing the construction of ChemicalField")
+{
+    ChemicalEditor editor;
+    editor.addAqueousPhase("H2O NaCl");
+
+    // The phases of the system count the evaluations of their chemical models
+    std::vector<Phase> phases = editor.createChemicalSystem().phases();
+    Index num_evaluations = 0;
+    for(auto& phase : phases)
+    {
+        const PhaseChemicalModel model = phase.chemicalModel();
+        phase.setChemicalModel([=, &num_evaluations](PhaseChemicalModelResult& res, Temperature T, Pressure P, VectorConstRef n)
+        {
+            ++num_evaluations;
+            model(res, T, P, n);
+        });
+    }
+
+    ChemicalSystem system(phases);
+
+    const Index size = 5;
+
+    SUBCASE("Checking a field of default states does not evaluate their properties")
+    {
+        ChemicalField field(size, system);
+        CHECK(num_evaluations == 0);
+
+        const ChemicalState state(system);
+        CHECK(field.size() == size);
+        CHECK(field.temperatures() == Vector::Constant(size, state.temperature()));
+        CHECK(field.pressures() == Vector::Constant(size, state.pressure()));
+        CHECK(field.speciesAmounts() == Matrix::Zero(system.numSpecies(), size));
+    }
+
+    SUBCASE("Checking a field of copies of a state")
+    {
+        ChemicalState state(system);
+        state.setTemperature(350.0);
+        state.setPressure(2.0e5);
+        state.setSpeciesAmount("H2O(l)", 55.5);
+        state.setSpeciesAmount("Na+", 0.1);
+        state.setSpeciesAmount("Cl-", 0.1);
+
+        ChemicalField field(size, state);
+        CHECK(field.temperatures() == Vector::Constant(size, 350.0));
+        CHECK(field.speciesAmounts() == state.speciesAmounts().replicate(1, size));
+
+        // The states of the field are views of its columns
+        field[2].setSpeciesAmount("Na+", 0.2);
+        CHECK(field.speciesAmounts()(system.indexSpecies("Na+"), 2) == 0.2);
+        CHECK(field.speciesAmounts()(system.indexSpecies("Na+"), 1) == 0.1);
+
+        // A copy of the field has its own arrays
+        ChemicalField copy = field;
+        copy[2].setTemperature(400.0);
+        CHECK(copy.temperatures()[2] == 400.0);
+        CHECK(field.temperatures()[2] == 350.0);
+    }
+}
@@ -0,0 +1,59 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright (C) 2014-2018 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+#include <doctest/doctest.hpp>
+
+// Reaktoro includes
+#include <Reaktoro/Transport/FiniteVolumeTransportSolver.hpp>
+using namespace Reaktoro;
+
+TEST_CASE("Testing finite-volume transport solver")
+{
+    const Index nx = 40, ny = 30;
+    const Index num_cells = nx * ny;
+    const Index num_variables = 5;
+
+    FiniteVolumeMesh mesh(nx, ny, 1.0, 1.0);
+
+    // Return the variables after some steps with a given number of threads
+    auto solve = [&](unsigned num_threads) -> Matrix
+    {
+        FiniteVolumeTransportSolver transport;
+        transport.setMesh(mesh);
+        transport.setVelocity(Vector((Vector(3) << 1.0e-3, 0.5e-3, 0.0).finished()));
+        transport.setDiffusionCoeff(1.0e-5);
+        transport.setTimeStep(10.0);
+        transport.setNumThreads(num_threads);
+        transport.initialize();
+
+        Matrix U = zeros(num_cells, num_variables);
+        const Vector ubc = linspace(num_variables, 1.0, 2.0);
+        for(Index k = 0; k < 20; ++k)
+            transport.step(U, ubc);
+
+        return U;
+    };
+
+    SUBCASE("Checking the parallel results match the serial ones")
+    {
+        const Matrix U1 = solve(1);
+        CHECK(U1.maxCoeff() > 0.0);
+        CHECK(solve(2) == U1);
+        CHECK(solve(4) == U1);
+        CHECK(solve(0) == U1);
+    }
+}
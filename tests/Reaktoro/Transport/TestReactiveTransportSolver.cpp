@@ -0,0 +1,353 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright (C) 2014-2018 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+#include <doctest/doctest.hpp>
+
+// C++ includes
+#include <cstdio>
+#include <fstream>
+#include <limits>
+
+// Reaktoro includes
+#include <Reaktoro/Reaktoro.hpp>
+#include <Reaktoro/Transport/TransportSolver.hpp>
+using namespace Reaktoro;
+
+/// The reactive transport problem of a brine with CO2 injected in a column with calcite.
+struct CalciteColumn
+{
+    ChemicalSystem system;
+    ChemicalState state_ic;
+    ChemicalState state_bc;
+
+    CalciteColumn()
+    {
+        ChemicalEditor editor;
+        editor.addAqueousPhase("H2O NaCl CaCO3 CO2");
+        editor.addMineralPhase("Calcite");
+
+        system = editor.createChemicalSystem();
+
+        EquilibriumProblem problem_ic(system);
+        problem_ic.setTemperature(60.0, "celsius");
+        problem_ic.setPressure(100.0, "bar");
+        problem_ic.add("H2O", 1.0, "kg");
+        problem_ic.add("NaCl", 0.7, "mol");
+        problem_ic.add("CaCO3", 10, "mol");
+
+        EquilibriumProblem problem_bc(system);
+        problem_bc.setTemperature(60.0, "celsius");
+        problem_bc.setPressure(100.0, "bar");
+        problem_bc.add("H2O", 1.0, "kg");
+        problem_bc.add("NaCl", 0.9, "mol");
+        problem_bc.add("CO2", 0.75, "mol");
+
+        state_ic = equilibrate(problem_ic);
+        state_bc = equilibrate(problem_bc);
+    }
+
+    /// Return a reactive transport solver for the column, initialized with a given field.
+    auto solver(const ChemicalField& field, double dt, const ReactiveTransportOptions& options = {}) const -> ReactiveTransportSolver
+    {
+        ReactiveTransportSolver rt(system);
+        rt.setMesh(Mesh(field.size(), 0.0, 1.0));
+        rt.setVelocity(1.0e-5);
+        rt.setDiffusionCoeff(1.0e-9);
+        rt.setBoundaryState(state_bc);
+        rt.setTimeStep(dt);
+        rt.setOptions(options);
+        rt.initialize(field);
+        return rt;
+    }
+};
+
+TEST_CASE("Testing reactive transport checkpoints")
+{
+    CalciteColumn column;
+
+    const Index num_cells = 10;
+    const double dt = 100.0;
+    const std::string filename = "TestReactiveTransportSolver.checkpoint";
+
+    ReactiveTransportOptions options;
+    options.skip_quiescent_cells = true;
+
+    ChemicalField field(num_cells, column.state_ic);
+    ReactiveTransportSolver rt = column.solver(field, dt, options);
+
+    for(Index i = 0; i < 3; ++i)
+        rt.step(field);
+
+    rt.save(filename, field);
+
+    // The results of the calculation continued without a restart
+    ChemicalField expected = field;
+    std::vector<Index> expected_skipped;
+    for(Index i = 0; i < 2; ++i)
+        expected_skipped.push_back(rt.step(expected).num_cells_skipped);
+
+    SUBCASE("Checking a restarted calculation continues as the original one")
+    {
+        ChemicalField restarted(num_cells, column.state_ic);
+        ReactiveTransportSolver rt2 = column.solver(restarted, 2*dt, options);
+        rt2.load(filename, restarted);
+
+        CHECK(rt2.timeStep() == dt);
+
+        for(Index i = 0; i < 2; ++i)
+            CHECK(rt2.step(restarted).num_cells_skipped == expected_skipped[i]);
+
+        // The species amounts differ only by round-off, since the equilibrium solver of the
+        // restarted calculation does not start with the internal state of the original one
+        const Matrix n = restarted.speciesAmounts();
+        const Matrix n_expected = expected.speciesAmounts();
+        CHECK((n - n_expected).norm() <= 1e-12 * n_expected.norm());
+        CHECK(restarted.temperatures() == expected.temperatures());
+    }
+
+    SUBCASE("Checking an invalid checkpoint leaves the solver and the field unchanged")
+    {
+        // Create a copy of the checkpoint file without its last bytes
+        std::ifstream in(filename, std::ios::binary);
+        std::string contents((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+        const std::string truncated = "TestReactiveTransportSolver.truncated";
+        std::ofstream(truncated, std::ios::binary) << contents.substr(0, contents.size() - 100);
+
+        ChemicalField restarted(num_cells, column.state_ic);
+        ReactiveTransportSolver rt2 = column.solver(restarted, 2*dt, options);
+        const Matrix n = restarted.speciesAmounts();
+
+        CHECK_THROWS(rt2.load(truncated, restarted));
+        CHECK(rt2.timeStep() == 2*dt);
+        CHECK(restarted.speciesAmounts() == n);
+
+        // A checkpoint for a different number of cells is rejected as well
+        ChemicalField smaller(num_cells - 1, column.state_ic);
+        ReactiveTransportSolver rt3 = column.solver(smaller, 2*dt, options);
+        CHECK_THROWS(rt3.load(filename, smaller));
+        CHECK(smaller.size() == num_cells - 1);
+
+        std::remove(truncated.c_str());
+    }
+
+    std::remove(filename.c_str());
+}
+
+TEST_CASE("Testing reactive transport binary output")
+{
+    CalciteColumn column;
+
+    const Index num_cells = 10;
+    const Index num_steps = 3;
+
+    ChemicalField field(num_cells, column.state_ic);
+    ReactiveTransportSolver rt = column.solver(field, 100.0);
+
+    // A block smaller than the number of cells, so that each step writes several blocks
+    ChemicalOutput output = rt.output();
+    output.filename("TestReactiveTransportSolver.rko");
+    output.format(ChemicalOutputFormat::Binary64);
+    output.blockSize(4);
+    output.add("t");
+    output.add("speciesAmount(Ca++)");
+
+    for(Index k = 0; k < num_steps; ++k)
+    {
+        rt.step(field);
+
+        // The output of each step is complete when the step returns
+        const std::string filename = "TestReactiveTransportSolver-" + std::to_string(k) + ".rko";
+        ChemicalOutputReader reader(filename);
+        REQUIRE(reader.values().rows() == num_cells);
+        for(Index icell = 0; icell < num_cells; ++icell)
+        {
+            CHECK(reader.values()(icell, 0) == icell);
+            CHECK(reader.values()(icell, 1) == field[icell].speciesAmount("Ca++"));
+        }
+        std::remove(filename.c_str());
+    }
+}
+
+TEST_CASE("Testing reactive transport sub-cycled by the Courant limit")
+{
+    // An aqueous system, whose amounts of elements change only by transport, so that
+    // sub-cycling the transport gives the same results as smaller reactive time steps
+    ChemicalEditor editor;
+    editor.addAqueousPhase("H2O NaCl CO2");
+
+    ChemicalSystem system = editor.createChemicalSystem();
+
+    EquilibriumProblem problem_ic(system);
+    problem_ic.add("H2O", 1.0, "kg");
+    problem_ic.add("NaCl", 0.7, "mol");
+
+    EquilibriumProblem problem_bc(system);
+    problem_bc.add("H2O", 1.0, "kg");
+    problem_bc.add("NaCl", 0.9, "mol");
+    problem_bc.add("CO2", 0.1, "mol");
+
+    const ChemicalState state_ic = equilibrate(problem_ic);
+    const ChemicalState state_bc = equilibrate(problem_bc);
+
+    const Index num_cells = 10;
+    const double velocity = 1.0e-5;
+
+    // The time step with Courant number 2 in the cells of the mesh
+    const double dt = 2.0 * (1.0/num_cells)/velocity;
+
+    auto solver = [&](ChemicalField& field, double dt, double max_courant)
+    {
+        ReactiveTransportOptions options;
+        options.max_courant = max_courant;
+
+        ReactiveTransportSolver rt(system);
+        rt.setMesh(Mesh(num_cells, 0.0, 1.0));
+        rt.setVelocity(velocity);
+        rt.setDiffusionCoeff(1.0e-9);
+        rt.setBoundaryState(state_bc);
+        rt.setTimeStep(dt);
+        rt.setOptions(options);
+        rt.initialize(field);
+        return rt;
+    };
+
+    // The transport is not sub-cycled by default
+    ChemicalField field(num_cells, state_ic);
+    ReactiveTransportSolver rt = solver(field, dt, std::numeric_limits<double>::infinity());
+    CHECK(ReactiveTransportOptions().max_courant == std::numeric_limits<double>::infinity());
+    CHECK(rt.step(field).num_transport_substeps == 1);
+
+    // Two steps with sub-cycled transport and eight steps with a quarter of the time step
+    ChemicalField coarse(num_cells, state_ic);
+    ChemicalField fine(num_cells, state_ic);
+    ReactiveTransportSolver rt_coarse = solver(coarse, dt, 0.5);
+    ReactiveTransportSolver rt_fine = solver(fine, dt/4, 0.5);
+
+    for(Index i = 0; i < 2; ++i)
+        CHECK(rt_coarse.step(coarse).num_transport_substeps == 4);
+    for(Index i = 0; i < 8; ++i)
+        CHECK(rt_fine.step(fine).num_transport_substeps == 1);
+
+    const Matrix b_coarse = system.formulaMatrix() * coarse.speciesAmounts();
+    const Matrix b_fine = system.formulaMatrix() * fine.speciesAmounts();
+    CHECK((b_coarse - b_fine).norm() <= 1e-12 * b_fine.norm());
+
+    const Matrix n_coarse = coarse.speciesAmounts();
+    const Matrix n_fine = fine.speciesAmounts();
+    CHECK((n_coarse - n_fine).norm() <= 1e-8 * n_fine.norm());
+
+    // A non-positive maximum Courant number is rejected
+    ReactiveTransportSolver rt_invalid = solver(field, dt, 0.0);
+    CHECK_THROWS(rt_invalid.step(field));
+}
+
+TEST_CASE("Testing reactive transport with quiescent cells skipped")
+{
+    CalciteColumn column;
+
+    const Index num_cells = 10;
+    const Index num_steps = 5;
+    const double dt = 100.0;
+
+    ReactiveTransportOptions options_skip;
+    options_skip.skip_quiescent_cells = true;
+
+    ReactiveTransportOptions options_update = options_skip;
+    options_update.skip_sensitivity_update = true;
+
+    ChemicalField field(num_cells, column.state_ic);
+    ChemicalField field_skip(num_cells, column.state_ic);
+    ChemicalField field_update(num_cells, column.state_ic);
+
+    ReactiveTransportSolver rt = column.solver(field, dt);
+    ReactiveTransportSolver rt_skip = column.solver(field_skip, dt, options_skip);
+    ReactiveTransportSolver rt_update = column.solver(field_update, dt, options_update);
+
+    Index num_skipped = 0;
+    Index num_updated = 0;
+
+    for(Index i = 0; i < num_steps; ++i)
+    {
+        // The calculation without skipping solves the equilibrium of every cell
+        const ReactiveTransportResult res = rt.step(field);
+        CHECK(res.num_cells_solved == num_cells);
+        CHECK(res.num_cells_skipped == 0);
+
+        const ReactiveTransportResult res_skip = rt_skip.step(field_skip);
+        CHECK(res_skip.num_cells_solved + res_skip.num_cells_skipped == num_cells);
+        num_skipped += res_skip.num_cells_skipped;
+
+        // No cell has a previous calculation to compare with in the first step
+        if(i == 0)
+            CHECK(res_skip.num_cells_skipped == 0);
+
+        const ReactiveTransportResult res_update = rt_update.step(field_update);
+        CHECK(res_update.num_cells_solved + res_update.num_cells_skipped == num_cells);
+        num_updated += res_update.num_cells_skipped;
+    }
+
+    // The cells ahead of the injected brine are skipped after the first step
+    CHECK(num_skipped > 0);
+    CHECK(num_updated > 0);
+
+    // The skipped cells change only within the tolerances of the quiescent test
+    const Matrix n = field.speciesAmounts();
+    const Matrix n_skip = field_skip.speciesAmounts();
+    const Matrix n_update = field_update.speciesAmounts();
+    CHECK((n_skip - n).norm() <= 1e-8 * n.norm());
+
+    // The sensitivity correction of the skipped cells brings them much closer to the baseline
+    CHECK((n_update - n).norm() <= 1e-12 * n.norm());
+}
+
+TEST_CASE("Testing reactive transport with adaptive time steps")
+{
+    CalciteColumn column;
+
+    const Index num_cells = 10;
+    const Index num_steps = 10;
+    const double dt = 100.0;
+
+    ChemicalField field(num_cells, column.state_ic);
+
+    ReactiveTransportOptions options;
+    options.adaptive_time_step = true;
+
+    // The time step would otherwise decay towards zero at a moving reaction front
+    CHECK_THROWS(column.solver(field, dt, options));
+
+    options.min_time_step = 50.0;
+    options.max_time_step = 150.0;
+
+    ReactiveTransportSolver rt = column.solver(field, dt, options);
+
+    for(Index i = 0; i < num_steps; ++i)
+    {
+        // The step is done with the current time step, and only the next one is adapted
+        const double current = rt.timeStep();
+        const ReactiveTransportResult res = rt.step(field);
+        CHECK(res.time_step == current);
+
+        double expected = current;
+        if(res.num_cells_assemblage_changed > 0 || res.max_equilibrium_iterations > options.time_step_decrease_iterations)
+            expected *= options.time_step_decrease_factor;
+        else if(res.max_equilibrium_iterations <= options.time_step_increase_iterations)
+            expected *= options.time_step_increase_factor;
+
+        CHECK(rt.timeStep() == approx(std::min(std::max(expected, options.min_time_step), options.max_time_step)));
+    }
+}